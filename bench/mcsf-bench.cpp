@@ -0,0 +1,626 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file mcsf-bench.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Added trajectory point queue throughput
+ * @date Oct 19, 2026 - Added drive simulation
+ * @date Oct 19, 2026 - Added trajectory follower ticks
+ * @date Oct 19, 2026 - Added fleet planning
+ * @date Oct 19, 2026 - Added grid path planning across a field map
+ * @date Oct 19, 2026 - Added spline path sampling by distance
+ * @date Oct 19, 2026 - Added nearest path point queries and pure pursuit ticks
+ * @date Oct 19, 2026 - Added route order optimization
+ * @date Oct 19, 2026 - Added move time estimates against generating the move
+ * @date Oct 19, 2026 - Added incremental re-planning after localized and global map changes
+ * @date Oct 19, 2026 - Added a fleet of one chassis
+ *
+ * @brief A main program to measure the performance of the MCSF motion pipeline
+ *
+ * This program times the main stages of the Motion Control System Framework's motion
+ * pipeline: generating trajectories across distances and iteration periods, moving a
+ * TankDrive straight and turning, estimating a move's time against generating its
+ * trajectories, writing a trajectory to a CSV file, planning a path from a route (along
+ * a line and across a field map), re-planning across the map incrementally after a
+ * change (against a fresh search), sampling a spline path by distance, finding the
+ * nearest point of a path and steering along it with pure pursuit, ordering route
+ * locations, passing trajectory points between threads through a queue, simulating a
+ * move, calculating trajectory follower commands, and planning fleets of one to a
+ * thousand chassis.  Each benchmark is run a few times to warm up, then timed over a
+ * number of repetitions; the minimum, median and 99th percentile times, and the median
+ * time per trajectory (or path) point produced, are written as JSON so that results can
+ * be compared between builds.
+ *
+ * Usage: mcsf-bench [output file [repetitions]]
+ * (the JSON goes to the standard output when no output file is given)
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../framework/Chassis.hpp"
+#include "../framework/ChassisAcceleration.hpp"
+#include "../framework/ChassisTurnRate.hpp"
+#include "../framework/ChassisVelocity.hpp"
+#include "../framework/DCMotorModel.hpp"
+#include "../framework/DriveSimulator.hpp"
+#include "../framework/FleetPlanner.hpp"
+#include "../framework/GridPlanner.hpp"
+#include "../framework/IncrementalGridPlanner.hpp"
+#include "../framework/MotorAcceleration.hpp"
+#include "../framework/MotorPosition.hpp"
+#include "../framework/MotorVelocity.hpp"
+#include "../framework/OccupancyGrid.hpp"
+#include "../framework/Path.hpp"
+#include "../framework/PathIndex.hpp"
+#include "../framework/PoseWayPoint.hpp"
+#include "../framework/PurePursuitFollower.hpp"
+#include "../framework/Route.hpp"
+#include "../framework/RouteOptimizer.hpp"
+#include "../framework/SplinePath.hpp"
+#include "../framework/TankDrive.hpp"
+#include "../framework/Trajectory.hpp"
+#include "../framework/TrajectoryFollower.hpp"
+#include "../framework/TrajectoryPoint.hpp"
+#include "../framework/TrajectoryPointQueue.hpp"
+#include "../framework/WayPoint.hpp"
+
+namespace {
+// Untimed runs of each benchmark before the timed ones
+const unsigned int warmupRuns = 3;
+// Timed runs of each benchmark, unless given on the command line
+const unsigned int defaultRepetitions = 50;
+// Name given to the benchmarked chassis (its moves write CSV files with it)
+const std::string benchChassisName = "mcsf-bench-chassis";
+
+// The timings of one benchmark
+struct BenchmarkResult {
+  std::string name;
+  unsigned int points;  // trajectory or path points produced per run
+  double minNS;
+  double medianNS;
+  double p99NS;
+  double nsPerPoint;    // median time per point produced
+};
+
+/**
+ * @brief Time a benchmark after warming it up
+ * @param [in] string name of the benchmark
+ * @param [in] unsigned int repetitions - number of timed runs
+ * @param [in] function run - runs the benchmark once, returning the number of points produced
+ * @param [in] function setup - prepares each run, untimed (none if empty)
+ * @return BenchmarkResult timings of the runs
+ */
+BenchmarkResult runBenchmark(const std::string &name,
+                             const unsigned int repetitions,
+                             const std::function<unsigned int()> &run,
+                             const std::function<void()> &setup =
+                                 std::function<void()>()) {
+  unsigned int points = 0;
+  for (unsigned int i = 0; i < warmupRuns; i++) {
+    if (setup)
+      setup();
+    points = run();
+  }
+
+  std::vector<double> samplesNS;
+  samplesNS.reserve(repetitions);
+  for (unsigned int i = 0; i < repetitions; i++) {
+    if (setup)
+      setup();
+    const auto start = std::chrono::steady_clock::now();
+    points = run();
+    samplesNS.push_back(std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count());
+  }
+  std::sort(samplesNS.begin(), samplesNS.end());
+
+  BenchmarkResult result;
+  result.name = name;
+  result.points = points;
+  result.minNS = samplesNS.front();
+  result.medianNS = samplesNS[samplesNS.size() / 2];
+  result.p99NS = samplesNS[static_cast<unsigned int>(std::ceil(
+      0.99 * samplesNS.size())) - 1];
+  result.nsPerPoint = (points > 0) ? result.medianNS / points : 0.0;
+  std::cerr << name << ": median " << result.medianNS / 1000 << " us, "
+            << result.nsPerPoint << " ns/point" << std::endl;
+  return result;
+}
+
+/**
+ * @brief Write benchmark results as a JSON document
+ * @param [in/out] ostream output to write to
+ * @param [in] unsigned int repetitions - number of timed runs of each benchmark
+ * @param [in] vector of BenchmarkResult results to write
+ */
+void writeJSON(std::ostream &output, const unsigned int repetitions,
+               const std::vector<BenchmarkResult> &results) {
+  output << "{" << std::endl;
+  output << "  \"benchmark\": \"mcsf-bench\"," << std::endl;
+  output << "  \"warmup\": " << warmupRuns << "," << std::endl;
+  output << "  \"repetitions\": " << repetitions << "," << std::endl;
+  output << "  \"results\": [" << std::endl;
+  output << std::fixed << std::setprecision(1);
+  for (std::vector<BenchmarkResult>::size_type i = 0; i < results.size();
+      i++) {
+    const BenchmarkResult &result = results[i];
+    output << "    { \"name\": \"" << result.name << "\", \"points\": "
+           << result.points << ", \"min_ns\": " << result.minNS
+           << ", \"median_ns\": " << result.medianNS << ", \"p99_ns\": "
+           << result.p99NS << ", \"ns_per_point\": " << result.nsPerPoint
+           << " }" << ((i + 1 < results.size()) ? "," : "") << std::endl;
+  }
+  output << "  ]" << std::endl;
+  output << "}" << std::endl;
+  return;
+}
+
+/**
+ * @brief Make a two point path for trajectory generation
+ * @param [in] double distanceRotations between the points
+ * @return Path from 0 to the distance, at 600 rpm and 1200 rpm/s
+ */
+Path makeTwoPointPath(const double distanceRotations) {
+  Path path;
+  path.reserve(2);
+  path.emplacePathPoint(MotorPosition(),
+                        MotorVelocity::fromRotationsPerMinute(600),
+                        MotorAcceleration::fromRotationsPerMinutePerSecond(
+                            1200));
+  path.emplacePathPoint(MotorPosition::fromRotations(distanceRotations),
+                        MotorVelocity(), MotorAcceleration());
+  return path;
+}
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const std::string outputFileName = (argc > 1) ? argv[1] : "";
+  const unsigned int repetitions = (argc > 2) ?
+      std::max(std::atoi(argv[2]), 1) : defaultRepetitions;
+  std::vector<BenchmarkResult> results;
+
+//********************************************************************
+//     Trajectory generation across distances and iteration periods
+//********************************************************************
+  const double distancesRotations[] = { 1, 10, 100 };
+  const unsigned int periodsMS[] = { 1, 10, 25 };
+  for (const double distanceRotations : distancesRotations) {
+    for (const unsigned int periodMS : periodsMS) {
+      const Path path = makeTwoPointPath(distanceRotations);
+      Trajectory trajectory;
+      std::ostringstream name;
+      name << "Trajectory::generate/" << distanceRotations << "rot/"
+           << periodMS << "ms";
+      results.push_back(runBenchmark(name.str(), repetitions, [&]() {
+        trajectory.generate(path, periodMS);
+        return trajectory.size();
+      }));
+    }
+  }
+
+//********************************************************************
+//     TankDrive moves, straight and turning (each writes two CSV files)
+//********************************************************************
+  TankDrive tankDrive;
+  tankDrive.setChassisName(benchChassisName);
+  tankDrive.setMaxVelocity(MotorVelocity::fromRotationsPerMinute(4250));
+  tankDrive.setMaxAcceleration(
+      MotorAcceleration::fromRotationsPerMinutePerSecond(51000));
+  tankDrive.setMotorRotPerMovementFoot(850);
+  tankDrive.setTrajectoryIterationPeriodMS(10);
+  tankDrive.setWidthInFeet(2.75);
+  const double turnRates[] = { 0, 7.5 };
+  for (const double turnRate : turnRates) {
+    const ChassisTurnRate chassisTurnRate = ChassisTurnRate::fromDegreesPerFoot(
+        turnRate);
+    const ChassisVelocity velocity = ChassisVelocity::fromFeetPerSecond(5);
+    const ChassisAcceleration acceleration =
+        ChassisAcceleration::fromFeetPerSecondPerSecond(3);
+    unsigned int pointCount = 0;
+    double durationS;
+    tankDrive.estimateMoveTime(12, chassisTurnRate, velocity, acceleration,
+                               pointCount, durationS);
+    results.push_back(runBenchmark(
+        (turnRate == 0) ? "TankDrive::move/straight" : "TankDrive::move/turning",
+        repetitions, [&]() {
+          tankDrive.move(12, chassisTurnRate, velocity, acceleration);
+          return 2 * pointCount;
+        }));
+  }
+  std::remove((benchChassisName + "-left.CSV").c_str());
+  std::remove((benchChassisName + "-right.CSV").c_str());
+
+//********************************************************************
+//     Estimating a turning move's time, and generating its trajectories
+//********************************************************************
+  const ChassisTurnRate estimatedTurnRate = ChassisTurnRate::fromDegreesPerFoot(
+      7.5);
+  const ChassisVelocity estimatedVelocity = ChassisVelocity::fromFeetPerSecond(
+      5);
+  const ChassisAcceleration estimatedAcceleration =
+      ChassisAcceleration::fromFeetPerSecondPerSecond(3);
+  results.push_back(runBenchmark("TankDrive::estimateMoveTime/turning",
+                                 repetitions, [&]() {
+    unsigned int pointCount = 0;
+    double durationS;
+    tankDrive.estimateMoveTime(12, estimatedTurnRate, estimatedVelocity,
+                               estimatedAcceleration, pointCount, durationS);
+    return 0u;
+  }));
+  Trajectory estimatedLeft, estimatedRight;
+  results.push_back(runBenchmark("TankDrive::generateTrajectories/turning",
+                                 repetitions, [&]() {
+    tankDrive.generateTrajectories(12, estimatedTurnRate, estimatedVelocity,
+                                   estimatedAcceleration, estimatedLeft,
+                                   estimatedRight);
+    return estimatedLeft.size() + estimatedRight.size();
+  }));
+
+//********************************************************************
+//     Simulating the demonstration robot's turning move (1 ms steps)
+//********************************************************************
+  Trajectory simulatedLeft, simulatedRight;
+  tankDrive.generateTrajectories(
+      45, ChassisTurnRate::fromDegreesPerFoot(5),
+      ChassisVelocity::fromFeetPerSecond(3),
+      ChassisAcceleration::fromFeetPerSecondPerSecond(2), simulatedLeft,
+      simulatedRight);
+  DCMotorModel simulatedMotor;
+  simulatedMotor.setTimeConstantS(0.05);
+  DriveSimulator simulator;
+  simulator.configureFromTankDrive(tankDrive);
+  simulator.setMotorModel(simulatedMotor);
+  simulator.setSettleTimeS(1.0);
+  results.push_back(runBenchmark("DriveSimulator::simulate/45ft", repetitions,
+                                 [&]() {
+    simulator.simulate(simulatedLeft, simulatedRight);
+    return simulator.getStepCount();
+  }));
+
+//********************************************************************
+//     Trajectory follower ticks (feedforward plus PID, 1 ms period)
+//********************************************************************
+  Trajectory followedTrajectory;
+  followedTrajectory.generate(makeTwoPointPath(20), 1);
+  TrajectoryFollower follower;
+  follower.setIterationPeriodMS(1);
+  follower.setFeedforwardGains(1, 0.1);
+  follower.setPIDGains(600, 60, 1);
+  follower.setIntegralLimit(1000);
+  follower.setOutputLimit(1200);
+  double followerCommandSum = 0.0;
+  results.push_back(runBenchmark("TrajectoryFollower::calculate", repetitions,
+                                 [&]() {
+    follower.reset();
+    for (const TrajectoryPoint &setpoint :
+        followedTrajectory.getTrajectoryPoints())
+      followerCommandSum += follower.calculate(setpoint,
+                                               setpoint.getPosition());
+    return followedTrajectory.size();
+  }));
+  if (followerCommandSum == 0.0)
+    std::cerr << "TrajectoryFollower commands were all 0" << std::endl;
+
+//********************************************************************
+//     Writing a trajectory to a CSV file
+//********************************************************************
+  const std::string csvFileName = "mcsf-bench-trajectory.CSV";
+  Trajectory csvTrajectory;
+  csvTrajectory.generate(makeTwoPointPath(100), 10);
+  results.push_back(runBenchmark("Trajectory::outputCSV", repetitions, [&]() {
+    csvTrajectory.outputCSV(csvFileName);
+    return csvTrajectory.size();
+  }));
+  std::remove(csvFileName.c_str());
+
+//********************************************************************
+//     Planning a path from a route's way points
+//********************************************************************
+  Route route;
+  for (unsigned int i = 0; i < 1000; i++) {
+    WayPoint wayPoint;
+    wayPoint.setPosition(MotorPosition::fromRotations(i * 2.5));
+    route.addWayPoint(wayPoint);
+  }
+  const MotorVelocity maxVelocity = MotorVelocity::fromRotationsPerMinute(600);
+  const MotorAcceleration maxAcceleration =
+      MotorAcceleration::fromRotationsPerMinutePerSecond(1200);
+  results.push_back(runBenchmark("Route::planPath/1000", repetitions, [&]() {
+    return route.planPath(maxVelocity, maxAcceleration).size();
+  }));
+
+//********************************************************************
+//     Planning a route's path across a field map (54 x 27 ft, 2 in cells)
+//********************************************************************
+  OccupancyGrid fieldGrid;
+  fieldGrid.resize(324, 162, 2.0 / 12);
+  fieldGrid.setOccupiedRectangle(160, 0, 4, 140, true);
+  fieldGrid.setOccupiedRectangle(250, 40, 30, 122, true);
+  GridPlanner gridPlanner;
+  gridPlanner.setGrid(fieldGrid);
+  Route gridRoute;
+  gridRoute.addGridWayPoint(10, 10);
+  gridRoute.addGridWayPoint(150, 10);
+  gridRoute.addGridWayPoint(300, 150);
+  Path gridPath;
+  std::vector<unsigned int> cornerCells;
+  results.push_back(runBenchmark("Route::planGridPath/field", repetitions,
+                                 [&]() {
+    gridRoute.planGridPath(gridPlanner, 850, tankDrive.getMaxVelocity(),
+                           tankDrive.getMaxAcceleration(), gridPath,
+                           cornerCells);
+    return gridPath.size();
+  }));
+
+//********************************************************************
+//     Re-planning across the field map after a localized change (a
+//     small obstacle across the route) and a global one (the gap past
+//     the long barrier moving to its far end): an incremental repair
+//     against a fresh search, each run from the unchanged map
+//********************************************************************
+  std::vector<unsigned int> replannedCells;
+  IncrementalGridPlanner plannedIncrementalPlanner;
+  plannedIncrementalPlanner.setGrid(fieldGrid);
+  plannedIncrementalPlanner.plan(10, 10, 300, 150, replannedCells);
+  std::vector<unsigned int> localizedCells, globalCells;
+  const unsigned int blockedCell = replannedCells[12];
+  for (int row = -1; row <= 1; row++)
+    for (int column = -1; column <= 1; column++)
+      localizedCells.push_back(fieldGrid.cellIndex(
+          fieldGrid.cellColumn(blockedCell) + column,
+          fieldGrid.cellRow(blockedCell) + row));
+  for (unsigned int row = 140; row < 162; row++)
+    for (unsigned int column = 160; column < 164; column++)
+      globalCells.push_back(fieldGrid.cellIndex(column, row));
+  for (unsigned int row = 0; row < 20; row++)
+    for (unsigned int column = 160; column < 164; column++)
+      globalCells.push_back(fieldGrid.cellIndex(column, row));
+  const OccupancyGrid unchangedGrid = fieldGrid;
+  IncrementalGridPlanner incrementalPlanner;
+  for (const bool global : { false, true }) {
+    const std::vector<unsigned int> &changedCells =
+        global ? globalCells : localizedCells;
+    // Flip each changed cell of the unchanged map, and start from the
+    // search planned on it
+    auto changeMap = [&]() {
+      fieldGrid = unchangedGrid;
+      for (const unsigned int cell : changedCells)
+        fieldGrid.setOccupied(fieldGrid.cellColumn(cell),
+                              fieldGrid.cellRow(cell),
+                              !unchangedGrid.isOccupiedIndex(cell));
+      incrementalPlanner = plannedIncrementalPlanner;
+    };
+    const std::string change = global ? "global" : "localized";
+    results.push_back(runBenchmark("IncrementalGridPlanner::update/" + change,
+                                   repetitions, [&]() {
+      incrementalPlanner.update(changedCells, replannedCells);
+      return replannedCells.size();
+    }, changeMap));
+    results.push_back(runBenchmark("GridPlanner::plan/" + change, repetitions,
+                                   [&]() {
+      gridPlanner.plan(10, 10, 300, 150, replannedCells);
+      return replannedCells.size();
+    }, changeMap));
+  }
+  fieldGrid = unchangedGrid;
+
+//********************************************************************
+//     Sampling a spline path through four poses by distance
+//********************************************************************
+  Route splineRoute;
+  splineRoute.addPoseWayPoint(PoseWayPoint(0, 0, 0));
+  splineRoute.addPoseWayPoint(PoseWayPoint(6, 3, 45));
+  splineRoute.addPoseWayPoint(PoseWayPoint(12, 4, -20));
+  splineRoute.addPoseWayPoint(PoseWayPoint(18, 4, 0));
+  SplinePath splinePath;
+  splineRoute.planSplinePath(splinePath, 0.01);
+  const unsigned int splineSampleCount = 100000;
+  double splineXSum = 0.0;
+  results.push_back(runBenchmark("SplinePath::sample/100000", repetitions,
+                                 [&]() {
+    double x, y, heading, curvature;
+    for (unsigned int i = 0; i < splineSampleCount; i++) {
+      splinePath.sample(splinePath.getLengthFeet() * i / splineSampleCount, x,
+                        y, heading, curvature);
+      splineXSum += x;
+    }
+    return splineSampleCount;
+  }));
+  if (splineXSum == 0.0)
+    std::cerr << "SplinePath samples were all at x = 0" << std::endl;
+
+//********************************************************************
+//     Finding the nearest point of an indexed path: by scanning every
+//     point, by the tree search, and by walking from the last nearest
+//********************************************************************
+  std::vector<PoseWayPoint> indexedWayPoints = { PoseWayPoint(0, 0, 0),
+      PoseWayPoint(8, 4, 60), PoseWayPoint(14, 10, 0), PoseWayPoint(20, 4,
+                                                                    -90) };
+  SplinePath indexedSpline;
+  indexedSpline.generate(indexedWayPoints, 0.01);
+  PathIndex pathIndex;
+  pathIndex.build(indexedSpline, 0.005);
+  std::vector<double> queryX, queryY, trackX, trackY;
+  for (unsigned int i = 0; i < 1000; i++) {
+    queryX.push_back(-1 + 22.0 * ((i * 7919u) % 1000u) / 1000);
+    queryY.push_back(-2 + 14.0 * ((i * 104729u) % 1000u) / 1000);
+  }
+  for (unsigned int i = 0; i < pathIndex.size(); i += 3) {
+    trackX.push_back(pathIndex.getXFeet(i) + 0.1);
+    trackY.push_back(pathIndex.getYFeet(i) - 0.1);
+  }
+  unsigned int nearestChecksum = 0;
+  results.push_back(runBenchmark("PathIndex/scan", repetitions, [&]() {
+    for (unsigned int q = 0; q < queryX.size(); q++) {
+      unsigned int nearest = 0;
+      double nearestSquared = std::numeric_limits<double>::infinity();
+      for (unsigned int i = 0; i < pathIndex.size(); i++) {
+        const double dx = pathIndex.getXFeet(i) - queryX[q];
+        const double dy = pathIndex.getYFeet(i) - queryY[q];
+        if (dx * dx + dy * dy < nearestSquared) {
+          nearestSquared = dx * dx + dy * dy;
+          nearest = i;
+        }
+      }
+      nearestChecksum += nearest;
+    }
+    return queryX.size();
+  }));
+  results.push_back(runBenchmark("PathIndex::findNearest", repetitions,
+                                 [&]() {
+    for (unsigned int q = 0; q < queryX.size(); q++)
+      nearestChecksum += pathIndex.findNearest(queryX[q], queryY[q]);
+    return queryX.size();
+  }));
+  results.push_back(runBenchmark("PathIndex::findNearestFrom", repetitions,
+                                 [&]() {
+    unsigned int hint = 0;
+    for (unsigned int q = 0; q < trackX.size(); q++) {
+      hint = pathIndex.findNearestFrom(trackX[q], trackY[q], hint);
+      nearestChecksum += hint;
+    }
+    return trackX.size();
+  }));
+  if (nearestChecksum == 0)
+    std::cerr << "PathIndex queries all found point 0" << std::endl;
+
+//********************************************************************
+//     Pure pursuit ticks steering a chassis along a path (10 ms period)
+//********************************************************************
+  PurePursuitFollower pursuitFollower;
+  pursuitFollower.setPathIndex(pathIndex);
+  pursuitFollower.setLookaheadFeet(1.5);
+  pursuitFollower.setWidthInFeet(2.75);
+  results.push_back(runBenchmark("PurePursuitFollower::calculate", repetitions,
+                                 [&]() {
+    const double periodS = 0.01;
+    const double pi = std::acos(-1.0);
+    const ChassisVelocity velocity = ChassisVelocity::fromFeetPerSecond(3);
+    ChassisVelocity left, right;
+    double x = 0, y = -0.5, heading = 0;
+    unsigned int ticks = 0;
+    pursuitFollower.reset();
+    while (!pursuitFollower.isAtEnd() && ticks < 5000) {
+      pursuitFollower.calculate(x, y, heading * 180 / pi, velocity, left,
+                                right);
+      const double v = 0.5 * (left.getFeetPerSecond()
+          + right.getFeetPerSecond());
+      heading += (left.getFeetPerSecond() - right.getFeetPerSecond()) / 2.75
+          * periodS;
+      x += v * std::cos(heading) * periodS;
+      y += v * std::sin(heading) * periodS;
+      ticks++;
+    }
+    return ticks;
+  }));
+
+//********************************************************************
+//     Ordering 60 route locations (one worker, 50 perturbations)
+//********************************************************************
+  std::vector<PoseWayPoint> routeLocations;
+  unsigned int locationState = 12345;
+  auto nextLocationFeet = [&locationState](const double scale) {
+    locationState = locationState * 1103515245u + 12345u;
+    return (locationState >> 8) % 10000 / 10000.0 * scale;
+  };
+  for (unsigned int i = 0; i < 60; i++) {
+    const double x = nextLocationFeet(54);
+    routeLocations.push_back(PoseWayPoint(x, nextLocationFeet(27), 0));
+  }
+  RouteOptimizer routeOptimizer;
+  routeOptimizer.setMotionLimits(
+      ChassisVelocity::fromFeetPerSecond(12),
+      ChassisAcceleration::fromFeetPerSecondPerSecond(6));
+  routeOptimizer.setTimeBudgetMS(60000);
+  routeOptimizer.setMaxPerturbations(50);
+  routeOptimizer.setThreadCount(1);
+  std::vector<unsigned int> routeOrder;
+  results.push_back(runBenchmark("RouteOptimizer::optimize/60", repetitions,
+                                 [&]() {
+    routeOptimizer.optimize(routeLocations, routeOrder);
+    return routeOrder.size();
+  }));
+
+//********************************************************************
+//     Passing trajectory points from a producer thread to a consumer
+//********************************************************************
+  const unsigned int queuePointCount = 100000;
+  results.push_back(runBenchmark("TrajectoryPointQueue/100000", repetitions,
+                                 [&]() {
+    TrajectoryPointQueue queue(1024);
+    std::thread producer([&]() {
+      TrajectoryPoint point;
+      for (unsigned int step = 1; step <= queuePointCount; step++) {
+        point.setStep(step);
+        while (!queue.push(point))
+          std::this_thread::yield();
+      }
+      queue.close();
+    });
+    TrajectoryPoint point;
+    unsigned int received = 0;
+    while (!queue.isDrained()) {
+      if (queue.pop(point))
+        received++;
+      else
+        std::this_thread::yield();
+    }
+    producer.join();
+    return received;
+  }));
+
+//********************************************************************
+//     Planning a fleet of chassis, one 10 ft turning move each
+//********************************************************************
+  const unsigned int fleetSizes[] = { 1, 10, 100, 1000 };
+  for (const unsigned int fleetSize : fleetSizes) {
+    std::vector<Chassis> fleetChassis(fleetSize);
+    FleetPlanner fleetPlanner;
+    for (unsigned int c = 0; c < fleetSize; c++) {
+      TankDrive fleetDrive = tankDrive;
+      fleetDrive.setWidthInFeet(2.0 + 0.001 * c);
+      fleetChassis[c].setName(benchChassisName);
+      fleetChassis[c].setDriveSystem(fleetDrive);
+      fleetPlanner.addChassis(fleetChassis[c]);
+      fleetPlanner.addMove(c, 10, ChassisTurnRate::fromDegreesPerFoot(5),
+                           ChassisVelocity::fromFeetPerSecond(3),
+                           ChassisAcceleration::fromFeetPerSecondPerSecond(2));
+    }
+    std::ostringstream name;
+    name << "FleetPlanner::plan/" << fleetSize;
+    results.push_back(runBenchmark(name.str(), repetitions, [&]() {
+      fleetPlanner.plan();
+      unsigned int points = 0;
+      for (unsigned int c = 0; c < fleetSize; c++)
+        points += fleetPlanner.getLeftTrajectory(c, 0)->size()
+            + fleetPlanner.getRightTrajectory(c, 0)->size();
+      return points;
+    }));
+  }
+
+  if (outputFileName.empty()) {
+    writeJSON(std::cout, repetitions, results);
+  } else {
+    std::ofstream outputFile(outputFileName);
+    if (!outputFile) {
+      std::cerr << "Cannot write " << outputFileName << std::endl;
+      return 1;
+    }
+    writeJSON(outputFile, repetitions, results);
+  }
+  return 0;
+}
@@ -4,6 +4,10 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 14, 2017 - Creation
+ * @date Oct 19, 2026 - Added a move queue with lookahead trajectory generation
+ * @date Oct 19, 2026 - Drive system returned by reference; moves can be planned without output
+ * @date Oct 19, 2026 - Const-correct; name set by move; const drive system access
+ * @date Oct 19, 2026 - Move queue stops generation and joins its thread if a move fails
  *
  * @brief A Chassis has a DriveSystem and a name, and can move using the Motion Control System Framework
  *
@@ -18,12 +22,21 @@
  * comma-separated value files for the trajectories, named with the chassis name as the leading
  * element of the CSV file name.
  *
+ * A sequence of moves can also be queued and then run as a pipeline: a background thread
+ * generates the trajectories for up to two moves ahead of the move being executed, handing
+ * them over through a fixed set of trajectory buffers, so consecutive moves are not
+ * separated by trajectory generation time.
+ *
  */
 #include "Chassis.hpp"
 
 Chassis::Chassis()
     : myName(""),
-      myDrive() {
+      myDrive(),
+      moveQueue(),
+      leftMoveBuffers(moveLookahead + 1),
+      rightMoveBuffers(moveLookahead + 1),
+      generationStallCount(0) {
 }
 
 Chassis::~Chassis() {
@@ -34,7 +47,7 @@ Chassis::~Chassis() {
  * @param [in] string name of the chassis
  */
 void Chassis::setName(std::string name) {
-  myName = name;
+  myName = std::move(name);
 //  if (myDrive)
 //    myDrive->setChassisName(myName); // Not working - 2017-03-14
   myDrive.setChassisName(myName);
@@ -45,7 +58,7 @@ void Chassis::setName(std::string name) {
  * @brief Get the chassis name
  * @return string name of the chassis
  */
-std::string Chassis::getName() {
+const std::string &Chassis::getName() const {
   return myName;
 }
 
@@ -75,7 +88,19 @@ void Chassis::setDriveSystem(const TankDrive &driveSystem) {
   return;
 }
 
-TankDrive Chassis::getDriveSystem() {
+/**
+ * @brief Gets the chassis's drive system, without copying it
+ * @return TankDrive myDrive - the chassis's own drive system
+ */
+TankDrive &Chassis::getDriveSystem() {
+  return myDrive;
+}
+
+/**
+ * @brief Gets the chassis's drive system, without copying it, for inspection only
+ * @return TankDrive myDrive - the chassis's own drive system (read-only)
+ */
+const TankDrive &Chassis::getDriveSystem() const {
   return myDrive;
 }
 
@@ -97,3 +122,175 @@ void Chassis::move(double distanceFeet, ChassisTurnRate chassisTurnRate,
 
   return;
 }
+
+/**
+ * @brief Use the DriveSystem to generate the trajectories for a move, without executing them
+ * or writing any output
+ * @param [in] double distanceFeet to move the chassis
+ * @param [in] ChassisTurnrate chassisTurnRate (0 for straight, < 0 for left turn, > 0 for right turn)
+ * @param [in] ChassisVelocity chassisVelocityRequested (actual movement constrained by drive system)
+ * @param [in] ChassisAcceleration chassisAccelerationRequested (actual movement constrained by drive system)
+ * @param [out] Trajectory leftTrajectory for the left side of the drive system
+ * @param [out] Trajectory rightTrajectory for the right side of the drive system
+ */
+void Chassis::generateMove(double distanceFeet,
+                           ChassisTurnRate chassisTurnRate,
+                           ChassisVelocity chassisVelocityRequested,
+                           ChassisAcceleration chassisAccelerationRequested,
+                           Trajectory &leftTrajectory,
+                           Trajectory &rightTrajectory) const {
+  myDrive.generateTrajectories(distanceFeet, chassisTurnRate,
+                               chassisVelocityRequested,
+                               chassisAccelerationRequested, leftTrajectory,
+                               rightTrajectory);
+  return;
+}
+
+/**
+ * @brief Add a move to the end of the chassis move queue
+ * @param [in] double distanceFeet to move the chassis
+ * @param [in] ChassisTurnrate chassisTurnRate (0 for straight, < 0 for left turn, > 0 for right turn)
+ * @param [in] ChassisVelocity chassisVelocityRequested (actual movement constrained by drive system)
+ * @param [in] ChassisAcceleration chassisAccelerationRequested (actual movement constrained by drive system)
+ */
+void Chassis::queueMove(double distanceFeet, ChassisTurnRate chassisTurnRate,
+                        ChassisVelocity chassisVelocityRequested,
+                        ChassisAcceleration chassisAccelerationRequested) {
+  QueuedMove queuedMove;
+  queuedMove.distanceFeet = distanceFeet;
+  queuedMove.turnRate = chassisTurnRate;
+  queuedMove.velocity = chassisVelocityRequested;
+  queuedMove.acceleration = chassisAccelerationRequested;
+  moveQueue.push_back(queuedMove);
+  return;
+}
+
+/**
+ * @brief Get the number of moves waiting in the chassis move queue
+ * @return unsigned int number of queued moves
+ */
+unsigned int Chassis::getQueuedMoveCount() const {
+  return moveQueue.size();
+}
+
+/**
+ * @brief Remove all moves from the chassis move queue
+ */
+void Chassis::clearMoveQueue() {
+  moveQueue.clear();
+  return;
+}
+
+/**
+ * @brief Run all of the queued moves in order, generating ahead of execution
+ *
+ * A generation thread fills the trajectory buffers for the moves following
+ * the move being executed (up to moveLookahead moves ahead), while this
+ * thread executes each move as soon as its trajectories are ready.  A
+ * buffer is only re-used for generation once the move it holds has been
+ * executed.  The move queue is empty when this method returns, unless
+ * executing a move throws; generation is then stopped, and the exception
+ * is passed on with the queue left as it was.
+ */
+void Chassis::runMoveQueue() {
+  const unsigned int bufferCount = leftMoveBuffers.size();
+  const unsigned int moveCount = moveQueue.size();
+  unsigned int generatedCount = 0;  // moves with trajectories ready
+  unsigned int executedCount = 0;   // moves executed (buffers released)
+  bool cancelled = false;           // execution failed, stop generating
+  std::mutex pipelineMutex;
+  std::condition_variable pipelineChanged;
+
+  generationStallCount = 0;
+
+  // Generate the trajectories for each move into the next free buffer
+  std::thread generator([&]() {
+    for (unsigned int move = 0; move < moveCount; move++) {
+      // Wait until the buffer for this move has been released by execution
+      {
+        std::unique_lock<std::mutex> lock(pipelineMutex);
+        pipelineChanged.wait(lock, [&]() {
+          return cancelled || move < executedCount + bufferCount;
+        });
+        if (cancelled)
+          return;
+      }
+      const QueuedMove &queuedMove = moveQueue[move];
+      myDrive.generateTrajectories(queuedMove.distanceFeet,
+                                   queuedMove.turnRate, queuedMove.velocity,
+                                   queuedMove.acceleration,
+                                   leftMoveBuffers[move % bufferCount],
+                                   rightMoveBuffers[move % bufferCount]);
+      // Hand the generated move over to execution
+      {
+        std::lock_guard<std::mutex> lock(pipelineMutex);
+        generatedCount = move + 1;
+      }
+      pipelineChanged.notify_all();
+    }
+  });
+
+  // Execute each move as soon as its trajectories have been generated
+  try {
+    for (unsigned int move = 0; move < moveCount; move++) {
+      {
+        std::unique_lock<std::mutex> lock(pipelineMutex);
+        // Any wait after the first move is a gap caused by generation time
+        if (move > 0 && generatedCount <= move)
+          generationStallCount++;
+        pipelineChanged.wait(lock, [&]() {
+          return generatedCount > move;
+        });
+      }
+      executeMove(leftMoveBuffers[move % bufferCount],
+                  rightMoveBuffers[move % bufferCount]);
+      // Release this move's buffer back to generation
+      {
+        std::lock_guard<std::mutex> lock(pipelineMutex);
+        executedCount = move + 1;
+      }
+      pipelineChanged.notify_all();
+    }
+  } catch (...) {
+    // Stop the generation thread (it may be waiting for a buffer) and join
+    // it before passing the failure on; the queued moves are left in place
+    {
+      std::lock_guard<std::mutex> lock(pipelineMutex);
+      cancelled = true;
+    }
+    pipelineChanged.notify_all();
+    generator.join();
+    throw;
+  }
+
+  generator.join();
+  moveQueue.clear();
+  return;
+}
+
+/**
+ * @brief Get the number of queued moves whose execution had to wait for generation
+ * @return unsigned int count of generation stalls in the last run of the move queue
+ */
+unsigned int Chassis::getGenerationStallCount() const {
+  return generationStallCount;
+}
+
+/**
+ * @brief Execute one move's left and right trajectories simultaneously
+ *
+ * Without drive hardware the trajectories are executed in real time on
+ * simulated motors; derived classes redefine this to drive real motors.
+ *
+ * @param [in] Trajectory leftTrajectory for the left side of the drive system
+ * @param [in] Trajectory rightTrajectory for the right side of the drive system
+ */
+void Chassis::executeMove(const Trajectory &leftTrajectory,
+                          const Trajectory &rightTrajectory) {
+  SimulatedMotor leftMotor, rightMotor;
+  TrajectoryExecutor executor;
+  executor.addTrajectory(leftTrajectory, leftMotor);
+  executor.addTrajectory(rightTrajectory, rightMotor);
+  executor.execute();
+  return;
+}
@@ -4,6 +4,10 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 14, 2017 - Creation
+ * @date Oct 19, 2026 - Added a move queue with lookahead trajectory generation
+ * @date Oct 19, 2026 - Drive system returned by reference; moves can be planned without output
+ * @date Oct 19, 2026 - Const-correct; name set by move; const drive system access
+ * @date Oct 19, 2026 - Move parameters made public for reuse by the fleet planner
  *
  * @brief A Chassis has a DriveSystem and a name, and can move using the Motion Control System Framework
  *
@@ -18,39 +22,82 @@
  * comma-separated value files for the trajectories, named with the chassis name as the leading
  * element of the CSV file name.
  *
+ * A sequence of moves can also be queued and then run as a pipeline: a background thread
+ * generates the trajectories for up to two moves ahead of the move being executed, handing
+ * them over through a fixed set of trajectory buffers, so consecutive moves are not
+ * separated by trajectory generation time.
+ *
  */
 #ifndef CHASSIS_HPP_
 #define CHASSIS_HPP_
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 #include "ChassisAcceleration.hpp"
 #include "ChassisTurnRate.hpp"
 #include "ChassisVelocity.hpp"
+#include "SimulatedMotor.hpp"
 #include "DriveSystem.hpp"
 #include "TankDrive.hpp"
+#include "Trajectory.hpp"
+#include "TrajectoryExecutor.hpp"
 
 /** @brief A Chassis has a DriveSystem and a name, and can move using the Motion Control System Framework
  */
 
 class Chassis {
  public:
+  // The parameters of a move to be made (queued or planned)
+  struct QueuedMove {
+    double distanceFeet;
+    ChassisTurnRate turnRate;
+    ChassisVelocity velocity;
+    ChassisAcceleration acceleration;
+  };
   Chassis();
   virtual ~Chassis();
   void setName(std::string name);
-  std::string getName();
+  const std::string &getName() const;
 //  void setDriveSystem(std::shared_ptr<DriveSystem> driveSystem);
 //  std::shared_ptr<DriveSystem> getDriveSystem(); // Not working 2017-03-14
   void setDriveSystem(const TankDrive &driveSystem);
-  TankDrive getDriveSystem();
+  TankDrive &getDriveSystem();
+  const TankDrive &getDriveSystem() const;
+  void generateMove(double distanceFeet, ChassisTurnRate chassisTurnRate,
+                    ChassisVelocity chassisVelocityRequested,
+                    ChassisAcceleration chassisAccelerationRequested,
+                    Trajectory &leftTrajectory, Trajectory &rightTrajectory) const;
   void move(double distanceFeet, ChassisTurnRate chassisTurnRate,
             ChassisVelocity chassisVelocityRequested,
             ChassisAcceleration chassisAccelerationRequested);
+  void queueMove(double distanceFeet, ChassisTurnRate chassisTurnRate,
+                 ChassisVelocity chassisVelocityRequested,
+                 ChassisAcceleration chassisAccelerationRequested);
+  unsigned int getQueuedMoveCount() const;
+  void clearMoveQueue();
+  void runMoveQueue();
+  unsigned int getGenerationStallCount() const;
+
+ protected:
+  virtual void executeMove(const Trajectory &leftTrajectory,
+                           const Trajectory &rightTrajectory);
 
  private:
+  // The number of moves generated ahead of the move being executed
+  static const unsigned int moveLookahead = 2;
+
   std::string myName;
 //  std::shared_ptr<DriveSystem> myDrive; // Not working - MRJ 2017-03-14
   TankDrive myDrive;
+  std::vector<QueuedMove> moveQueue;
+  std::vector<Trajectory> leftMoveBuffers;   // one buffer per move in flight
+  std::vector<Trajectory> rightMoveBuffers;  // one buffer per move in flight
+  unsigned int generationStallCount;  // executions that waited on generation
 };
 
 #endif /* CHASSIS_HPP_ */
@@ -4,6 +4,7 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 13, 2017 - Creation
+ * @date Oct 19, 2026 - Made header-only, constexpr and trivially copyable
  *
  * @brief A class to define a strict type for chassis accelerations
  *
@@ -17,18 +18,51 @@
 #ifndef CHASSISACCELERATION_HPP_
 #define CHASSISACCELERATION_HPP_
 
+#include <type_traits>
+
 /** @brief Defines a strict type for chassis accelerations
  */
 
 class ChassisAcceleration {
  public:
-  ChassisAcceleration();
-  virtual ~ChassisAcceleration();
-  void setFeetPerSecondPerSecond(double rate);
-  double getFeetPerSecondPerSecond();
+  constexpr ChassisAcceleration()
+      : accelAsFeetPerSecondPerSecond(0.0) {
+  }
+
+  /**
+   * @brief Make a chassis acceleration from a value in feet per second per second
+   * @param [in] double rate in units of feet per second per second
+   * @return ChassisAcceleration holding that acceleration
+   */
+  static constexpr ChassisAcceleration fromFeetPerSecondPerSecond(
+      const double rate) {
+    return ChassisAcceleration(rate);
+  }
+
+  /**
+   * @brief Set the chassis acceleration in units of feet per second per second
+   * @param [in] double acceleration (in units of feet per second per second)
+   */
+  constexpr void setFeetPerSecondPerSecond(const double rate) {
+    accelAsFeetPerSecondPerSecond = rate;
+  }
+
+  /**
+   * @brief Get the chassis acceleration in units of feet per second per second
+   * @return double acceleration in units of feet per second per second
+   */
+  constexpr double getFeetPerSecondPerSecond() const {
+    return accelAsFeetPerSecondPerSecond;
+  }
 
  private:
+  constexpr explicit ChassisAcceleration(const double rate)
+      : accelAsFeetPerSecondPerSecond(rate) {
+  }
   double accelAsFeetPerSecondPerSecond;
 };
 
+static_assert(std::is_trivially_copyable<ChassisAcceleration>::value,
+              "ChassisAcceleration must be trivially copyable");
+
 #endif /* CHASSISACCELERATION_HPP_ */
@@ -4,6 +4,7 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 13, 2017 - Creation
+ * @date Oct 19, 2026 - Made header-only, constexpr and trivially copyable
  *
  * @brief ChassisTurnRate is a strictly defined type for specifying the turn rate of a moving chassis
  *
@@ -18,19 +19,51 @@
 #ifndef CHASSISTURNRATE_HPP_
 #define CHASSISTURNRATE_HPP_
 
+#include <type_traits>
+
 /** @brief ChassisTurnRate objects are used to specify a change in direction when a chassis is moving.
  */
 
 class ChassisTurnRate {
  public:
-  ChassisTurnRate();
-  virtual ~ChassisTurnRate();
-  void setDegreesPerFoot(double degrees);
-  double getDegreesPerFoot();
+  constexpr ChassisTurnRate()
+      : degreesPerFoot(0.0) {
+  }
+
+  /**
+   * @brief Make a chassis turn rate from a value in degrees per foot
+   * @param [in] double degrees of turn per foot of movement
+   * @return ChassisTurnRate holding that turn rate
+   */
+  static constexpr ChassisTurnRate fromDegreesPerFoot(const double degrees) {
+    return ChassisTurnRate(degrees);
+  }
+
+  /**
+   * @brief Set the turn rate in degrees per foot of movement
+   * @param [in] double degrees of turn per foot (0 is straight, < 0 is left, > 0 is right)
+   */
+  constexpr void setDegreesPerFoot(const double degrees) {
+    degreesPerFoot = degrees;
+  }
+
+  /**
+   * @brief Get the turn rate in degrees per foot of movement
+   * @return double degrees of turn per foot (0 is straight, < 0 is left, > 0 is right)
+   */
+  constexpr double getDegreesPerFoot() const {
+    return degreesPerFoot;
+  }
 
  private:
+  constexpr explicit ChassisTurnRate(const double degrees)
+      : degreesPerFoot(degrees) {
+  }
   double degreesPerFoot;  // 0 indicates straight movement, negative indicates
                           // left turn, positive indicates right turn
 };
 
+static_assert(std::is_trivially_copyable<ChassisTurnRate>::value,
+              "ChassisTurnRate must be trivially copyable");
+
 #endif /* CHASSISTURNRATE_HPP_ */
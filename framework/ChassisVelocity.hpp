@@ -4,6 +4,7 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 13, 2017 - Creation
+ * @date Oct 19, 2026 - Made header-only, constexpr and trivially copyable
  *
  * @brief A class to define a strict type for chassis velocities
  *
@@ -16,18 +17,50 @@
 #ifndef CHASSISVELOCITY_HPP_
 #define CHASSISVELOCITY_HPP_
 
+#include <type_traits>
+
 /** @brief A strictly defined type for chassis velocities
  */
 
 class ChassisVelocity {
  public:
-  ChassisVelocity();
-  virtual ~ChassisVelocity();
-  void setFeetPerSecond(double rate);
-  double getFeetPerSecond();
+  constexpr ChassisVelocity()
+      : velAsFeetPerSecond(0.0) {
+  }
+
+  /**
+   * @brief Make a chassis velocity from a value in feet per second
+   * @param [in] double rate in units of feet per second
+   * @return ChassisVelocity holding that velocity
+   */
+  static constexpr ChassisVelocity fromFeetPerSecond(const double rate) {
+    return ChassisVelocity(rate);
+  }
+
+  /**
+   * @brief Set the chassis velocity in units of feet per second
+   * @param [in] double velocity (in units of feet per second)
+   */
+  constexpr void setFeetPerSecond(const double rate) {
+    velAsFeetPerSecond = rate;
+  }
+
+  /**
+   * @brief Get the chassis velocity in units of feet per second
+   * @return double velocity in units of feet per second
+   */
+  constexpr double getFeetPerSecond() const {
+    return velAsFeetPerSecond;
+  }
 
  private:
+  constexpr explicit ChassisVelocity(const double rate)
+      : velAsFeetPerSecond(rate) {
+  }
   double velAsFeetPerSecond;
 };
 
+static_assert(std::is_trivially_copyable<ChassisVelocity>::value,
+              "ChassisVelocity must be trivially copyable");
+
 #endif /* CHASSISVELOCITY_HPP_ */
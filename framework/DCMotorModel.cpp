@@ -0,0 +1,157 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file DCMotorModel.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief A simple dynamic model of a velocity-commanded DC motor
+ *
+ * A DC motor driven with a voltage proportional to a commanded velocity does not reach the
+ * commanded velocity instantly; its velocity approaches the commanded velocity with a first
+ * order response characterized by a time constant.  The motor can never exceed its free speed,
+ * and its acceleration is limited by the torque it can produce.  The model is advanced in
+ * fixed time steps, tracking the motor's velocity and position (in rotations).
+ *
+ */
+#include "DCMotorModel.hpp"
+
+DCMotorModel::DCMotorModel()
+    : timeConstantS(0.0),
+      freeSpeedRPS(0.0),
+      maxAccelerationRPSpS(0.0),
+      commandedVelocityRPS(0.0),
+      velocityRPS(0.0),
+      positionRot(0.0) {
+}
+
+DCMotorModel::~DCMotorModel() {
+}
+
+/**
+ * @brief Set the time constant of the motor's first order velocity response
+ * @param [in] double seconds time constant (0 for an instant response)
+ */
+void DCMotorModel::setTimeConstantS(const double seconds) {
+  timeConstantS = seconds;
+  return;
+}
+
+/**
+ * @brief Get the time constant of the motor's first order velocity response
+ * @return double time constant in seconds
+ */
+double DCMotorModel::getTimeConstantS() const {
+  return timeConstantS;
+}
+
+/**
+ * @brief Set the free speed of the motor, which its velocity can never exceed
+ * @param [in] MotorVelocity speed (0 for unlimited)
+ */
+void DCMotorModel::setFreeSpeed(const MotorVelocity &speed) {
+  MotorVelocity freeSpeed = speed;
+  freeSpeedRPS = freeSpeed.getRotationsPerMinute() / 60;
+  return;
+}
+
+/**
+ * @brief Get the free speed of the motor
+ * @return MotorVelocity free speed (0 for unlimited)
+ */
+MotorVelocity DCMotorModel::getFreeSpeed() const {
+  MotorVelocity freeSpeed;
+  freeSpeed.setRotationsPerMinute(freeSpeedRPS * 60);
+  return freeSpeed;
+}
+
+/**
+ * @brief Set the maximum acceleration the motor's torque can produce
+ * @param [in] MotorAcceleration acceleration (0 for unlimited)
+ */
+void DCMotorModel::setMaxAcceleration(const MotorAcceleration &acceleration) {
+  MotorAcceleration maxAcceleration = acceleration;
+  maxAccelerationRPSpS = maxAcceleration.getRotationsPerMinutePerSecond() / 60;
+  return;
+}
+
+/**
+ * @brief Get the maximum acceleration the motor's torque can produce
+ * @return MotorAcceleration maximum acceleration (0 for unlimited)
+ */
+MotorAcceleration DCMotorModel::getMaxAcceleration() const {
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(maxAccelerationRPSpS * 60);
+  return maxAcceleration;
+}
+
+/**
+ * @brief Set the velocity the motor is being driven toward
+ * @param [in] MotorVelocity velocity commanded
+ */
+void DCMotorModel::setCommandedVelocity(const MotorVelocity &velocity) {
+  MotorVelocity commandedVelocity = velocity;
+  commandedVelocityRPS = commandedVelocity.getRotationsPerMinute() / 60;
+  return;
+}
+
+/**
+ * @brief Return the motor to rest at position 0 with no commanded velocity
+ */
+void DCMotorModel::reset() {
+  commandedVelocityRPS = 0.0;
+  velocityRPS = 0.0;
+  positionRot = 0.0;
+  return;
+}
+
+/**
+ * @brief Advance the motor model by one time step
+ * @param [in] double stepS duration of the time step in seconds
+ */
+void DCMotorModel::step(const double stepS) {
+  // Calculate the first order response toward the commanded velocity; the
+  // exact exponential response is used so that large steps stay stable
+  double targetVelocityRPS = commandedVelocityRPS;
+  if (freeSpeedRPS > 0)
+    targetVelocityRPS = std::max(-freeSpeedRPS,
+                                 std::min(targetVelocityRPS, freeSpeedRPS));
+  double newVelocityRPS = targetVelocityRPS;
+  if (timeConstantS > 0)
+    newVelocityRPS = targetVelocityRPS
+        + (velocityRPS - targetVelocityRPS) * std::exp(-stepS / timeConstantS);
+
+  // Limit the change in velocity to what the motor's torque can produce
+  if (maxAccelerationRPSpS > 0) {
+    double maxChangeRPS = maxAccelerationRPSpS * stepS;
+    newVelocityRPS = std::max(velocityRPS - maxChangeRPS,
+                              std::min(newVelocityRPS,
+                                       velocityRPS + maxChangeRPS));
+  }
+
+  // Advance the position by the average velocity over the step
+  positionRot += (velocityRPS + newVelocityRPS) / 2 * stepS;
+  velocityRPS = newVelocityRPS;
+  return;
+}
+
+/**
+ * @brief Get the current position of the motor
+ * @return MotorPosition current position
+ */
+MotorPosition DCMotorModel::getPosition() const {
+  MotorPosition position;
+  position.setRotations(positionRot);
+  return position;
+}
+
+/**
+ * @brief Get the current velocity of the motor
+ * @return MotorVelocity current velocity
+ */
+MotorVelocity DCMotorModel::getVelocity() const {
+  MotorVelocity velocity;
+  velocity.setRotationsPerMinute(velocityRPS * 60);
+  return velocity;
+}
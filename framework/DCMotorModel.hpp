@@ -0,0 +1,55 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file DCMotorModel.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief A simple dynamic model of a velocity-commanded DC motor
+ *
+ * A DC motor driven with a voltage proportional to a commanded velocity does not reach the
+ * commanded velocity instantly; its velocity approaches the commanded velocity with a first
+ * order response characterized by a time constant.  The motor can never exceed its free speed,
+ * and its acceleration is limited by the torque it can produce.  The model is advanced in
+ * fixed time steps, tracking the motor's velocity and position (in rotations).
+ *
+ */
+#ifndef DCMOTORMODEL_HPP_
+#define DCMOTORMODEL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include "MotorAcceleration.hpp"
+#include "MotorPosition.hpp"
+#include "MotorVelocity.hpp"
+
+/** @brief A first-order, velocity and acceleration limited DC motor model
+ */
+
+class DCMotorModel {
+ public:
+  DCMotorModel();
+  virtual ~DCMotorModel();
+  void setTimeConstantS(const double seconds);
+  double getTimeConstantS() const;
+  void setFreeSpeed(const MotorVelocity &speed);
+  MotorVelocity getFreeSpeed() const;
+  void setMaxAcceleration(const MotorAcceleration &acceleration);
+  MotorAcceleration getMaxAcceleration() const;
+  void setCommandedVelocity(const MotorVelocity &velocity);
+  void reset();
+  void step(const double stepS);
+  MotorPosition getPosition() const;
+  MotorVelocity getVelocity() const;
+
+ private:
+  double timeConstantS;        // first order response time constant
+  double freeSpeedRPS;         // maximum speed (0 for unlimited)
+  double maxAccelerationRPSpS;  // maximum acceleration (0 for unlimited)
+  double commandedVelocityRPS;  // velocity the motor is driven toward
+  double velocityRPS;           // current motor velocity
+  double positionRot;           // current motor position
+};
+
+#endif /* DCMOTORMODEL_HPP_ */
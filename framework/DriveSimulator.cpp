@@ -0,0 +1,386 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file DriveSimulator.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Moves the chassis with the odometry arc step
+ * @date Oct 19, 2026 - Configures from a const TankDrive
+ *
+ * @brief Faster-than-real-time simulation of a differential (tank) drive chassis
+ *
+ * The drive simulator models a differential drive chassis as two DC motor models (left and
+ * right) separated by the drive width.  Given the left and right trajectories generated for a
+ * move, it drives each motor model with the commanded trajectory velocity and integrates the
+ * motor and chassis dynamics at a fixed simulation rate.  It normally runs as fast as the CPU
+ * allows, so that a full autonomous period can be simulated in milliseconds; an optional
+ * real-time pacing mode sleeps between simulation steps so the simulation runs on the wall
+ * clock.  After a simulation, the chassis pose (relative to its starting pose), the final motor
+ * positions, and the worst tracking error of each side are available.
+ *
+ * The chassis pose uses the same conventions as ChassisTurnRate: x is along the starting
+ * heading, y is to the right of the starting heading, and a positive heading is a turn to the
+ * right.
+ *
+ */
+#include <errno.h>
+#include <time.h>
+#include <algorithm>
+#include <cmath>
+#include "DriveSimulator.hpp"
+#include "Odometry.hpp"
+
+DriveSimulator::DriveSimulator()
+    : leftMotor(),
+      rightMotor(),
+      motorRotPerMovementFoot(0.0),
+      widthInFeet(0.0),
+      simulationRateHz(1000),
+      settleTimeS(0.5),
+      realTimePacing(false),
+      xFeet(0.0),
+      yFeet(0.0),
+      headingRadians(0.0),
+      maxLeftTrackingErrorRot(0.0),
+      maxRightTrackingErrorRot(0.0),
+      simulatedTimeS(0.0),
+      stepCount(0) {
+}
+
+DriveSimulator::~DriveSimulator() {
+}
+
+/**
+ * @brief Take the drive geometry (motor rotations per foot and width) from a TankDrive
+ * @param [in] TankDrive tankDrive whose geometry is to be simulated
+ */
+void DriveSimulator::configureFromTankDrive(const TankDrive &tankDrive) {
+  motorRotPerMovementFoot = tankDrive.getMotorRotPerMovementFoot();
+  widthInFeet = tankDrive.getWidthInFeet();
+  return;
+}
+
+/**
+ * @brief Set the motor model used for both the left and right motors
+ * @param [in] DCMotorModel motorModel with the desired motor characteristics
+ */
+void DriveSimulator::setMotorModel(const DCMotorModel &motorModel) {
+  leftMotor = motorModel;
+  rightMotor = motorModel;
+  return;
+}
+
+/**
+ * @brief Set the motor rotations needed to move the chassis one foot
+ * @param [in] double rotations per foot of movement
+ */
+void DriveSimulator::setMotorRotPerMovementFoot(const double rotations) {
+  motorRotPerMovementFoot = rotations;
+  return;
+}
+
+/**
+ * @brief Get the motor rotations needed to move the chassis one foot
+ * @return double rotations per foot of movement
+ */
+double DriveSimulator::getMotorRotPerMovementFoot() const {
+  return motorRotPerMovementFoot;
+}
+
+/**
+ * @brief Set the distance between the left and right sides of the drive
+ * @param [in] double width in feet
+ */
+void DriveSimulator::setWidthInFeet(const double width) {
+  widthInFeet = width;
+  return;
+}
+
+/**
+ * @brief Get the distance between the left and right sides of the drive
+ * @return double width in feet
+ */
+double DriveSimulator::getWidthInFeet() const {
+  return widthInFeet;
+}
+
+/**
+ * @brief Set the rate at which the motor and chassis dynamics are integrated
+ * @param [in] unsigned int rate in simulation steps per simulated second
+ */
+void DriveSimulator::setSimulationRateHz(const unsigned int rate) {
+  simulationRateHz = rate;
+  return;
+}
+
+/**
+ * @brief Get the rate at which the motor and chassis dynamics are integrated
+ * @return unsigned int rate in simulation steps per simulated second
+ */
+unsigned int DriveSimulator::getSimulationRateHz() const {
+  return simulationRateHz;
+}
+
+/**
+ * @brief Set how long to keep simulating after the trajectories end, letting the motors settle
+ * @param [in] double seconds of settle time
+ */
+void DriveSimulator::setSettleTimeS(const double seconds) {
+  settleTimeS = seconds;
+  return;
+}
+
+/**
+ * @brief Get how long simulation continues after the trajectories end
+ * @return double seconds of settle time
+ */
+double DriveSimulator::getSettleTimeS() const {
+  return settleTimeS;
+}
+
+/**
+ * @brief Set whether simulation steps are paced to the wall clock
+ * @param [in] bool pacing true to run in real time, false to run as fast as possible
+ */
+void DriveSimulator::setRealTimePacing(const bool pacing) {
+  realTimePacing = pacing;
+  return;
+}
+
+/**
+ * @brief Get whether simulation steps are paced to the wall clock
+ * @return bool true if running in real time
+ */
+bool DriveSimulator::getRealTimePacing() const {
+  return realTimePacing;
+}
+
+/**
+ * @brief Simulate the chassis following a pair of left and right trajectories
+ *
+ * The chassis starts at rest at the origin with a heading of 0.  Each simulation step commands
+ * each motor with its trajectory's velocity (interpolated between trajectory points), advances
+ * the motor models, and moves the chassis by the arc described by the motor position changes.
+ *
+ * @param [in] Trajectory leftTrajectory to be followed by the left motor
+ * @param [in] Trajectory rightTrajectory to be followed by the right motor
+ */
+void DriveSimulator::simulate(const Trajectory &leftTrajectory,
+                              const Trajectory &rightTrajectory) {
+  // Start from rest at the origin
+  leftMotor.reset();
+  rightMotor.reset();
+  xFeet = 0.0;
+  yFeet = 0.0;
+  headingRadians = 0.0;
+  maxLeftTrackingErrorRot = 0.0;
+  maxRightTrackingErrorRot = 0.0;
+  simulatedTimeS = 0.0;
+  stepCount = 0;
+  if (simulationRateHz == 0 || motorRotPerMovementFoot == 0)
+    return;
+
+  // Simulate until both trajectories have ended and the motors have settled
+  double leftEndS = leftTrajectory.size() == 0 ? 0.0 :
+      (leftTrajectory.size() - 1) * leftTrajectory.getAlgoItPMS() / 1000.0;
+  double rightEndS = rightTrajectory.size() == 0 ? 0.0 :
+      (rightTrajectory.size() - 1) * rightTrajectory.getAlgoItPMS() / 1000.0;
+  unsigned long totalSteps = static_cast<unsigned long>(std::ceil(
+      (std::max(leftEndS, rightEndS) + settleTimeS) * simulationRateHz));
+  double stepS = 1.0 / simulationRateHz;
+  long stepNS = 1000000000L / simulationRateHz;
+
+  timespec release;
+  if (realTimePacing)
+    clock_gettime(CLOCK_MONOTONIC, &release);
+
+  double leftLastRot = 0.0;
+  double rightLastRot = 0.0;
+  MotorVelocity commandedVelocity;
+  for (stepCount = 0; stepCount < totalSteps;) {
+    // Drive each motor toward its trajectory velocity at the end of the step
+    // (an ideal motor then follows the trajectory exactly)
+    double stepEndS = (stepCount + 1) * stepS;
+    commandedVelocity.setRotationsPerMinute(
+        commandedVelocityRPM(leftTrajectory, stepEndS));
+    leftMotor.setCommandedVelocity(commandedVelocity);
+    commandedVelocity.setRotationsPerMinute(
+        commandedVelocityRPM(rightTrajectory, stepEndS));
+    rightMotor.setCommandedVelocity(commandedVelocity);
+
+    // Advance the motors
+    leftMotor.step(stepS);
+    rightMotor.step(stepS);
+    stepCount++;
+    simulatedTimeS = stepEndS;
+
+    // Move the chassis along the arc described by the change in each side's
+    // position; the heading changes by the difference of the sides over the
+    // width
+    double leftRot = leftMotor.getPosition().getRotations();
+    double rightRot = rightMotor.getPosition().getRotations();
+    double leftFeet = (leftRot - leftLastRot) / motorRotPerMovementFoot;
+    double rightFeet = (rightRot - rightLastRot) / motorRotPerMovementFoot;
+    leftLastRot = leftRot;
+    rightLastRot = rightRot;
+    double arcFeet = (leftFeet + rightFeet) / 2;
+    double headingChange = 0.0;
+    if (widthInFeet > 0)
+      headingChange = (leftFeet - rightFeet) / widthInFeet;
+    double dxFeet, dyFeet;
+    Odometry::arcDisplacement(arcFeet, headingChange, headingRadians, dxFeet,
+                              dyFeet);
+    xFeet += dxFeet;
+    yFeet += dyFeet;
+    headingRadians += headingChange;
+
+    // Track the worst difference between commanded and simulated positions
+    maxLeftTrackingErrorRot = std::max(
+        maxLeftTrackingErrorRot,
+        std::fabs(commandedPositionRot(leftTrajectory, simulatedTimeS)
+                  - leftRot));
+    maxRightTrackingErrorRot = std::max(
+        maxRightTrackingErrorRot,
+        std::fabs(commandedPositionRot(rightTrajectory, simulatedTimeS)
+                  - rightRot));
+
+    // In real-time mode, wait until the wall clock catches up
+    if (realTimePacing) {
+      release.tv_nsec += stepNS;
+      while (release.tv_nsec >= 1000000000L) {
+        release.tv_nsec -= 1000000000L;
+        release.tv_sec++;
+      }
+      while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &release, nullptr)
+          == EINTR) {
+      }
+    }
+  }
+  return;
+}
+
+/**
+ * @brief Get the simulated chassis position along the starting heading
+ * @return double x in feet
+ */
+double DriveSimulator::getXFeet() const {
+  return xFeet;
+}
+
+/**
+ * @brief Get the simulated chassis position to the right of the starting heading
+ * @return double y in feet
+ */
+double DriveSimulator::getYFeet() const {
+  return yFeet;
+}
+
+/**
+ * @brief Get the simulated chassis heading (positive is to the right)
+ * @return double heading in degrees
+ */
+double DriveSimulator::getHeadingDegrees() const {
+  return headingRadians * 180 / M_PI;
+}
+
+/**
+ * @brief Get the simulated left motor position
+ * @return MotorPosition left motor position
+ */
+MotorPosition DriveSimulator::getLeftPosition() const {
+  return leftMotor.getPosition();
+}
+
+/**
+ * @brief Get the simulated right motor position
+ * @return MotorPosition right motor position
+ */
+MotorPosition DriveSimulator::getRightPosition() const {
+  return rightMotor.getPosition();
+}
+
+/**
+ * @brief Get the worst difference between the left trajectory and simulated motor positions
+ * @return MotorPosition worst left tracking error
+ */
+MotorPosition DriveSimulator::getMaxLeftTrackingError() const {
+  MotorPosition error;
+  error.setRotations(maxLeftTrackingErrorRot);
+  return error;
+}
+
+/**
+ * @brief Get the worst difference between the right trajectory and simulated motor positions
+ * @return MotorPosition worst right tracking error
+ */
+MotorPosition DriveSimulator::getMaxRightTrackingError() const {
+  MotorPosition error;
+  error.setRotations(maxRightTrackingErrorRot);
+  return error;
+}
+
+/**
+ * @brief Get the amount of time covered by the last simulation
+ * @return double simulated time in seconds
+ */
+double DriveSimulator::getSimulatedTimeS() const {
+  return simulatedTimeS;
+}
+
+/**
+ * @brief Get the number of steps taken by the last simulation
+ * @return unsigned long step count
+ */
+unsigned long DriveSimulator::getStepCount() const {
+  return stepCount;
+}
+
+/**
+ * @brief Velocity commanded by a trajectory at a time, interpolated between trajectory points
+ * @param [in] Trajectory trajectory being followed
+ * @param [in] double timeS since the start of the trajectory
+ * @return double commanded velocity in rotations per minute
+ */
+double DriveSimulator::commandedVelocityRPM(const Trajectory &trajectory,
+                                            const double timeS) {
+  const std::vector<TrajectoryPoint> &points = trajectory.getTrajectoryPoints();
+  double periodS = trajectory.getAlgoItPMS() / 1000.0;
+  if (points.empty() || periodS == 0)
+    return 0.0;
+  unsigned int index = static_cast<unsigned int>(timeS / periodS);
+  if (index + 1 >= points.size())
+    return points.back().getVelocity().getRotationsPerMinute();
+  const TrajectoryPoint &point = points[index];
+  const TrajectoryPoint &nextPoint = points[index + 1];
+  double fraction = timeS / periodS - index;
+  double velocityRPM = point.getVelocity().getRotationsPerMinute();
+  return velocityRPM
+      + (nextPoint.getVelocity().getRotationsPerMinute() - velocityRPM)
+          * fraction;
+}
+
+/**
+ * @brief Position commanded by a trajectory at a time, consistent with linearly interpolated
+ * velocities between trajectory points
+ * @param [in] Trajectory trajectory being followed
+ * @param [in] double timeS since the start of the trajectory
+ * @return double commanded position in rotations
+ */
+double DriveSimulator::commandedPositionRot(const Trajectory &trajectory,
+                                            const double timeS) {
+  const std::vector<TrajectoryPoint> &points = trajectory.getTrajectoryPoints();
+  double periodS = trajectory.getAlgoItPMS() / 1000.0;
+  if (points.empty() || periodS == 0)
+    return 0.0;
+  unsigned int index = static_cast<unsigned int>(timeS / periodS);
+  if (index + 1 >= points.size())
+    return points.back().getPosition().getRotations();
+  const TrajectoryPoint &point = points[index];
+  const TrajectoryPoint &nextPoint = points[index + 1];
+  double intoS = timeS - index * periodS;
+  double velocityRPS = point.getVelocity().getRotationsPerMinute() / 60;
+  double nextVelocityRPS = nextPoint.getVelocity().getRotationsPerMinute() / 60;
+  return point.getPosition().getRotations() + velocityRPS * intoS
+      + (nextVelocityRPS - velocityRPS) * intoS * intoS / (2 * periodS);
+}
@@ -0,0 +1,87 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file DriveSimulator.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Commented the private members
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Configures from a const TankDrive
+ *
+ * @brief Faster-than-real-time simulation of a differential (tank) drive chassis
+ *
+ * The drive simulator models a differential drive chassis as two DC motor models (left and
+ * right) separated by the drive width.  Given the left and right trajectories generated for a
+ * move, it drives each motor model with the commanded trajectory velocity and integrates the
+ * motor and chassis dynamics at a fixed simulation rate.  It normally runs as fast as the CPU
+ * allows, so that a full autonomous period can be simulated in milliseconds; an optional
+ * real-time pacing mode sleeps between simulation steps so the simulation runs on the wall
+ * clock.  After a simulation, the chassis pose (relative to its starting pose), the final motor
+ * positions, and the worst tracking error of each side are available.
+ *
+ * The chassis pose uses the same conventions as ChassisTurnRate: x is along the starting
+ * heading, y is to the right of the starting heading, and a positive heading is a turn to the
+ * right.
+ *
+ */
+#ifndef DRIVESIMULATOR_HPP_
+#define DRIVESIMULATOR_HPP_
+
+#include "DCMotorModel.hpp"
+#include "MotorPosition.hpp"
+#include "TankDrive.hpp"
+#include "Trajectory.hpp"
+
+/** @brief Simulates the motion of a tank drive chassis following left and right trajectories
+ */
+
+class DriveSimulator {
+ public:
+  DriveSimulator();
+  virtual ~DriveSimulator();
+  void configureFromTankDrive(const TankDrive &tankDrive);
+  void setMotorModel(const DCMotorModel &motorModel);
+  void setMotorRotPerMovementFoot(const double rotations);
+  double getMotorRotPerMovementFoot() const;
+  void setWidthInFeet(const double width);
+  double getWidthInFeet() const;
+  void setSimulationRateHz(const unsigned int rate);
+  unsigned int getSimulationRateHz() const;
+  void setSettleTimeS(const double seconds);
+  double getSettleTimeS() const;
+  void setRealTimePacing(const bool pacing);
+  bool getRealTimePacing() const;
+  void simulate(const Trajectory &leftTrajectory,
+                const Trajectory &rightTrajectory);
+  double getXFeet() const;
+  double getYFeet() const;
+  double getHeadingDegrees() const;
+  MotorPosition getLeftPosition() const;
+  MotorPosition getRightPosition() const;
+  MotorPosition getMaxLeftTrackingError() const;
+  MotorPosition getMaxRightTrackingError() const;
+  double getSimulatedTimeS() const;
+  unsigned long getStepCount() const;
+
+ private:
+  static double commandedVelocityRPM(const Trajectory &trajectory,
+                                     const double timeS);
+  static double commandedPositionRot(const Trajectory &trajectory,
+                                     const double timeS);
+  DCMotorModel leftMotor;            // left side drive motor
+  DCMotorModel rightMotor;           // right side drive motor
+  double motorRotPerMovementFoot;    // gearing from motor to chassis
+  double widthInFeet;                // distance between the sides
+  unsigned int simulationRateHz;     // simulation steps per second
+  double settleTimeS;                // time simulated after the trajectories
+  bool realTimePacing;               // whether steps follow the wall clock
+  double xFeet;                      // chassis position, forward
+  double yFeet;                      // chassis position, to the right
+  double headingRadians;             // chassis heading, right positive
+  double maxLeftTrackingErrorRot;    // largest left motor position error
+  double maxRightTrackingErrorRot;   // largest right motor position error
+  double simulatedTimeS;             // time simulated by the last simulate
+  unsigned long stepCount;           // steps taken by the last simulate
+};
+
+#endif /* DRIVESIMULATOR_HPP_ */
@@ -4,6 +4,8 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 13, 2017 - Creation
+ * @date Oct 19, 2026 - Const-correct; chassis name set by move and returned by reference
+ * @date Oct 19, 2026 - Trajectory CSV file names built once, when the chassis name is set
  *
  * @brief A base class for representing drive system objects
  *
@@ -16,6 +18,8 @@
 
 DriveSystem::DriveSystem()
     : chassisName(""),
+      leftTrajectoryFileName("-left.CSV"),
+      rightTrajectoryFileName("-right.CSV"),
       maxVelocity(),
       maxAcceleration(),
       motorRotPerMovementFoot(0.0),
@@ -28,9 +32,12 @@ DriveSystem::~DriveSystem() {
 /**
  * @brief Set the chassis name to which this drive system belongs
  * @param [in] std::string name that matches the chassis name to which this drive system belongs
+ * (the trajectory CSV file names are built from it here, once, rather than on every move)
  */
 void DriveSystem::setChassisName(std::string name) {
-  chassisName = name;
+  chassisName = std::move(name);
+  leftTrajectoryFileName.assign(chassisName).append("-left.CSV");
+  rightTrajectoryFileName.assign(chassisName).append("-right.CSV");
   return;
 }
 
@@ -38,7 +45,7 @@ void DriveSystem::setChassisName(std::string name) {
  * @brief Get the name for the chassis to which this drive system belongs
  * @return std::string chassisName of the chassis to which this drive system belongs
  */
-std::string DriveSystem::getChassisName() {
+const std::string &DriveSystem::getChassisName() const {
   return chassisName;
 }
 
@@ -55,7 +62,7 @@ void DriveSystem::setMaxVelocity(MotorVelocity velocity) {
  * @brief Get the maximum velocity at which this drive system can operate effectively
  * @return MotorVelocity velocity at which this drive system can operate effectively
  */
-MotorVelocity DriveSystem::getMaxVelocity() {
+MotorVelocity DriveSystem::getMaxVelocity() const {
   return maxVelocity;
 }
 
@@ -72,7 +79,7 @@ void DriveSystem::setMaxAcceleration(MotorAcceleration acceleration) {
  * @brief Get the maximum acceleration at which this drive system can operate effectively
  * @return MotorAcceleration acceleration at which this drive system can operate effectively
  */
-MotorAcceleration DriveSystem::getMaxAcceleration() {
+MotorAcceleration DriveSystem::getMaxAcceleration() const {
   return maxAcceleration;
 }
 
@@ -89,7 +96,7 @@ void DriveSystem::setMotorRotPerMovementFoot(double rotations) {
  * @brief Get the number of motor rotations required to move the drive system one foot
  * @return double rotations of the motor per foot of movement
  */
-double DriveSystem::getMotorRotPerMovementFoot() {
+double DriveSystem::getMotorRotPerMovementFoot() const {
   return motorRotPerMovementFoot;
 }
 
@@ -106,7 +113,7 @@ void DriveSystem::setTrajectoryIterationPeriodMS(unsigned int period) {
  * @brief Get the iteration period (in milliseconds) to be used for each trajectory point
  * @return unsigned int period for trajectory points in milliseconds
  */
-unsigned int DriveSystem::getTrajectoryIterationPeriodMS() {
+unsigned int DriveSystem::getTrajectoryIterationPeriodMS() const {
   return trajectoryIterationPeriodMS;
 }
 
@@ -4,6 +4,8 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 13, 2017 - Creation
+ * @date Oct 19, 2026 - Const-correct; chassis name set by move and returned by reference
+ * @date Oct 19, 2026 - Trajectory CSV file names built once, when the chassis name is set
  *
  * @brief A base class for representing drive system objects
  *
@@ -16,6 +18,7 @@
 #define DRIVESYSTEM_HPP_
 
 #include <string>
+#include <utility>
 #include "ChassisAcceleration.hpp"
 #include "ChassisTurnRate.hpp"
 #include "ChassisVelocity.hpp"
@@ -30,21 +33,23 @@ class DriveSystem {
   DriveSystem();
   virtual ~DriveSystem();
   void setChassisName(std::string name);
-  std::string getChassisName();
+  const std::string &getChassisName() const;
   void setMaxVelocity(MotorVelocity velocity);
-  MotorVelocity getMaxVelocity();
+  MotorVelocity getMaxVelocity() const;
   void setMaxAcceleration(MotorAcceleration acceleration);
-  MotorAcceleration getMaxAcceleration();
+  MotorAcceleration getMaxAcceleration() const;
   void setMotorRotPerMovementFoot(double rotations);
-  double getMotorRotPerMovementFoot();
+  double getMotorRotPerMovementFoot() const;
   void setTrajectoryIterationPeriodMS(unsigned int period);
-  unsigned int getTrajectoryIterationPeriodMS();
+  unsigned int getTrajectoryIterationPeriodMS() const;
   virtual void move(double distanceFeet, ChassisTurnRate chassisTurnRate,
                     ChassisVelocity chassisVelocityRequested,
                     ChassisAcceleration chassisAccelerationRequested);
 
  protected:
   std::string chassisName;
+  std::string leftTrajectoryFileName;   // chassis name + "-left.CSV"
+  std::string rightTrajectoryFileName;  // chassis name + "-right.CSV"
   MotorVelocity maxVelocity;
   MotorAcceleration maxAcceleration;
   double motorRotPerMovementFoot;
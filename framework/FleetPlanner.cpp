@@ -0,0 +1,226 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file FleetPlanner.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Moves held as the chassis's move parameters
+ *
+ * @brief Concurrent move planning for a fleet of Chassis objects
+ *
+ * The fleet planner holds a list of moves for each of many chassis, and generates the
+ * trajectories for all of them using a pool of worker threads.  Each chassis has its own
+ * isolated set of trajectory buffers, owned by the planner and reused from one planning run to
+ * the next, and each chassis is planned entirely by whichever worker claims it from a shared
+ * atomic counter; no other state is shared between workers, so planning scales with the number
+ * of cores.  Optionally, each planned trajectory is written to its own CSV file in an output
+ * directory; the file names include the chassis's position in the fleet and the move number as
+ * well as the chassis name, so chassis with the same name do not overwrite each other's output.
+ *
+ */
+#include <algorithm>
+#include <thread>
+#include "FleetPlanner.hpp"
+
+FleetPlanner::FleetPlanner()
+    : fleet(),
+      outputDirectory(""),
+      nextChassis(0) {
+}
+
+FleetPlanner::~FleetPlanner() {
+}
+
+/**
+ * @brief Add a chassis to the fleet; the chassis must outlive its planning
+ * @param [in] Chassis chassis to be planned for
+ * @return unsigned int index of the chassis in the fleet
+ */
+unsigned int FleetPlanner::addChassis(Chassis &chassis) {
+  ChassisPlan chassisPlan;
+  chassisPlan.chassis = &chassis;
+  fleet.push_back(std::move(chassisPlan));
+  return fleet.size() - 1;
+}
+
+/**
+ * @brief Get the number of chassis in the fleet
+ * @return unsigned int number of chassis
+ */
+unsigned int FleetPlanner::getChassisCount() const {
+  return fleet.size();
+}
+
+/**
+ * @brief Remove every chassis (and its moves and buffers) from the fleet
+ */
+void FleetPlanner::clearFleet() {
+  fleet.clear();
+  return;
+}
+
+/**
+ * @brief Add a move to the end of a chassis's list of moves
+ * @param [in] unsigned int chassisIndex of the chassis in the fleet
+ * @param [in] double distanceFeet to move the chassis
+ * @param [in] ChassisTurnRate chassisTurnRate (0 for straight, < 0 for left turn, > 0 for right turn)
+ * @param [in] ChassisVelocity chassisVelocityRequested (actual movement constrained by drive system)
+ * @param [in] ChassisAcceleration chassisAccelerationRequested (actual movement constrained by drive system)
+ * @return bool true if the chassis index was within the fleet
+ */
+bool FleetPlanner::addMove(const unsigned int chassisIndex,
+                           double distanceFeet,
+                           ChassisTurnRate chassisTurnRate,
+                           ChassisVelocity chassisVelocityRequested,
+                           ChassisAcceleration chassisAccelerationRequested) {
+  if (chassisIndex >= fleet.size())
+    return false;
+  Chassis::QueuedMove fleetMove;
+  fleetMove.distanceFeet = distanceFeet;
+  fleetMove.turnRate = chassisTurnRate;
+  fleetMove.velocity = chassisVelocityRequested;
+  fleetMove.acceleration = chassisAccelerationRequested;
+  fleet[chassisIndex].moves.push_back(fleetMove);
+  return true;
+}
+
+/**
+ * @brief Get the number of moves listed for a chassis
+ * @param [in] unsigned int chassisIndex of the chassis in the fleet
+ * @return unsigned int number of moves (0 if the index is not within the fleet)
+ */
+unsigned int FleetPlanner::getMoveCount(const unsigned int chassisIndex) const {
+  if (chassisIndex >= fleet.size())
+    return 0;
+  return fleet[chassisIndex].moves.size();
+}
+
+/**
+ * @brief Remove every chassis's moves, keeping the fleet and its buffers for reuse
+ */
+void FleetPlanner::clearMoves() {
+  for (auto &chassisPlan : fleet)
+    chassisPlan.moves.clear();
+  return;
+}
+
+/**
+ * @brief Set the directory planned trajectories are written to
+ * @param [in] std::string directory for CSV output (empty for no output)
+ */
+void FleetPlanner::setOutputDirectory(const std::string &directory) {
+  outputDirectory = directory;
+  return;
+}
+
+/**
+ * @brief Get the directory planned trajectories are written to
+ * @return std::string directory for CSV output (empty for no output)
+ */
+std::string FleetPlanner::getOutputDirectory() const {
+  return outputDirectory;
+}
+
+/**
+ * @brief Generate the trajectories for every listed move of every chassis
+ * @param [in] unsigned int threadCount of worker threads (0 for one per hardware thread)
+ */
+void FleetPlanner::plan(unsigned int threadCount) {
+  const unsigned int chassisCount = fleet.size();
+  if (threadCount == 0)
+    threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+  threadCount = std::min(threadCount, std::max(chassisCount, 1u));
+
+  // Each worker claims the next unplanned chassis until none are left
+  nextChassis = 0;
+  auto worker = [this, chassisCount]() {
+    for (unsigned int index = nextChassis++; index < chassisCount; index =
+        nextChassis++)
+      planChassis(index);
+  };
+  std::vector<std::thread> workers;
+  for (unsigned int t = 1; t < threadCount; t++)
+    workers.emplace_back(worker);
+  worker();
+  for (auto &thread : workers)
+    thread.join();
+  return;
+}
+
+/**
+ * @brief Get the planned left side trajectory of a move
+ * @param [in] unsigned int chassisIndex of the chassis in the fleet
+ * @param [in] unsigned int moveIndex of the move in the chassis's list
+ * @return Trajectory* the trajectory (nullptr if the move does not exist)
+ */
+const Trajectory *FleetPlanner::getLeftTrajectory(
+    const unsigned int chassisIndex, const unsigned int moveIndex) const {
+  if (chassisIndex >= fleet.size()
+      || moveIndex >= fleet[chassisIndex].moves.size())
+    return nullptr;
+  return &fleet[chassisIndex].leftTrajectories[moveIndex];
+}
+
+/**
+ * @brief Get the planned right side trajectory of a move
+ * @param [in] unsigned int chassisIndex of the chassis in the fleet
+ * @param [in] unsigned int moveIndex of the move in the chassis's list
+ * @return Trajectory* the trajectory (nullptr if the move does not exist)
+ */
+const Trajectory *FleetPlanner::getRightTrajectory(
+    const unsigned int chassisIndex, const unsigned int moveIndex) const {
+  if (chassisIndex >= fleet.size()
+      || moveIndex >= fleet[chassisIndex].moves.size())
+    return nullptr;
+  return &fleet[chassisIndex].rightTrajectories[moveIndex];
+}
+
+/**
+ * @brief Get the name of the CSV file a planned trajectory is written to
+ * @param [in] unsigned int chassisIndex of the chassis in the fleet
+ * @param [in] unsigned int moveIndex of the move in the chassis's list
+ * @param [in] std::string side of the drive ("left" or "right")
+ * @return std::string file name, unique to the chassis, move and side
+ */
+std::string FleetPlanner::getOutputFileName(const unsigned int chassisIndex,
+                                            const unsigned int moveIndex,
+                                            const std::string &side) const {
+  std::string chassisName;
+  if (chassisIndex < fleet.size())
+    chassisName = fleet[chassisIndex].chassis->getName();
+  return outputDirectory + "/" + chassisName + "-"
+      + std::to_string(chassisIndex) + "-move" + std::to_string(moveIndex)
+      + "-" + side + ".CSV";
+}
+
+/**
+ * @brief Generate (and optionally write out) the trajectories for one chassis's moves
+ * @param [in] unsigned int chassisIndex of the chassis in the fleet
+ */
+void FleetPlanner::planChassis(const unsigned int chassisIndex) {
+  ChassisPlan &chassisPlan = fleet[chassisIndex];
+  const unsigned int moveCount = chassisPlan.moves.size();
+
+  // Grow (never shrink) this chassis's buffers, so their storage is reused
+  if (chassisPlan.leftTrajectories.size() < moveCount) {
+    chassisPlan.leftTrajectories.resize(moveCount);
+    chassisPlan.rightTrajectories.resize(moveCount);
+  }
+
+  for (unsigned int move = 0; move < moveCount; move++) {
+    const Chassis::QueuedMove &fleetMove = chassisPlan.moves[move];
+    Trajectory &leftTrajectory = chassisPlan.leftTrajectories[move];
+    Trajectory &rightTrajectory = chassisPlan.rightTrajectories[move];
+    chassisPlan.chassis->generateMove(fleetMove.distanceFeet,
+                                      fleetMove.turnRate, fleetMove.velocity,
+                                      fleetMove.acceleration, leftTrajectory,
+                                      rightTrajectory);
+    if (!outputDirectory.empty()) {
+      leftTrajectory.outputCSV(getOutputFileName(chassisIndex, move, "left"));
+      rightTrajectory.outputCSV(
+          getOutputFileName(chassisIndex, move, "right"));
+    }
+  }
+  return;
+}
@@ -0,0 +1,75 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file FleetPlanner.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Moves held as the chassis's move parameters
+ *
+ * @brief Concurrent move planning for a fleet of Chassis objects
+ *
+ * The fleet planner holds a list of moves for each of many chassis, and generates the
+ * trajectories for all of them using a pool of worker threads.  Each chassis has its own
+ * isolated set of trajectory buffers, owned by the planner and reused from one planning run to
+ * the next, and each chassis is planned entirely by whichever worker claims it from a shared
+ * atomic counter; no other state is shared between workers, so planning scales with the number
+ * of cores.  Optionally, each planned trajectory is written to its own CSV file in an output
+ * directory; the file names include the chassis's position in the fleet and the move number as
+ * well as the chassis name, so chassis with the same name do not overwrite each other's output.
+ *
+ */
+#ifndef FLEETPLANNER_HPP_
+#define FLEETPLANNER_HPP_
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include "Chassis.hpp"
+#include "ChassisAcceleration.hpp"
+#include "ChassisTurnRate.hpp"
+#include "ChassisVelocity.hpp"
+#include "Trajectory.hpp"
+
+/** @brief Plans the moves of many chassis concurrently into per-chassis buffers
+ */
+
+class FleetPlanner {
+ public:
+  FleetPlanner();
+  virtual ~FleetPlanner();
+  unsigned int addChassis(Chassis &chassis);
+  unsigned int getChassisCount() const;
+  void clearFleet();
+  bool addMove(const unsigned int chassisIndex, double distanceFeet,
+               ChassisTurnRate chassisTurnRate,
+               ChassisVelocity chassisVelocityRequested,
+               ChassisAcceleration chassisAccelerationRequested);
+  unsigned int getMoveCount(const unsigned int chassisIndex) const;
+  void clearMoves();
+  void setOutputDirectory(const std::string &directory);
+  std::string getOutputDirectory() const;
+  void plan(unsigned int threadCount = 0);
+  const Trajectory *getLeftTrajectory(const unsigned int chassisIndex,
+                                      const unsigned int moveIndex) const;
+  const Trajectory *getRightTrajectory(const unsigned int chassisIndex,
+                                       const unsigned int moveIndex) const;
+  std::string getOutputFileName(const unsigned int chassisIndex,
+                                const unsigned int moveIndex,
+                                const std::string &side) const;
+
+ private:
+  // One chassis's moves and its isolated trajectory buffers
+  struct ChassisPlan {
+    Chassis *chassis;
+    std::vector<Chassis::QueuedMove> moves;
+    std::vector<Trajectory> leftTrajectories;   // one buffer per move
+    std::vector<Trajectory> rightTrajectories;  // one buffer per move
+  };
+  void planChassis(const unsigned int chassisIndex);
+  std::vector<ChassisPlan> fleet;
+  std::string outputDirectory;  // where CSV output goes (empty for none)
+  std::atomic<unsigned int> nextChassis;
+};
+
+#endif /* FLEETPLANNER_HPP_ */
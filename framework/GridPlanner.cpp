@@ -0,0 +1,279 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file GridPlanner.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A* search for the shortest collision-free route across an occupancy grid
+ *
+ * The grid planner finds the shortest route between two free cells of an OccupancyGrid,
+ * moving between the eight neighbors of each cell (a diagonal move may not cut the corner of
+ * an occupied cell), using A* search with the octile distance as its heuristic.  The open set
+ * is a binary heap held in a vector, with each open cell on it only once: a cheaper way found
+ * to an open cell moves that cell up the heap instead of adding it again.  The search data for
+ * each cell (cost so far, parent, heap position, and whether it has been reached or closed in
+ * the current search) is kept together in a flat array indexed like the grid's cells.  That
+ * array is allocated once per grid size and re-used by every later search: a stamp from the
+ * search number on each cell marks which cells belong to the current search, so nothing has
+ * to be cleared between searches, and a route can be re-planned every control period without
+ * allocating memory.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include "GridPlanner.hpp"
+
+namespace {
+// The cost (in cells) of a diagonal move
+const double diagonalCost = std::sqrt(2.0);
+// The eight moves from a cell to its neighbors: column step, row step, and
+// cost (in cells)
+const int moveColumn[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+const int moveRow[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+const double moveCost[8] = { 1.0, 1.0, 1.0, 1.0, diagonalCost, diagonalCost,
+    diagonalCost, diagonalCost };
+}  // namespace
+
+GridPlanner::GridPlanner()
+    : grid(nullptr),
+      searchCells(),
+      openHeap(),
+      reachedStamp(0),
+      closedStamp(1),
+      searchGoalColumn(0),
+      searchGoalRow(0),
+      expandedCount(0),
+      routeCostFeet(0.0) {
+}
+
+GridPlanner::~GridPlanner() {
+}
+
+/**
+ * @brief Set the grid to plan routes across
+ * @param [in] OccupancyGrid occupancyGrid to plan across (must outlive its use by the planner)
+ */
+void GridPlanner::setGrid(const OccupancyGrid &occupancyGrid) {
+  grid = &occupancyGrid;
+  return;
+}
+
+/**
+ * @brief Get the grid that routes are planned across
+ * @return OccupancyGrid pointer to the grid (nullptr if none has been set)
+ */
+const OccupancyGrid *GridPlanner::getGrid() const {
+  return grid;
+}
+
+/**
+ * @brief Plan the shortest route between two cells
+ * @param [in] unsigned int startColumn of the cell the route starts in
+ * @param [in] unsigned int startRow of the cell the route starts in
+ * @param [in] unsigned int goalColumn of the cell the route ends in
+ * @param [in] unsigned int goalRow of the cell the route ends in
+ * @param [out] vector of unsigned int routeCells - every cell on the route, from start to goal
+ * @return bool indication of whether a route was found
+ */
+bool GridPlanner::plan(const unsigned int startColumn,
+                       const unsigned int startRow,
+                       const unsigned int goalColumn,
+                       const unsigned int goalRow,
+                       std::vector<unsigned int> &routeCells) {
+  routeCells.clear();
+  expandedCount = 0;
+  routeCostFeet = 0.0;
+  if (grid == nullptr || grid->isOccupied(startColumn, startRow)
+      || grid->isOccupied(goalColumn, goalRow))
+    return false;
+  prepareSearch();
+
+  // The grid's dimensions and cells are read directly in the search loop
+  const int width = grid->getWidth();
+  const int height = grid->getHeight();
+  const unsigned char *occupied = grid->getCells();
+  const unsigned int start = grid->cellIndex(startColumn, startRow);
+  const unsigned int goal = grid->cellIndex(goalColumn, goalRow);
+  searchGoalColumn = goalColumn;
+  searchGoalRow = goalRow;
+  searchCells[start].costSoFar = 0.0;
+  searchCells[start].stamp = reachedStamp;
+  openHeap.push_back(
+      OpenEntry { static_cast<float>(heuristic(startColumn, startRow)), 0.0f,
+          start });
+  searchCells[start].heapPosition = 0;
+
+  while (!openHeap.empty()) {
+    // Take the open cell with the lowest estimated route cost off the heap
+    const unsigned int cell = openHeap.front().cell;
+    openHeap.front() = openHeap.back();
+    openHeap.pop_back();
+    if (!openHeap.empty())
+      siftDown(0);
+    SearchCell &current = searchCells[cell];
+    current.stamp = closedStamp;
+    expandedCount++;
+
+    if (cell == goal) {
+      // Walk back from the goal to the start, then put the route in order
+      for (unsigned int c = goal; c != start; c = searchCells[c].parent)
+        routeCells.push_back(c);
+      routeCells.push_back(start);
+      std::reverse(routeCells.begin(), routeCells.end());
+      routeCostFeet = current.costSoFar * grid->getCellSizeFeet();
+      return true;
+    }
+
+    // Reach each free neighbor, keeping the cheapest way found to it (the
+    // neighbors' indexes are offsets from this cell's index)
+    const int column = cell % width;
+    const int row = cell / width;
+    for (unsigned int move = 0; move < 8; move++) {
+      const int nextColumn = column + moveColumn[move];
+      const int nextRow = row + moveRow[move];
+      if (nextColumn < 0 || nextColumn >= width || nextRow < 0
+          || nextRow >= height)
+        continue;
+      const unsigned int next = cell + moveColumn[move]
+          + moveRow[move] * width;
+      SearchCell &neighbor = searchCells[next];
+      if (occupied[next] || neighbor.stamp == closedStamp)
+        continue;
+      // A diagonal move may not cut the corner of an occupied cell
+      if (moveColumn[move] != 0 && moveRow[move] != 0
+          && (occupied[cell + moveColumn[move]]
+              || occupied[cell + moveRow[move] * width]))
+        continue;
+      const double nextCost = current.costSoFar + moveCost[move];
+      const OpenEntry entry { static_cast<float>(nextCost
+          + heuristic(nextColumn, nextRow)), static_cast<float>(nextCost),
+          next };
+      if (neighbor.stamp != reachedStamp) {
+        // Newly reached: add it to the open set
+        neighbor.stamp = reachedStamp;
+        neighbor.heapPosition = openHeap.size();
+        openHeap.push_back(entry);
+      } else if (nextCost < neighbor.costSoFar) {
+        // A cheaper way to an open cell: update it where it is on the heap
+        openHeap[neighbor.heapPosition] = entry;
+      } else {
+        continue;
+      }
+      neighbor.costSoFar = nextCost;
+      neighbor.parent = cell;
+      siftUp(neighbor.heapPosition);
+    }
+  }
+
+  // The open set ran out without reaching the goal: there is no route
+  return false;
+}
+
+/**
+ * @brief Get the length of the last route found
+ * @return double route length in feet (0 if the last search found no route)
+ */
+double GridPlanner::getRouteCostFeet() const {
+  return routeCostFeet;
+}
+
+/**
+ * @brief Get the number of cells expanded by the last search
+ * @return unsigned int count of cells closed by the last search
+ */
+unsigned int GridPlanner::getExpandedCount() const {
+  return expandedCount;
+}
+
+/**
+ * @brief Open set ordering: the entry with the lower estimated cost is better
+ * (ties go to the entry further from the start, which is likely closer to the goal)
+ * @param [in] OpenEntry a
+ * @param [in] OpenEntry b
+ * @return bool indication of whether a is better than b
+ */
+bool GridPlanner::better(const OpenEntry &a, const OpenEntry &b) {
+  if (a.estimatedCost != b.estimatedCost)
+    return a.estimatedCost < b.estimatedCost;
+  return a.costSoFar > b.costSoFar;
+}
+
+/**
+ * @brief Octile distance from a cell to the goal: the exact route cost with no obstacles
+ * @param [in] int column of the cell to estimate from
+ * @param [in] int row of the cell to estimate from
+ * @return double estimated cost in cells
+ */
+double GridPlanner::heuristic(const int column, const int row) const {
+  const int columns = std::abs(column - searchGoalColumn);
+  const int rows = std::abs(row - searchGoalRow);
+  return (columns + rows) + (diagonalCost - 2) * std::min(columns, rows);
+}
+
+/**
+ * @brief Size the search buffers for the grid and start a new search
+ */
+void GridPlanner::prepareSearch() {
+  const unsigned int cellCount = grid->getCellCount();
+  if (searchCells.size() != cellCount) {
+    searchCells.assign(cellCount, SearchCell { 0.0, 0, 0, 0 });
+    closedStamp = 1;
+  }
+  // Stamps 0 and 1 mark cells never reached; when the stamps wrap around,
+  // they have to be cleared once
+  reachedStamp = closedStamp + 1;
+  closedStamp = reachedStamp + 1;
+  if (reachedStamp < 2) {
+    for (auto &searchCell : searchCells)
+      searchCell.stamp = 0;
+    reachedStamp = 2;
+    closedStamp = 3;
+  }
+  openHeap.clear();
+  return;
+}
+
+/**
+ * @brief Move an open set entry up the heap until its parent is no worse
+ * @param [in] unsigned int position of the entry on the heap
+ */
+void GridPlanner::siftUp(unsigned int position) {
+  const OpenEntry entry = openHeap[position];
+  while (position > 0) {
+    const unsigned int parentPosition = (position - 1) / 2;
+    if (!better(entry, openHeap[parentPosition]))
+      break;
+    openHeap[position] = openHeap[parentPosition];
+    searchCells[openHeap[position].cell].heapPosition = position;
+    position = parentPosition;
+  }
+  openHeap[position] = entry;
+  searchCells[entry.cell].heapPosition = position;
+  return;
+}
+
+/**
+ * @brief Move an open set entry down the heap until neither child is better
+ * @param [in] unsigned int position of the entry on the heap
+ */
+void GridPlanner::siftDown(unsigned int position) {
+  const OpenEntry entry = openHeap[position];
+  const unsigned int size = openHeap.size();
+  while (true) {
+    unsigned int child = 2 * position + 1;
+    if (child >= size)
+      break;
+    if (child + 1 < size && better(openHeap[child + 1], openHeap[child]))
+      child++;
+    if (!better(openHeap[child], entry))
+      break;
+    openHeap[position] = openHeap[child];
+    searchCells[openHeap[position].cell].heapPosition = position;
+    position = child;
+  }
+  openHeap[position] = entry;
+  searchCells[entry.cell].heapPosition = position;
+  return;
+}
@@ -0,0 +1,76 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file GridPlanner.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A* search for the shortest collision-free route across an occupancy grid
+ *
+ * The grid planner finds the shortest route between two free cells of an OccupancyGrid,
+ * moving between the eight neighbors of each cell (a diagonal move may not cut the corner of
+ * an occupied cell), using A* search with the octile distance as its heuristic.  The open set
+ * is a binary heap held in a vector, with each open cell on it only once: a cheaper way found
+ * to an open cell moves that cell up the heap instead of adding it again.  The search data for
+ * each cell (cost so far, parent, heap position, and whether it has been reached or closed in
+ * the current search) is kept together in a flat array indexed like the grid's cells.  That
+ * array is allocated once per grid size and re-used by every later search: a stamp from the
+ * search number on each cell marks which cells belong to the current search, so nothing has
+ * to be cleared between searches, and a route can be re-planned every control period without
+ * allocating memory.
+ *
+ */
+#ifndef GRIDPLANNER_HPP_
+#define GRIDPLANNER_HPP_
+
+#include <vector>
+#include "OccupancyGrid.hpp"
+
+/** @brief Plans shortest routes across an occupancy grid with A* search
+ */
+
+class GridPlanner {
+ public:
+  GridPlanner();
+  virtual ~GridPlanner();
+  void setGrid(const OccupancyGrid &occupancyGrid);
+  const OccupancyGrid *getGrid() const;
+  bool plan(const unsigned int startColumn, const unsigned int startRow,
+            const unsigned int goalColumn, const unsigned int goalRow,
+            std::vector<unsigned int> &routeCells);
+  double getRouteCostFeet() const;
+  unsigned int getExpandedCount() const;
+
+ private:
+  // An entry in the open set: a cell with its estimated total route cost
+  // (single precision keeps the heap small; it is only used for ordering)
+  struct OpenEntry {
+    float estimatedCost;  // cost so far plus heuristic, in cells
+    float costSoFar;      // cost from the start, in cells
+    unsigned int cell;
+  };
+  // The search data kept for each cell, together so that reaching a cell
+  // touches one place in memory
+  struct SearchCell {
+    double costSoFar;           // best cost from the start, in cells
+    unsigned int parent;        // previous cell on the best route
+    unsigned int stamp;         // search that reached (even) or closed (odd) it
+    unsigned int heapPosition;  // position in the open set while open
+  };
+  static bool better(const OpenEntry &a, const OpenEntry &b);
+  double heuristic(const int column, const int row) const;
+  void prepareSearch();
+  void siftUp(unsigned int position);
+  void siftDown(unsigned int position);
+  const OccupancyGrid *grid;
+  std::vector<SearchCell> searchCells;  // search data, indexed like the grid
+  std::vector<OpenEntry> openHeap;      // open set, as a binary heap
+  unsigned int reachedStamp;            // stamp of a cell reached this search
+  unsigned int closedStamp;             // stamp of a cell closed this search
+  int searchGoalColumn;                 // goal of the current search
+  int searchGoalRow;
+  unsigned int expandedCount;           // cells closed by the last search
+  double routeCostFeet;                 // length of the last route found
+};
+
+#endif /* GRIDPLANNER_HPP_ */
@@ -0,0 +1,492 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file IncrementalGridPlanner.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief D* Lite search for shortest routes across an occupancy grid that change with the grid
+ *
+ * The incremental grid planner finds the same shortest routes as the GridPlanner (eight
+ * neighbors per cell, no cutting the corner of an occupied cell, octile distance heuristic),
+ * but keeps its search after a route has been planned.  When cells of the grid change, or the
+ * start of the route moves along it, the planner repairs only the part of the previous search
+ * that the change affects (D* Lite: the search runs from the goal back to the start, so the
+ * distances to the goal of cells unaffected by a change stay valid), so a small map update
+ * costs a fraction of planning the route again from scratch.
+ *
+ * The search data for each cell (distance to the goal, one-step lookahead distance, and
+ * position in the open set) is kept together in a flat array indexed like the grid's cells,
+ * and the open set is a binary heap in a vector, with each open cell on it once.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include "IncrementalGridPlanner.hpp"
+
+namespace {
+// The distance of a cell with no route to the goal
+const double infinity = std::numeric_limits<double>::infinity();
+// The heap position of a cell that is not in the open set
+const unsigned int notOpen = std::numeric_limits<unsigned int>::max();
+// The cost (in cells) of a diagonal move
+const double diagonalCost = std::sqrt(2.0);
+// Open set keys closer than this (in cells) are compared by their second
+// element
+const double keyTolerance = 1e-9;
+}  // namespace
+
+IncrementalGridPlanner::IncrementalGridPlanner()
+    : grid(nullptr),
+      searchCells(),
+      openHeap(),
+      planned(false),
+      start(0),
+      goal(0),
+      keyModifier(0.0),
+      expandedCount(0),
+      routeCostFeet(0.0) {
+}
+
+IncrementalGridPlanner::~IncrementalGridPlanner() {
+}
+
+/**
+ * @brief Set the grid to plan routes across (any search held for another grid is dropped)
+ * @param [in] OccupancyGrid occupancyGrid to plan across (must outlive its use by the planner)
+ */
+void IncrementalGridPlanner::setGrid(const OccupancyGrid &occupancyGrid) {
+  grid = &occupancyGrid;
+  planned = false;
+  return;
+}
+
+/**
+ * @brief Get the grid that routes are planned across
+ * @return OccupancyGrid pointer to the grid (nullptr if none has been set)
+ */
+const OccupancyGrid *IncrementalGridPlanner::getGrid() const {
+  return grid;
+}
+
+/**
+ * @brief Plan the shortest route between two cells with a new search, and keep the search
+ * @param [in] unsigned int startColumn of the cell the route starts in
+ * @param [in] unsigned int startRow of the cell the route starts in
+ * @param [in] unsigned int goalColumn of the cell the route ends in
+ * @param [in] unsigned int goalRow of the cell the route ends in
+ * @param [out] vector of unsigned int routeCells - every cell on the route, from start to goal
+ * @return bool indication of whether a route was found
+ */
+bool IncrementalGridPlanner::plan(const unsigned int startColumn,
+                                  const unsigned int startRow,
+                                  const unsigned int goalColumn,
+                                  const unsigned int goalRow,
+                                  std::vector<unsigned int> &routeCells) {
+  routeCells.clear();
+  routeCostFeet = 0.0;
+  expandedCount = 0;
+  planned = false;
+  if (grid == nullptr || !grid->inBounds(startColumn, startRow)
+      || !grid->inBounds(goalColumn, goalRow))
+    return false;
+
+  // Every cell starts with no route to the goal, except the goal itself
+  searchCells.assign(grid->getCellCount(),
+                     SearchCell { infinity, infinity, notOpen });
+  openHeap.clear();
+  keyModifier = 0.0;
+  start = grid->cellIndex(startColumn, startRow);
+  goal = grid->cellIndex(goalColumn, goalRow);
+  planned = true;
+  if (!grid->isOccupiedIndex(goal)) {
+    searchCells[goal].lookahead = 0.0;
+    insertOpen(goal, calculateKey(goal));
+  }
+  computeShortestRoute();
+  return extractRoute(routeCells);
+}
+
+/**
+ * @brief Check whether the planner holds a search for a start and goal
+ * @param [in] unsigned int startColumn of the cell the route starts in
+ * @param [in] unsigned int startRow of the cell the route starts in
+ * @param [in] unsigned int goalColumn of the cell the route ends in
+ * @param [in] unsigned int goalRow of the cell the route ends in
+ * @return bool indication of whether update() can repair a search for this start and goal
+ */
+bool IncrementalGridPlanner::isPlannedFor(const unsigned int startColumn,
+                                          const unsigned int startRow,
+                                          const unsigned int goalColumn,
+                                          const unsigned int goalRow) const {
+  return planned && grid != nullptr && grid->inBounds(startColumn, startRow)
+      && grid->inBounds(goalColumn, goalRow)
+      && start == grid->cellIndex(startColumn, startRow)
+      && goal == grid->cellIndex(goalColumn, goalRow);
+}
+
+/**
+ * @brief Repair the search after cells of the grid have changed, and re-plan the route
+ * @param [in] vector of unsigned int changedCells - indexes of the cells whose occupancy changed
+ * (the grid must already hold their new occupancy)
+ * @param [out] vector of unsigned int routeCells - every cell on the route, from start to goal
+ * @return bool indication of whether a route was found (false if nothing has been planned)
+ */
+bool IncrementalGridPlanner::update(
+    const std::vector<unsigned int> &changedCells,
+    std::vector<unsigned int> &routeCells) {
+  routeCells.clear();
+  routeCostFeet = 0.0;
+  expandedCount = 0;
+  if (!planned)
+    return false;
+
+  // A changed cell changes the cost of the moves into and out of it, and
+  // of the diagonal moves past its corners, all of which are between the
+  // cell and its neighbors
+  unsigned int neighborCells[8];
+  for (auto changed : changedCells) {
+    if (changed >= searchCells.size())
+      continue;
+    updateLookahead(changed);
+    const unsigned int neighborCount = neighbors(changed, neighborCells);
+    for (unsigned int n = 0; n < neighborCount; n++)
+      updateLookahead(neighborCells[n]);
+  }
+  computeShortestRoute();
+  return extractRoute(routeCells);
+}
+
+/**
+ * @brief Move the start of the route (e.g., as the chassis travels it), and re-plan the route
+ * @param [in] unsigned int startColumn of the cell the route now starts in
+ * @param [in] unsigned int startRow of the cell the route now starts in
+ * @param [out] vector of unsigned int routeCells - every cell on the route, from start to goal
+ * @return bool indication of whether a route was found (false if nothing has been planned)
+ */
+bool IncrementalGridPlanner::moveStart(const unsigned int startColumn,
+                                       const unsigned int startRow,
+                                       std::vector<unsigned int> &routeCells) {
+  routeCells.clear();
+  routeCostFeet = 0.0;
+  expandedCount = 0;
+  if (!planned || !grid->inBounds(startColumn, startRow))
+    return false;
+
+  // Keys already in the open set were computed with the distance from the
+  // old start; rather than recomputing them, every later key is raised by
+  // the most the heuristic can have dropped
+  const unsigned int newStart = grid->cellIndex(startColumn, startRow);
+  keyModifier += heuristic(newStart);
+  start = newStart;
+  computeShortestRoute();
+  return extractRoute(routeCells);
+}
+
+/**
+ * @brief Get the length of the last route found
+ * @return double route length in feet (0 if the last request found no route)
+ */
+double IncrementalGridPlanner::getRouteCostFeet() const {
+  return routeCostFeet;
+}
+
+/**
+ * @brief Get the number of cells expanded by the last plan, update, or start move
+ * @return unsigned int count of cells taken from the open set
+ */
+unsigned int IncrementalGridPlanner::getExpandedCount() const {
+  return expandedCount;
+}
+
+/**
+ * @brief Compare two open set keys
+ * @param [in] Key a
+ * @param [in] Key b
+ * @return bool indication of whether a comes before b
+ */
+bool IncrementalGridPlanner::lessKey(const Key &a, const Key &b) {
+  // The first elements of the start's key and of a cell on its route are
+  // equal but for rounding (the distance to the goal through the cell), and
+  // must tie so that the second elements decide
+  if (a.first < b.first - keyTolerance)
+    return true;
+  if (a.first > b.first + keyTolerance)
+    return false;
+  return a.second < b.second;
+}
+
+/**
+ * @brief Calculate the open set key of a cell from its distances
+ * @param [in] unsigned int cell to calculate the key for
+ * @return Key of the cell
+ */
+IncrementalGridPlanner::Key IncrementalGridPlanner::calculateKey(
+    const unsigned int cell) const {
+  const double best = std::min(searchCells[cell].distance,
+                               searchCells[cell].lookahead);
+  return Key { best + heuristic(cell) + keyModifier, best };
+}
+
+/**
+ * @brief Octile distance from the start to a cell
+ * @param [in] unsigned int cell to estimate to
+ * @return double estimated cost in cells
+ */
+double IncrementalGridPlanner::heuristic(const unsigned int cell) const {
+  const int columns = std::abs(
+      static_cast<int>(grid->cellColumn(cell))
+          - static_cast<int>(grid->cellColumn(start)));
+  const int rows = std::abs(
+      static_cast<int>(grid->cellRow(cell))
+          - static_cast<int>(grid->cellRow(start)));
+  return (columns + rows) + (diagonalCost - 2) * std::min(columns, rows);
+}
+
+/**
+ * @brief Find the neighbors of a cell that are on the grid
+ * @param [in] unsigned int cell to find the neighbors of
+ * @param [out] unsigned int array of neighborCells (up to 8)
+ * @return unsigned int count of neighbors
+ */
+unsigned int IncrementalGridPlanner::neighbors(
+    const unsigned int cell, unsigned int neighborCells[8]) const {
+  const int column = grid->cellColumn(cell);
+  const int row = grid->cellRow(cell);
+  unsigned int count = 0;
+  for (int rowStep = -1; rowStep <= 1; rowStep++)
+    for (int columnStep = -1; columnStep <= 1; columnStep++)
+      if ((columnStep != 0 || rowStep != 0)
+          && grid->inBounds(column + columnStep, row + rowStep))
+        neighborCells[count++] = grid->cellIndex(column + columnStep,
+                                                 row + rowStep);
+  return count;
+}
+
+/**
+ * @brief Cost of a move between two neighboring cells
+ * @param [in] unsigned int from - cell the move starts in
+ * @param [in] unsigned int to - neighboring cell the move ends in
+ * @return double cost in cells (infinite if either cell is occupied, or a diagonal move
+ * would cut the corner of an occupied cell)
+ */
+double IncrementalGridPlanner::moveCost(const unsigned int from,
+                                        const unsigned int to) const {
+  if (grid->isOccupiedIndex(from) || grid->isOccupiedIndex(to))
+    return infinity;
+  const unsigned int fromColumn = grid->cellColumn(from);
+  const unsigned int fromRow = grid->cellRow(from);
+  const unsigned int toColumn = grid->cellColumn(to);
+  const unsigned int toRow = grid->cellRow(to);
+  if (fromColumn == toColumn || fromRow == toRow)
+    return 1.0;
+  if (grid->isOccupied(toColumn, fromRow) || grid->isOccupied(fromColumn, toRow))
+    return infinity;
+  return diagonalCost;
+}
+
+/**
+ * @brief Recompute a cell's lookahead distance from its neighbors, and its place in the open set
+ * @param [in] unsigned int cell to update
+ */
+void IncrementalGridPlanner::updateLookahead(const unsigned int cell) {
+  if (cell != goal) {
+    double best = infinity;
+    if (!grid->isOccupiedIndex(cell)) {
+      unsigned int neighborCells[8];
+      const unsigned int neighborCount = neighbors(cell, neighborCells);
+      for (unsigned int n = 0; n < neighborCount; n++)
+        best = std::min(best, moveCost(cell, neighborCells[n])
+            + searchCells[neighborCells[n]].distance);
+    }
+    searchCells[cell].lookahead = best;
+  }
+  updateOpen(cell);
+  return;
+}
+
+/**
+ * @brief Put an inconsistent cell in the open set (with its current key), or take a
+ * consistent cell out of it
+ * @param [in] unsigned int cell to update
+ */
+void IncrementalGridPlanner::updateOpen(const unsigned int cell) {
+  SearchCell &searchCell = searchCells[cell];
+  if (searchCell.distance != searchCell.lookahead) {
+    if (searchCell.heapPosition == notOpen) {
+      insertOpen(cell, calculateKey(cell));
+    } else {
+      openHeap[searchCell.heapPosition].key = calculateKey(cell);
+      siftUp(searchCell.heapPosition);
+      siftDown(searchCell.heapPosition);
+    }
+  } else if (searchCell.heapPosition != notOpen) {
+    removeOpen(cell);
+  }
+  return;
+}
+
+/**
+ * @brief Expand inconsistent cells until the start's distance to the goal is final
+ */
+void IncrementalGridPlanner::computeShortestRoute() {
+  unsigned int neighborCells[8];
+  while (!openHeap.empty()) {
+    const SearchCell &startCell = searchCells[start];
+    const OpenEntry top = openHeap.front();
+    if (!lessKey(top.key, calculateKey(start))
+        && startCell.lookahead == startCell.distance)
+      break;
+    expandedCount++;
+    const unsigned int cell = top.cell;
+    SearchCell &current = searchCells[cell];
+    const Key key = calculateKey(cell);
+    const unsigned int neighborCount = neighbors(cell, neighborCells);
+    if (lessKey(top.key, key)) {
+      // The key was out of date (the start has moved): re-queue the cell
+      openHeap.front().key = key;
+      siftDown(0);
+    } else if (current.distance > current.lookahead) {
+      // The cell got closer to the goal: its neighbors may get closer
+      // through it
+      current.distance = current.lookahead;
+      removeOpen(cell);
+      for (unsigned int n = 0; n < neighborCount; n++) {
+        const unsigned int neighbor = neighborCells[n];
+        if (neighbor != goal)
+          searchCells[neighbor].lookahead = std::min(
+              searchCells[neighbor].lookahead,
+              moveCost(neighbor, cell) + current.distance);
+        updateOpen(neighbor);
+      }
+    } else {
+      // The cell got further from the goal: it and any neighbors whose
+      // best route went through it have to look for another route
+      const double oldDistance = current.distance;
+      current.distance = infinity;
+      for (unsigned int n = 0; n < neighborCount; n++) {
+        const unsigned int neighbor = neighborCells[n];
+        if (searchCells[neighbor].lookahead
+            == moveCost(neighbor, cell) + oldDistance)
+          updateLookahead(neighbor);
+      }
+      updateLookahead(cell);
+    }
+  }
+  return;
+}
+
+/**
+ * @brief Follow the cheapest moves from the start to the goal
+ * @param [out] vector of unsigned int routeCells - every cell on the route, from start to goal
+ * @return bool indication of whether the goal can be reached from the start
+ */
+bool IncrementalGridPlanner::extractRoute(
+    std::vector<unsigned int> &routeCells) {
+  routeCells.clear();
+  if (searchCells[start].distance == infinity
+      || grid->isOccupiedIndex(start) || grid->isOccupiedIndex(goal))
+    return false;
+  unsigned int neighborCells[8];
+  unsigned int cell = start;
+  routeCells.push_back(cell);
+  while (cell != goal) {
+    double best = infinity;
+    unsigned int next = cell;
+    const unsigned int neighborCount = neighbors(cell, neighborCells);
+    for (unsigned int n = 0; n < neighborCount; n++) {
+      const double cost = moveCost(cell, neighborCells[n])
+          + searchCells[neighborCells[n]].distance;
+      if (cost < best) {
+        best = cost;
+        next = neighborCells[n];
+      }
+    }
+    if (best == infinity || routeCells.size() > searchCells.size()) {
+      routeCells.clear();
+      return false;
+    }
+    cell = next;
+    routeCells.push_back(cell);
+  }
+  routeCostFeet = searchCells[start].distance * grid->getCellSizeFeet();
+  return true;
+}
+
+/**
+ * @brief Add a cell to the open set
+ * @param [in] unsigned int cell to add
+ * @param [in] Key key of the cell
+ */
+void IncrementalGridPlanner::insertOpen(const unsigned int cell,
+                                        const Key &key) {
+  searchCells[cell].heapPosition = openHeap.size();
+  openHeap.push_back(OpenEntry { key, cell });
+  siftUp(searchCells[cell].heapPosition);
+  return;
+}
+
+/**
+ * @brief Take a cell out of the open set
+ * @param [in] unsigned int cell to take out (must be in the open set)
+ */
+void IncrementalGridPlanner::removeOpen(const unsigned int cell) {
+  const unsigned int position = searchCells[cell].heapPosition;
+  searchCells[cell].heapPosition = notOpen;
+  const OpenEntry last = openHeap.back();
+  openHeap.pop_back();
+  if (position < openHeap.size()) {
+    // Put the last entry where the removed one was, then restore the heap
+    openHeap[position] = last;
+    searchCells[last.cell].heapPosition = position;
+    siftUp(position);
+    siftDown(searchCells[last.cell].heapPosition);
+  }
+  return;
+}
+
+/**
+ * @brief Move an open set entry up the heap until its parent comes before it
+ * @param [in] unsigned int position of the entry on the heap
+ */
+void IncrementalGridPlanner::siftUp(unsigned int position) {
+  const OpenEntry entry = openHeap[position];
+  while (position > 0) {
+    const unsigned int parentPosition = (position - 1) / 2;
+    if (!lessKey(entry.key, openHeap[parentPosition].key))
+      break;
+    openHeap[position] = openHeap[parentPosition];
+    searchCells[openHeap[position].cell].heapPosition = position;
+    position = parentPosition;
+  }
+  openHeap[position] = entry;
+  searchCells[entry.cell].heapPosition = position;
+  return;
+}
+
+/**
+ * @brief Move an open set entry down the heap until neither child comes before it
+ * @param [in] unsigned int position of the entry on the heap
+ */
+void IncrementalGridPlanner::siftDown(unsigned int position) {
+  const OpenEntry entry = openHeap[position];
+  const unsigned int size = openHeap.size();
+  while (true) {
+    unsigned int child = 2 * position + 1;
+    if (child >= size)
+      break;
+    if (child + 1 < size
+        && lessKey(openHeap[child + 1].key, openHeap[child].key))
+      child++;
+    if (!lessKey(openHeap[child].key, entry.key))
+      break;
+    openHeap[position] = openHeap[child];
+    searchCells[openHeap[position].cell].heapPosition = position;
+    position = child;
+  }
+  openHeap[position] = entry;
+  searchCells[entry.cell].heapPosition = position;
+  return;
+}
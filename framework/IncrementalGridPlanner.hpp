@@ -0,0 +1,95 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file IncrementalGridPlanner.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief D* Lite search for shortest routes across an occupancy grid that change with the grid
+ *
+ * The incremental grid planner finds the same shortest routes as the GridPlanner (eight
+ * neighbors per cell, no cutting the corner of an occupied cell, octile distance heuristic),
+ * but keeps its search after a route has been planned.  When cells of the grid change, or the
+ * start of the route moves along it, the planner repairs only the part of the previous search
+ * that the change affects (D* Lite: the search runs from the goal back to the start, so the
+ * distances to the goal of cells unaffected by a change stay valid), so a small map update
+ * costs a fraction of planning the route again from scratch.
+ *
+ * The search data for each cell (distance to the goal, one-step lookahead distance, and
+ * position in the open set) is kept together in a flat array indexed like the grid's cells,
+ * and the open set is a binary heap in a vector, with each open cell on it once.
+ *
+ */
+#ifndef INCREMENTALGRIDPLANNER_HPP_
+#define INCREMENTALGRIDPLANNER_HPP_
+
+#include <vector>
+#include "OccupancyGrid.hpp"
+
+/** @brief Plans shortest routes across an occupancy grid, repairing them as the grid changes
+ */
+
+class IncrementalGridPlanner {
+ public:
+  IncrementalGridPlanner();
+  virtual ~IncrementalGridPlanner();
+  void setGrid(const OccupancyGrid &occupancyGrid);
+  const OccupancyGrid *getGrid() const;
+  bool plan(const unsigned int startColumn, const unsigned int startRow,
+            const unsigned int goalColumn, const unsigned int goalRow,
+            std::vector<unsigned int> &routeCells);
+  bool isPlannedFor(const unsigned int startColumn,
+                    const unsigned int startRow,
+                    const unsigned int goalColumn,
+                    const unsigned int goalRow) const;
+  bool update(const std::vector<unsigned int> &changedCells,
+              std::vector<unsigned int> &routeCells);
+  bool moveStart(const unsigned int startColumn, const unsigned int startRow,
+                 std::vector<unsigned int> &routeCells);
+  double getRouteCostFeet() const;
+  unsigned int getExpandedCount() const;
+
+ private:
+  // The priority of a cell in the open set, compared first by its first
+  // element, then by its second
+  struct Key {
+    double first;
+    double second;
+  };
+  // An entry in the open set
+  struct OpenEntry {
+    Key key;
+    unsigned int cell;
+  };
+  // The search data kept for each cell
+  struct SearchCell {
+    double distance;            // distance to the goal (g)
+    double lookahead;           // best distance through a neighbor (rhs)
+    unsigned int heapPosition;  // position in the open set, if open
+  };
+  static bool lessKey(const Key &a, const Key &b);
+  Key calculateKey(const unsigned int cell) const;
+  double heuristic(const unsigned int cell) const;
+  unsigned int neighbors(const unsigned int cell,
+                         unsigned int neighborCells[8]) const;
+  double moveCost(const unsigned int from, const unsigned int to) const;
+  void updateLookahead(const unsigned int cell);
+  void updateOpen(const unsigned int cell);
+  void computeShortestRoute();
+  bool extractRoute(std::vector<unsigned int> &routeCells);
+  void insertOpen(const unsigned int cell, const Key &key);
+  void removeOpen(const unsigned int cell);
+  void siftUp(unsigned int position);
+  void siftDown(unsigned int position);
+  const OccupancyGrid *grid;
+  std::vector<SearchCell> searchCells;  // search data, indexed like the grid
+  std::vector<OpenEntry> openHeap;      // open set, as a binary heap
+  bool planned;                         // a search is held for start/goal
+  unsigned int start;                   // cell the route starts in
+  unsigned int goal;                    // cell the route ends in
+  double keyModifier;                   // heuristic change as start moves
+  unsigned int expandedCount;           // cells expanded since last request
+  double routeCostFeet;                 // length of the last route found
+};
+
+#endif /* INCREMENTALGRIDPLANNER_HPP_ */
@@ -0,0 +1,202 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file Instrumentation.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Only named moves recorded; scaled points counted apart from generated ones
+ *
+ * @brief Counters and scoped timers for the stages of a chassis move
+ *
+ * The instrumentation records where the time of a move goes: how long trajectory generation
+ * and CSV export take, how many trajectory points are generated (and how many are derived by
+ * scaling another trajectory's points) and how many bytes are written, and the time of the
+ * whole move.  The stages of the motion pipeline are marked with the MCSF_MOVE_SCOPE,
+ * MCSF_SCOPED_TIMER and MCSF_COUNT macros, which add to counters kept for the current thread,
+ * with no locking; when the outermost move scope on the thread ends, the move's counters are
+ * added to its chassis's totals (under a lock, once per move).  The totals and the last move
+ * of each chassis can then be read, or written to a log.  Chassis are told apart by name: a
+ * move with no chassis name, and any stage run outside a move, is not recorded, and chassis
+ * given the same name share their counters.
+ *
+ * The macros only record anything when the framework is built with MCSF_INSTRUMENT defined;
+ * otherwise they compile to nothing, so the instrumentation costs nothing in builds that do
+ * not want it.  The query functions are always available, and report no moves when the
+ * instrumentation is compiled out.
+ *
+ */
+#include <map>
+#include <mutex>
+#include "Instrumentation.hpp"
+
+namespace {
+// The move in progress on this thread: its chassis, its counters so far,
+// and how many move scopes are open (only the outermost one records)
+thread_local std::string moveChassisName;
+thread_local Instrumentation::Counters moveCounters = { 0, 0, 0, 0, 0, 0, 0 };
+thread_local unsigned int moveScopeDepth = 0;
+
+// Every named chassis's counters, by chassis name
+std::mutex statsMutex;
+std::map<std::string, Instrumentation::ChassisStats> chassisStats;
+
+/**
+ * @brief Nanoseconds elapsed since a time
+ * @param [in] time_point start time
+ * @return unsigned long long nanoseconds from the start time to now
+ */
+unsigned long long elapsedNS(
+    const std::chrono::steady_clock::time_point &start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+/**
+ * @brief Open a move scope; the outermost one on a thread starts a move for its chassis
+ * @param [in] string chassisName of the chassis making the move (the move is not recorded
+ * if it is empty)
+ */
+Instrumentation::MoveScope::MoveScope(const std::string &chassisName)
+    : outermost(moveScopeDepth == 0),
+      recording(outermost && !chassisName.empty()),
+      start(std::chrono::steady_clock::now()) {
+  if (outermost) {
+    moveChassisName = chassisName;
+    moveCounters = Counters { 0, 0, 0, 0, 0, 0, 0 };
+  }
+  moveScopeDepth++;
+}
+
+/**
+ * @brief Close a move scope; the outermost named one adds the move to its chassis's counters
+ */
+Instrumentation::MoveScope::~MoveScope() {
+  moveScopeDepth--;
+  if (recording) {
+    moveCounters.moves = 1;
+    moveCounters.moveNS = elapsedNS(start);
+    record(moveChassisName, moveCounters);
+  }
+}
+
+/**
+ * @brief Start timing
+ * @param [in] pointer to the Counters member the time is added to
+ */
+Instrumentation::ScopedTimer::ScopedTimer(
+    unsigned long long Counters::*timerCounter)
+    : counter(timerCounter),
+      start(std::chrono::steady_clock::now()) {
+}
+
+/**
+ * @brief Stop timing, adding the time to the counter
+ */
+Instrumentation::ScopedTimer::~ScopedTimer() {
+  count(counter, elapsedNS(start));
+}
+
+/**
+ * @brief Report whether the instrumentation was compiled into the framework
+ * @return bool indication of whether MCSF_INSTRUMENT was defined
+ */
+bool Instrumentation::isEnabled() {
+#ifdef MCSF_INSTRUMENT
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief Add an amount to a counter of the move in progress on this thread (outside a move,
+ * nothing is counted)
+ * @param [in] pointer to the Counters member the amount is added to
+ * @param [in] unsigned long long amount to add
+ */
+void Instrumentation::count(unsigned long long Counters::*counter,
+                            const unsigned long long amount) {
+  if (moveScopeDepth > 0)
+    moveCounters.*counter += amount;
+  return;
+}
+
+/**
+ * @brief Get the names of the chassis with recorded moves
+ * @return vector of string chassis names, in order
+ */
+std::vector<std::string> Instrumentation::getChassisNames() {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  std::vector<std::string> names;
+  for (const auto &entry : chassisStats)
+    names.push_back(entry.first);
+  return names;
+}
+
+/**
+ * @brief Get a chassis's counters
+ * @param [in] string chassisName of the chassis
+ * @param [out] ChassisStats stats - the chassis's totals and last move
+ * @return bool indication of whether any move has been recorded for the chassis
+ */
+bool Instrumentation::getChassisStats(const std::string &chassisName,
+                                      ChassisStats &stats) {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  const auto entry = chassisStats.find(chassisName);
+  if (entry == chassisStats.end())
+    return false;
+  stats = entry->second;
+  return true;
+}
+
+/**
+ * @brief Forget every chassis's counters
+ */
+void Instrumentation::reset() {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  chassisStats.clear();
+  return;
+}
+
+/**
+ * @brief Write each chassis's totals and last move cost breakdown
+ * @param [in/out] ostream output to write to (such as a log)
+ */
+void Instrumentation::report(std::ostream &output) {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  for (const auto &entry : chassisStats) {
+    const Counters *counters[2] = { &entry.second.total,
+        &entry.second.lastMove };
+    const char *labels[2] = { "total", "last move" };
+    for (unsigned int i = 0; i < 2; i++)
+      output << "Chassis \"" << entry.first << "\" " << labels[i] << ": "
+             << counters[i]->moves << " moves, " << counters[i]->moveNS / 1000
+             << " us; generation " << counters[i]->generationNS / 1000
+             << " us, " << counters[i]->pointsGenerated << " points, "
+             << counters[i]->pointsScaled << " scaled; export "
+             << counters[i]->exportNS / 1000 << " us, "
+             << counters[i]->bytesWritten << " bytes" << std::endl;
+  }
+  return;
+}
+
+/**
+ * @brief Add a move's counters to a chassis's totals, and make them its last move
+ * @param [in] string chassisName of the chassis
+ * @param [in] Counters move - counters of the move
+ */
+void Instrumentation::record(const std::string &chassisName,
+                             const Counters &move) {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  ChassisStats &stats = chassisStats[chassisName];
+  stats.total.moves += move.moves;
+  stats.total.pointsGenerated += move.pointsGenerated;
+  stats.total.pointsScaled += move.pointsScaled;
+  stats.total.bytesWritten += move.bytesWritten;
+  stats.total.generationNS += move.generationNS;
+  stats.total.exportNS += move.exportNS;
+  stats.total.moveNS += move.moveNS;
+  stats.lastMove = move;
+  return;
+}
@@ -0,0 +1,115 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file Instrumentation.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Only named moves recorded; scaled points counted apart from generated ones
+ *
+ * @brief Counters and scoped timers for the stages of a chassis move
+ *
+ * The instrumentation records where the time of a move goes: how long trajectory generation
+ * and CSV export take, how many trajectory points are generated (and how many are derived by
+ * scaling another trajectory's points) and how many bytes are written, and the time of the
+ * whole move.  The stages of the motion pipeline are marked with the MCSF_MOVE_SCOPE,
+ * MCSF_SCOPED_TIMER and MCSF_COUNT macros, which add to counters kept for the current thread,
+ * with no locking; when the outermost move scope on the thread ends, the move's counters are
+ * added to its chassis's totals (under a lock, once per move).  The totals and the last move
+ * of each chassis can then be read, or written to a log.  Chassis are told apart by name: a
+ * move with no chassis name, and any stage run outside a move, is not recorded, and chassis
+ * given the same name share their counters.
+ *
+ * The macros only record anything when the framework is built with MCSF_INSTRUMENT defined;
+ * otherwise they compile to nothing, so the instrumentation costs nothing in builds that do
+ * not want it.  The query functions are always available, and report no moves when the
+ * instrumentation is compiled out.
+ *
+ */
+#ifndef INSTRUMENTATION_HPP_
+#define INSTRUMENTATION_HPP_
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef MCSF_INSTRUMENT
+#define MCSF_INSTRUMENT_JOIN2(a, b) a##b
+#define MCSF_INSTRUMENT_JOIN(a, b) MCSF_INSTRUMENT_JOIN2(a, b)
+// Attribute the stages run in the rest of this scope to a chassis's move
+#define MCSF_MOVE_SCOPE(chassisName) \
+  Instrumentation::MoveScope MCSF_INSTRUMENT_JOIN(mcsfMoveScope, __LINE__)( \
+      chassisName)
+// Add the time taken by the rest of this scope to a counter
+#define MCSF_SCOPED_TIMER(counter) \
+  Instrumentation::ScopedTimer MCSF_INSTRUMENT_JOIN(mcsfScopedTimer, \
+      __LINE__)(&Instrumentation::Counters::counter)
+// Add an amount to a counter
+#define MCSF_COUNT(counter, amount) \
+  Instrumentation::count(&Instrumentation::Counters::counter, (amount))
+#else
+#define MCSF_MOVE_SCOPE(chassisName)
+#define MCSF_SCOPED_TIMER(counter)
+#define MCSF_COUNT(counter, amount)
+#endif
+
+/** @brief Per-chassis counters and timers for the stages of the motion pipeline
+ */
+
+class Instrumentation {
+ public:
+  // The counters kept for each stage of a move
+  struct Counters {
+    unsigned long long moves;            // moves counted
+    unsigned long long pointsGenerated;  // trajectory points generated
+    unsigned long long pointsScaled;     // trajectory points scaled copies
+    unsigned long long bytesWritten;     // bytes of CSV output written
+    unsigned long long generationNS;     // time generating trajectories
+    unsigned long long exportNS;         // time writing CSV output
+    unsigned long long moveNS;           // time of the whole move
+  };
+  // The counters of a chassis, over all its moves and for its last move
+  struct ChassisStats {
+    Counters total;
+    Counters lastMove;
+  };
+
+  // Attributes the stages run during its lifetime to a chassis's move
+  class MoveScope {
+   public:
+    explicit MoveScope(const std::string &chassisName);
+    ~MoveScope();
+    MoveScope(const MoveScope &) = delete;
+    MoveScope &operator=(const MoveScope &) = delete;
+   private:
+    bool outermost;  // whether this scope starts the move
+    bool recording;  // whether this scope records the move (it is named)
+    std::chrono::steady_clock::time_point start;  // when the scope opened
+  };
+
+  // Adds its lifetime to a counter
+  class ScopedTimer {
+   public:
+    explicit ScopedTimer(unsigned long long Counters::*counter);
+    ~ScopedTimer();
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+   private:
+    unsigned long long Counters::*counter;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  static bool isEnabled();
+  static void count(unsigned long long Counters::*counter,
+                    const unsigned long long amount);
+  static std::vector<std::string> getChassisNames();
+  static bool getChassisStats(const std::string &chassisName,
+                              ChassisStats &stats);
+  static void reset();
+  static void report(std::ostream &output);
+
+ private:
+  static void record(const std::string &chassisName, const Counters &move);
+};
+
+#endif /* INSTRUMENTATION_HPP_ */
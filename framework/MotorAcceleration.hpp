@@ -4,6 +4,7 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
+ * @date Oct 19, 2026 - Made header-only, constexpr and trivially copyable
  *
  * @brief A class for a strictly typed representation of motor acceleration
  *
@@ -19,6 +20,7 @@
 #ifndef MOTORACCELERATION_HPP_
 #define MOTORACCELERATION_HPP_
 
+#include <type_traits>
 #include "ChassisAcceleration.hpp"
 
 /** @brief A class to provide a strict type for specifying motor acceleration
@@ -26,15 +28,124 @@
 
 class MotorAcceleration {
  public:
-  MotorAcceleration();
-  virtual ~MotorAcceleration();
-  void setRotationsPerMinutePerSecond(const double rate);
-  void setFromChassisAccelerationByRotPerMovementFoot(
-      ChassisAcceleration chassisAcceleration, double rotPerMovementFoot);
-  double getRotationsPerMinutePerSecond();
+  constexpr MotorAcceleration()
+      : accelAsRotationsPerMinutePerSecond(0.0) {
+  }
+
+  /**
+   * @brief Make a motor acceleration from a value in Rotations per Minute per Second
+   * @param [in] double rate in RPM/s
+   * @return MotorAcceleration holding that acceleration
+   */
+  static constexpr MotorAcceleration fromRotationsPerMinutePerSecond(
+      const double rate) {
+    return MotorAcceleration(rate);
+  }
+
+  /**
+   * @brief Make a motor acceleration from a value in Rotations per Second per Second
+   * @param [in] double rate in RPS/s
+   * @return MotorAcceleration holding that acceleration
+   */
+  static constexpr MotorAcceleration fromRotationsPerSecondPerSecond(
+      const double rate) {
+    return MotorAcceleration(rate * 60);
+  }
+
+  /**
+   * @brief Make a motor acceleration from a chassis acceleration by Rotations per Movement Foot
+   * @param [in] ChassisAcceleration chassisAcceleration specifies a linear physical acceleration
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   * @return MotorAcceleration holding the equivalent acceleration
+   */
+  static constexpr MotorAcceleration
+  fromChassisAccelerationByRotPerMovementFoot(
+      const ChassisAcceleration &chassisAcceleration,
+      const double rotPerMovementFoot) {
+    return MotorAcceleration(
+        chassisAcceleration.getFeetPerSecondPerSecond() * 60
+            * rotPerMovementFoot);
+  }
+
+  /**
+   * @brief Set motor acceleration in units of Rotations per Minute per Second
+   * @param [in] double rate representing a motor acceleration
+   */
+  constexpr void setRotationsPerMinutePerSecond(const double rate) {
+    accelAsRotationsPerMinutePerSecond = rate;
+  }
+
+  /**
+   * @brief Set motor acceleration in units of Rotations per Second per Second
+   * @param [in] double rate representing a motor acceleration
+   */
+  constexpr void setRotationsPerSecondPerSecond(const double rate) {
+    accelAsRotationsPerMinutePerSecond = rate * 60;
+  }
+
+  /**
+   * @brief Convert from a ChassisAcceleration to motor rotations by Rotations per Movement Foot
+   * @param [in] ChassisAcceleration chassisAcceleration specifies a linear physical acceleration
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   */
+  constexpr void setFromChassisAccelerationByRotPerMovementFoot(
+      const ChassisAcceleration &chassisAcceleration,
+      const double rotPerMovementFoot) {
+    accelAsRotationsPerMinutePerSecond = chassisAcceleration
+        .getFeetPerSecondPerSecond() * 60 * rotPerMovementFoot;
+  }
+
+  /**
+   * @brief Get motor acceleration in units of Rotations per Minute per Second
+   * @return double representing a motor acceleration
+   */
+  constexpr double getRotationsPerMinutePerSecond() const {
+    return accelAsRotationsPerMinutePerSecond;
+  }
+
+  /**
+   * @brief Get motor acceleration in units of Rotations per Second per Second
+   * @return double representing a motor acceleration
+   */
+  constexpr double getRotationsPerSecondPerSecond() const {
+    return accelAsRotationsPerMinutePerSecond / 60;
+  }
+
+  /**
+   * @brief Convert to a chassis acceleration by Rotations per Movement Foot
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   * @return ChassisAcceleration the equivalent linear physical acceleration
+   */
+  constexpr ChassisAcceleration getChassisAccelerationByRotPerMovementFoot(
+      const double rotPerMovementFoot) const {
+    return ChassisAcceleration::fromFeetPerSecondPerSecond(
+        accelAsRotationsPerMinutePerSecond / 60 / rotPerMovementFoot);
+  }
+
+  // Arithmetic is only between values of the same type (or by a scale
+  // factor), so quantities of different dimensions cannot be mixed
+  constexpr MotorAcceleration operator+(const MotorAcceleration &ma) const {
+    return MotorAcceleration(
+        accelAsRotationsPerMinutePerSecond
+            + ma.accelAsRotationsPerMinutePerSecond);
+  }
+  constexpr MotorAcceleration operator-(const MotorAcceleration &ma) const {
+    return MotorAcceleration(
+        accelAsRotationsPerMinutePerSecond
+            - ma.accelAsRotationsPerMinutePerSecond);
+  }
+  constexpr MotorAcceleration operator*(const double scale) const {
+    return MotorAcceleration(accelAsRotationsPerMinutePerSecond * scale);
+  }
 
  private:
+  constexpr explicit MotorAcceleration(const double rate)
+      : accelAsRotationsPerMinutePerSecond(rate) {
+  }
   double accelAsRotationsPerMinutePerSecond;
 };
 
+static_assert(std::is_trivially_copyable<MotorAcceleration>::value,
+              "MotorAcceleration must be trivially copyable");
+
 #endif /* MOTORACCELERATION_HPP_ */
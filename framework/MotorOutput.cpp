@@ -0,0 +1,33 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file MotorOutput.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief A base class for the destinations of executed trajectory points
+ *
+ * Trajectory execution releases one trajectory point per iteration period to a motor
+ * output.  What a motor output does with the point depends on the hardware; a motor
+ * controller would be commanded with the point's position and velocity, while a simulated
+ * motor simply tracks the commanded motion.  Specific motor outputs are intended to be
+ * instantiated from class definitions derived from this base class.
+ *
+ */
+#include "MotorOutput.hpp"
+
+MotorOutput::MotorOutput() {
+}
+
+MotorOutput::~MotorOutput() {
+}
+
+/**
+ * @brief A "filler" method in the base class that discards the point; redefined in derived classes
+ * @param [in] TrajectoryPoint trajectoryPoint released for execution
+ */
+void MotorOutput::outputTrajectoryPoint(
+    const TrajectoryPoint &/*trajectoryPoint*/) {
+  return;
+}
@@ -5,6 +5,7 @@
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
  * @date Mar 9, 2017 - Added minus operator
+ * @date Oct 19, 2026 - Made header-only, constexpr and trivially copyable
  *
  * @brief Creates a defined type for a position based on a motor encoder
  *
@@ -16,21 +17,93 @@
 #ifndef MOTORPOSITION_HPP_
 #define MOTORPOSITION_HPP_
 
+#include <type_traits>
+
 /** @brief Creates a defined type for a position based on a motor encoder
  */
 
 class MotorPosition {
  public:
-  MotorPosition();
-  virtual ~MotorPosition();
-  void setRotations(const double count);
-  void setFromDistanceFeetByRotPerMovementFoot(
-      const double distanceFeet, const double rotPerMovementFoot);
-  double getRotations();
-  MotorPosition operator-(const MotorPosition& mp);
+  constexpr MotorPosition()
+      : rotationCount(0.0) {
+  }
+
+  /**
+   * @brief Make a motor position from a number of rotations
+   * @param [in] double count of rotations
+   * @return MotorPosition holding that position
+   */
+  static constexpr MotorPosition fromRotations(const double count) {
+    return MotorPosition(count);
+  }
+
+  /**
+   * @brief Make a motor position from a chassis movement distance
+   * @param [in] double distanceFeet of chassis movement
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   * @return MotorPosition holding the equivalent position
+   */
+  static constexpr MotorPosition fromDistanceFeetByRotPerMovementFoot(
+      const double distanceFeet, const double rotPerMovementFoot) {
+    return MotorPosition(distanceFeet * rotPerMovementFoot);
+  }
+
+  /**
+   * @brief Set the motor position in rotations
+   * @param [in] double count of rotations
+   */
+  constexpr void setRotations(const double count) {
+    rotationCount = count;
+  }
+
+  /**
+   * @brief Set the motor position from a chassis movement distance
+   * @param [in] double distanceFeet of chassis movement
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   */
+  constexpr void setFromDistanceFeetByRotPerMovementFoot(
+      const double distanceFeet, const double rotPerMovementFoot) {
+    rotationCount = distanceFeet * rotPerMovementFoot;
+  }
+
+  /**
+   * @brief Get the motor position in rotations
+   * @return double count of rotations
+   */
+  constexpr double getRotations() const {
+    return rotationCount;
+  }
+
+  /**
+   * @brief Get the chassis movement distance equivalent to the motor position
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   * @return double distance in feet
+   */
+  constexpr double getDistanceFeetByRotPerMovementFoot(
+      const double rotPerMovementFoot) const {
+    return rotationCount / rotPerMovementFoot;
+  }
+
+  // Arithmetic is only between values of the same type (or by a scale
+  // factor), so quantities of different dimensions cannot be mixed
+  constexpr MotorPosition operator+(const MotorPosition &mp) const {
+    return MotorPosition(rotationCount + mp.rotationCount);
+  }
+  constexpr MotorPosition operator-(const MotorPosition &mp) const {
+    return MotorPosition(rotationCount - mp.rotationCount);
+  }
+  constexpr MotorPosition operator*(const double scale) const {
+    return MotorPosition(rotationCount * scale);
+  }
 
  private:
+  constexpr explicit MotorPosition(const double count)
+      : rotationCount(count) {
+  }
   double rotationCount;
 };
 
+static_assert(std::is_trivially_copyable<MotorPosition>::value,
+              "MotorPosition must be trivially copyable");
+
 #endif /* MOTORPOSITION_HPP_ */
@@ -4,6 +4,7 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
+ * @date Oct 19, 2026 - Made header-only, constexpr and trivially copyable
  *
  * @brief A class to define a strict type for motor velocities
  *
@@ -18,21 +19,123 @@
 #ifndef MOTORVELOCITY_HPP_
 #define MOTORVELOCITY_HPP_
 
+#include <type_traits>
 #include "ChassisVelocity.hpp"
 /** @brief The MotorVelocity class is a strict type for motor velocities
  */
 
 class MotorVelocity {
  public:
-  MotorVelocity();
-  virtual ~MotorVelocity();
-  void setRotationsPerMinute(const double rate);
-  void setFromChassisVelocityByRotPerMovementFoot(
-      ChassisVelocity chassisVelocity, double rotPerMovementFoot);
-  double getRotationsPerMinute();
+  constexpr MotorVelocity()
+      : velAsRotationsPerMinute(0.0) {
+  }
+
+  /**
+   * @brief Make a motor velocity from a value in Rotations per Minute
+   * @param [in] double rate in RPM
+   * @return MotorVelocity holding that velocity
+   */
+  static constexpr MotorVelocity fromRotationsPerMinute(const double rate) {
+    return MotorVelocity(rate);
+  }
+
+  /**
+   * @brief Make a motor velocity from a value in Rotations per Second
+   * @param [in] double rate in RPS
+   * @return MotorVelocity holding that velocity
+   */
+  static constexpr MotorVelocity fromRotationsPerSecond(const double rate) {
+    return MotorVelocity(rate * 60);
+  }
+
+  /**
+   * @brief Make a motor velocity from a chassis velocity by Rotations per Movement Foot
+   * @param [in] ChassisVelocity chassisVelocity specifies a linear physical velocity
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   * @return MotorVelocity holding the equivalent velocity
+   */
+  static constexpr MotorVelocity fromChassisVelocityByRotPerMovementFoot(
+      const ChassisVelocity &chassisVelocity,
+      const double rotPerMovementFoot) {
+    return MotorVelocity(
+        chassisVelocity.getFeetPerSecond() * 60 * rotPerMovementFoot);
+  }
+
+  /**
+   * @brief Set motor velocity in units of Rotations per Minute
+   * @param [in] double rate representing a motor velocity
+   */
+  constexpr void setRotationsPerMinute(const double rate) {
+    velAsRotationsPerMinute = rate;
+  }
+
+  /**
+   * @brief Set motor velocity in units of Rotations per Second
+   * @param [in] double rate representing a motor velocity
+   */
+  constexpr void setRotationsPerSecond(const double rate) {
+    velAsRotationsPerMinute = rate * 60;
+  }
+
+  /**
+   * @brief Convert from a ChassVelocity to motor rotations by Rotations per Movement Foot
+   * @param [in] ChassisVelocity chassisVelocity specifies a linear physical velocity
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   */
+  constexpr void setFromChassisVelocityByRotPerMovementFoot(
+      const ChassisVelocity &chassisVelocity,
+      const double rotPerMovementFoot) {
+    velAsRotationsPerMinute = chassisVelocity.getFeetPerSecond() * 60
+        * rotPerMovementFoot;
+  }
+
+  /**
+   * @brief Get motor velocity in units of Rotations per Minute
+   * @return double representing a motor velocity
+   */
+  constexpr double getRotationsPerMinute() const {
+    return velAsRotationsPerMinute;
+  }
+
+  /**
+   * @brief Get motor velocity in units of Rotations per Second
+   * @return double representing a motor velocity
+   */
+  constexpr double getRotationsPerSecond() const {
+    return velAsRotationsPerMinute / 60;
+  }
+
+  /**
+   * @brief Convert to a chassis velocity by Rotations per Movement Foot
+   * @param [in] double rotPerMovementFoot is the conversion factor from movement feet to rotations
+   * @return ChassisVelocity the equivalent linear physical velocity
+   */
+  constexpr ChassisVelocity getChassisVelocityByRotPerMovementFoot(
+      const double rotPerMovementFoot) const {
+    return ChassisVelocity::fromFeetPerSecond(
+        velAsRotationsPerMinute / 60 / rotPerMovementFoot);
+  }
+
+  // Arithmetic is only between values of the same type (or by a scale
+  // factor), so quantities of different dimensions cannot be mixed
+  constexpr MotorVelocity operator+(const MotorVelocity &mv) const {
+    return MotorVelocity(velAsRotationsPerMinute + mv.velAsRotationsPerMinute);
+  }
+  constexpr MotorVelocity operator-(const MotorVelocity &mv) const {
+    return MotorVelocity(velAsRotationsPerMinute - mv.velAsRotationsPerMinute);
+  }
+  constexpr MotorVelocity operator*(const double scale) const {
+    return MotorVelocity(velAsRotationsPerMinute * scale);
+  }
 
  private:
+  constexpr explicit MotorVelocity(const double rate)
+      : velAsRotationsPerMinute(rate) {
+  }
   double velAsRotationsPerMinute;
 };
 
+static_assert(std::is_trivially_copyable<MotorVelocity>::value,
+              "MotorVelocity must be trivially copyable");
+
 #endif /* MOTORVELOCITY_HPP_ */
@@ -0,0 +1,220 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file OccupancyGrid.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A 2D map of a field as a grid of free and occupied square cells
+ *
+ * The occupancy grid divides a field into square cells of a fixed size (in feet), each either
+ * free or occupied by an obstacle.  Cells are stored row by row in one flat array and are
+ * addressed either by column and row or by their index in that array (row * width + column),
+ * so planners can keep their own per-cell data in flat arrays indexed the same way.
+ *
+ * A grid can be loaded from a plain text file: an optional set of comment lines starting
+ * with '#', a line holding the width (columns), height (rows), and cell size in feet, and
+ * then one line per row, from row 0, with one character per column - '.' for a free cell and
+ * any other character (usually '#') for an occupied cell.
+ *
+ */
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "OccupancyGrid.hpp"
+
+OccupancyGrid::OccupancyGrid()
+    : width(0),
+      height(0),
+      cellSizeFeet(0.0),
+      cells() {
+}
+
+OccupancyGrid::~OccupancyGrid() {
+}
+
+/**
+ * @brief Set the size of the grid, with every cell free
+ * @param [in] unsigned int columns across the grid
+ * @param [in] unsigned int rows down the grid
+ * @param [in] double cellFeet length of each cell's side in feet
+ */
+void OccupancyGrid::resize(const unsigned int columns,
+                           const unsigned int rows, const double cellFeet) {
+  width = columns;
+  height = rows;
+  cellSizeFeet = cellFeet;
+  cells.assign(static_cast<std::vector<unsigned char>::size_type>(columns)
+      * rows, 0);
+  return;
+}
+
+/**
+ * @brief Load the grid from a text file (see the class description for the format)
+ * @param [in] string gridFileName of the file to load
+ * @return bool indication of whether the file was read and had every row it declared
+ */
+bool OccupancyGrid::loadFromFile(const std::string &gridFileName) {
+  std::ifstream gridFile(gridFileName);
+  if (!gridFile)
+    return false;
+
+  // Skip any comment lines, then read the grid dimensions
+  std::string line;
+  do {
+    if (!std::getline(gridFile, line))
+      return false;
+  } while (line.empty() || line[0] == '#');
+  std::istringstream dimensions(line);
+  unsigned int columns = 0, rows = 0;
+  double cellFeet = 0.0;
+  if (!(dimensions >> columns >> rows >> cellFeet) || columns == 0
+      || rows == 0 || cellFeet <= 0)
+    return false;
+  resize(columns, rows, cellFeet);
+
+  // Read each row, one character per column; a short row is free past
+  // its end
+  for (unsigned int row = 0; row < rows; row++) {
+    if (!std::getline(gridFile, line))
+      return false;
+    unsigned int rowColumns = std::min<unsigned int>(line.size(), columns);
+    for (unsigned int column = 0; column < rowColumns; column++)
+      cells[cellIndex(column, row)] = (line[column] == '.') ? 0 : 1;
+  }
+  return true;
+}
+
+/**
+ * @brief Get the number of columns in the grid
+ * @return unsigned int width of the grid in cells
+ */
+unsigned int OccupancyGrid::getWidth() const {
+  return width;
+}
+
+/**
+ * @brief Get the number of rows in the grid
+ * @return unsigned int height of the grid in cells
+ */
+unsigned int OccupancyGrid::getHeight() const {
+  return height;
+}
+
+/**
+ * @brief Get the number of cells in the grid
+ * @return unsigned int cell count (width times height)
+ */
+unsigned int OccupancyGrid::getCellCount() const {
+  return cells.size();
+}
+
+/**
+ * @brief Get the length of each cell's side
+ * @return double cell size in feet
+ */
+double OccupancyGrid::getCellSizeFeet() const {
+  return cellSizeFeet;
+}
+
+/**
+ * @brief Check whether a column and row are on the grid
+ * @param [in] int column to check (may be negative)
+ * @param [in] int row to check (may be negative)
+ * @return bool indication of whether the cell is on the grid
+ */
+bool OccupancyGrid::inBounds(const int column, const int row) const {
+  return column >= 0 && row >= 0 && static_cast<unsigned int>(column) < width
+      && static_cast<unsigned int>(row) < height;
+}
+
+/**
+ * @brief Get the flat index of a cell
+ * @param [in] unsigned int column of the cell
+ * @param [in] unsigned int row of the cell
+ * @return unsigned int index of the cell (row * width + column)
+ */
+unsigned int OccupancyGrid::cellIndex(const unsigned int column,
+                                      const unsigned int row) const {
+  return row * width + column;
+}
+
+/**
+ * @brief Get the column of a cell from its flat index
+ * @param [in] unsigned int index of the cell
+ * @return unsigned int column of the cell
+ */
+unsigned int OccupancyGrid::cellColumn(const unsigned int index) const {
+  return index % width;
+}
+
+/**
+ * @brief Get the row of a cell from its flat index
+ * @param [in] unsigned int index of the cell
+ * @return unsigned int row of the cell
+ */
+unsigned int OccupancyGrid::cellRow(const unsigned int index) const {
+  return index / width;
+}
+
+/**
+ * @brief Mark a cell as occupied or free (cells off the grid are ignored)
+ * @param [in] unsigned int column of the cell
+ * @param [in] unsigned int row of the cell
+ * @param [in] bool occupied - true for an obstacle, false for free space
+ */
+void OccupancyGrid::setOccupied(const unsigned int column,
+                                const unsigned int row, const bool occupied) {
+  if (column < width && row < height)
+    cells[cellIndex(column, row)] = occupied ? 1 : 0;
+  return;
+}
+
+/**
+ * @brief Mark a rectangle of cells as occupied or free (clipped to the grid)
+ * @param [in] unsigned int column of the rectangle's first cell
+ * @param [in] unsigned int row of the rectangle's first cell
+ * @param [in] unsigned int columns across the rectangle
+ * @param [in] unsigned int rows down the rectangle
+ * @param [in] bool occupied - true for an obstacle, false for free space
+ */
+void OccupancyGrid::setOccupiedRectangle(const unsigned int column,
+                                         const unsigned int row,
+                                         const unsigned int columns,
+                                         const unsigned int rows,
+                                         const bool occupied) {
+  for (unsigned int r = row; r < row + rows && r < height; r++)
+    for (unsigned int c = column; c < column + columns && c < width; c++)
+      cells[cellIndex(c, r)] = occupied ? 1 : 0;
+  return;
+}
+
+/**
+ * @brief Check whether a cell is occupied (cells off the grid count as occupied)
+ * @param [in] unsigned int column of the cell
+ * @param [in] unsigned int row of the cell
+ * @return bool indication of whether the cell is occupied
+ */
+bool OccupancyGrid::isOccupied(const unsigned int column,
+                               const unsigned int row) const {
+  if (column >= width || row >= height)
+    return true;
+  return cells[cellIndex(column, row)] != 0;
+}
+
+/**
+ * @brief Check whether a cell is occupied, by its flat index (which must be on the grid)
+ * @param [in] unsigned int index of the cell
+ * @return bool indication of whether the cell is occupied
+ */
+bool OccupancyGrid::isOccupiedIndex(const unsigned int index) const {
+  return cells[index] != 0;
+}
+
+/**
+ * @brief Read the cells in place, row by row (for planners scanning many cells)
+ * @return unsigned char pointer to the first cell; each cell is 1 if occupied, 0 if free
+ */
+const unsigned char *OccupancyGrid::getCells() const {
+  return cells.data();
+}
@@ -0,0 +1,62 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file OccupancyGrid.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A 2D map of a field as a grid of free and occupied square cells
+ *
+ * The occupancy grid divides a field into square cells of a fixed size (in feet), each either
+ * free or occupied by an obstacle.  Cells are stored row by row in one flat array and are
+ * addressed either by column and row or by their index in that array (row * width + column),
+ * so planners can keep their own per-cell data in flat arrays indexed the same way.
+ *
+ * A grid can be loaded from a plain text file: an optional set of comment lines starting
+ * with '#', a line holding the width (columns), height (rows), and cell size in feet, and
+ * then one line per row, from row 0, with one character per column - '.' for a free cell and
+ * any other character (usually '#') for an occupied cell.
+ *
+ */
+#ifndef OCCUPANCYGRID_HPP_
+#define OCCUPANCYGRID_HPP_
+
+#include <string>
+#include <vector>
+
+/** @brief A field map of free and occupied square cells
+ */
+
+class OccupancyGrid {
+ public:
+  OccupancyGrid();
+  virtual ~OccupancyGrid();
+  void resize(const unsigned int columns, const unsigned int rows,
+              const double cellFeet);
+  bool loadFromFile(const std::string &gridFileName);
+  unsigned int getWidth() const;
+  unsigned int getHeight() const;
+  unsigned int getCellCount() const;
+  double getCellSizeFeet() const;
+  bool inBounds(const int column, const int row) const;
+  unsigned int cellIndex(const unsigned int column,
+                         const unsigned int row) const;
+  unsigned int cellColumn(const unsigned int index) const;
+  unsigned int cellRow(const unsigned int index) const;
+  void setOccupied(const unsigned int column, const unsigned int row,
+                   const bool occupied);
+  void setOccupiedRectangle(const unsigned int column, const unsigned int row,
+                            const unsigned int columns,
+                            const unsigned int rows, const bool occupied);
+  bool isOccupied(const unsigned int column, const unsigned int row) const;
+  bool isOccupiedIndex(const unsigned int index) const;
+  const unsigned char *getCells() const;
+
+ private:
+  unsigned int width;             // number of columns
+  unsigned int height;            // number of rows
+  double cellSizeFeet;            // length of a cell's side
+  std::vector<unsigned char> cells;  // 1 for occupied, row by row
+};
+
+#endif /* OCCUPANCYGRID_HPP_ */
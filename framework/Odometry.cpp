@@ -0,0 +1,291 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file Odometry.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Shares its arc step with the drive simulator; rejects unset gearing
+ * @date Oct 19, 2026 - Configures from a const TankDrive
+ *
+ * @brief Dead-reckoning chassis pose from a pair of left and right trajectories
+ *
+ * Odometry turns the left and right trajectories produced for a tank drive move into a time
+ * series of chassis poses (x, y, heading), using the drive width and the motor rotations per
+ * foot of movement.  The pose series is kept as a structure of arrays (one contiguous array per
+ * quantity) and computed in a few straight passes over those arrays, so the element-wise work
+ * vectorizes and the whole series for a long move is computed quickly.
+ *
+ * The pose uses the same conventions as ChassisTurnRate: x is along the starting heading, y is
+ * to the right of the starting heading, and a positive heading is a turn to the right.  Each
+ * step between trajectory points is treated as an exact circular arc, so a constant turn rate
+ * move produces poses exactly on its turning circle.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include "Odometry.hpp"
+
+Odometry::Odometry()
+    : motorRotPerMovementFoot(0.0),
+      widthInFeet(0.0),
+      timeS(),
+      leftFeet(),
+      rightFeet(),
+      distanceFeet(),
+      headingRadians(),
+      xFeet(),
+      yFeet() {
+}
+
+Odometry::~Odometry() {
+}
+
+/**
+ * @brief Take the drive geometry (motor rotations per foot and width) from a TankDrive
+ * @param [in] TankDrive tankDrive whose trajectories will be integrated
+ */
+void Odometry::configureFromTankDrive(const TankDrive &tankDrive) {
+  motorRotPerMovementFoot = tankDrive.getMotorRotPerMovementFoot();
+  widthInFeet = tankDrive.getWidthInFeet();
+  return;
+}
+
+/**
+ * @brief Set the motor rotations needed to move the chassis one foot
+ * @param [in] double rotations per foot of movement
+ */
+void Odometry::setMotorRotPerMovementFoot(const double rotations) {
+  motorRotPerMovementFoot = rotations;
+  return;
+}
+
+/**
+ * @brief Get the motor rotations needed to move the chassis one foot
+ * @return double rotations per foot of movement
+ */
+double Odometry::getMotorRotPerMovementFoot() const {
+  return motorRotPerMovementFoot;
+}
+
+/**
+ * @brief Set the distance between the left and right sides of the drive
+ * @param [in] double width in feet
+ */
+void Odometry::setWidthInFeet(const double width) {
+  widthInFeet = width;
+  return;
+}
+
+/**
+ * @brief Get the distance between the left and right sides of the drive
+ * @return double width in feet
+ */
+double Odometry::getWidthInFeet() const {
+  return widthInFeet;
+}
+
+/**
+ * @brief Compute the chassis pose at every trajectory point of a pair of trajectories
+ *
+ * If one trajectory is shorter than the other, its side is held at its final position for the
+ * remaining points.  The previous pose series is replaced; if the motor rotations per foot
+ * have not been set, it is left empty.
+ *
+ * @param [in] Trajectory leftTrajectory followed by the left side
+ * @param [in] Trajectory rightTrajectory followed by the right side
+ * @return bool indication of whether the poses could be computed (the gearing is set)
+ */
+bool Odometry::integrate(const Trajectory &leftTrajectory,
+                         const Trajectory &rightTrajectory) {
+  if (motorRotPerMovementFoot == 0) {
+    timeS.clear();
+    leftFeet.clear();
+    rightFeet.clear();
+    distanceFeet.clear();
+    headingRadians.clear();
+    xFeet.clear();
+    yFeet.clear();
+    return false;
+  }
+  const unsigned int count = std::max(leftTrajectory.size(),
+                                      rightTrajectory.size());
+  timeS.resize(count);
+  leftFeet.resize(count);
+  rightFeet.resize(count);
+  distanceFeet.resize(count);
+  headingRadians.resize(count);
+  xFeet.resize(count);
+  yFeet.resize(count);
+  if (count == 0)
+    return true;
+
+  // Gather each side's position (in feet) and the time of each point
+  // into contiguous arrays
+  const double feetPerRot = 1 / motorRotPerMovementFoot;
+  const double periodS = std::max(leftTrajectory.getAlgoItPMS(),
+                                  rightTrajectory.getAlgoItPMS()) / 1000.0;
+  const std::vector<TrajectoryPoint> &leftPoints =
+      leftTrajectory.getTrajectoryPoints();
+  const std::vector<TrajectoryPoint> &rightPoints =
+      rightTrajectory.getTrajectoryPoints();
+  double lastFeet = 0.0;
+  for (unsigned int i = 0; i < count; i++) {
+    if (i < leftPoints.size())
+      lastFeet = leftPoints[i].getPosition().getRotations() * feetPerRot;
+    leftFeet[i] = lastFeet;
+  }
+  lastFeet = 0.0;
+  for (unsigned int i = 0; i < count; i++) {
+    if (i < rightPoints.size())
+      lastFeet = rightPoints[i].getPosition().getRotations() * feetPerRot;
+    rightFeet[i] = lastFeet;
+  }
+
+  // Element-wise: time, center distance and heading of every point depend
+  // only on that point's side positions
+  const double radiansPerFoot = widthInFeet > 0 ? 1 / widthInFeet : 0.0;
+  const double *left = leftFeet.data();
+  const double *right = rightFeet.data();
+  double *time = timeS.data();
+  double *distance = distanceFeet.data();
+  double *heading = headingRadians.data();
+  for (unsigned int i = 0; i < count; i++) {
+    time[i] = i * periodS;
+    distance[i] = (left[i] + right[i]) * 0.5;
+    heading[i] = (left[i] - right[i]) * radiansPerFoot;
+  }
+
+  // Element-wise: the displacement of each step, treating the step as a
+  // circular arc; the displacements are staged in the x and y arrays
+  double *x = xFeet.data();
+  double *y = yFeet.data();
+  x[0] = 0.0;
+  y[0] = 0.0;
+  for (unsigned int i = 1; i < count; i++)
+    arcDisplacement(distance[i] - distance[i - 1], heading[i] - heading[i - 1],
+                    heading[i - 1], x[i], y[i]);
+
+  // Accumulate the step displacements into positions
+  for (unsigned int i = 1; i < count; i++) {
+    x[i] += x[i - 1];
+    y[i] += y[i - 1];
+  }
+  return true;
+}
+
+/**
+ * @brief Get the number of poses in the pose series
+ * @return unsigned int number of poses
+ */
+unsigned int Odometry::size() const {
+  return timeS.size();
+}
+
+/**
+ * @brief Get the time of every pose
+ * @return std::vector<double> times in seconds from the start of the move
+ */
+const std::vector<double> &Odometry::getTimeS() const {
+  return timeS;
+}
+
+/**
+ * @brief Get the x position of every pose
+ * @return std::vector<double> x positions in feet along the starting heading
+ */
+const std::vector<double> &Odometry::getXFeet() const {
+  return xFeet;
+}
+
+/**
+ * @brief Get the y position of every pose
+ * @return std::vector<double> y positions in feet to the right of the starting heading
+ */
+const std::vector<double> &Odometry::getYFeet() const {
+  return yFeet;
+}
+
+/**
+ * @brief Get the heading of every pose
+ * @return std::vector<double> headings in radians (positive to the right)
+ */
+const std::vector<double> &Odometry::getHeadingRadians() const {
+  return headingRadians;
+}
+
+/**
+ * @brief Get the distance traveled by the chassis center at every pose
+ * @return std::vector<double> distances in feet
+ */
+const std::vector<double> &Odometry::getDistanceFeet() const {
+  return distanceFeet;
+}
+
+/**
+ * @brief Get a single pose from the pose series
+ * @param [in] unsigned int index of the pose
+ * @param [out] double poseXFeet along the starting heading
+ * @param [out] double poseYFeet to the right of the starting heading
+ * @param [out] double headingDegrees (positive to the right)
+ * @return bool true if the index was within the pose series
+ */
+bool Odometry::getPose(const unsigned int index, double &poseXFeet,
+                       double &poseYFeet, double &headingDegrees) const {
+  if (index >= timeS.size())
+    return false;
+  poseXFeet = xFeet[index];
+  poseYFeet = yFeet[index];
+  headingDegrees = headingRadians[index] * 180 / M_PI;
+  return true;
+}
+
+/**
+ * @brief Write the pose series to a CSV file
+ * @param [in] std::string odometryFileName to write
+ */
+void Odometry::outputCSV(const std::string &odometryFileName) const {
+  // Open the odometry file for output, wiping any current content
+  std::ofstream oFile(odometryFileName, std::ios::out | std::ios::trunc);
+  // Identify this file
+  oFile << "\"Chassis Odometry generated by MCSF\"" << std::endl;
+
+  // Write out odometry parameters
+  oFile << "rotPerFoot," << motorRotPerMovementFoot << std::endl;
+  oFile << "width(ft)," << widthInFeet << std::endl;
+
+  // Write out the poses as tabular data
+  oFile << "Time(s),Dist(ft),X(ft),Y(ft),Heading(deg)" << std::endl;
+  for (unsigned int i = 0; i < timeS.size(); i++)
+    oFile << timeS[i] << "," << distanceFeet[i] << "," << xFeet[i] << ","
+          << yFeet[i] << "," << headingRadians[i] * 180 / M_PI << std::endl;
+
+  // Close out the odometry file, and return from whence we were called
+  oFile.close();
+  return;
+}
+
+/**
+ * @brief Get the displacement of a chassis moving along a circular arc
+ *
+ * The heading changes steadily along the arc, so the chassis ends up where it would by
+ * traveling the chord of the arc at the mean heading.
+ *
+ * @param [in] double arcFeet traveled by the chassis center
+ * @param [in] double headingChangeRadians over the arc (positive to the right)
+ * @param [in] double startHeadingRadians at the start of the arc
+ * @param [out] double dxFeet displacement along heading 0
+ * @param [out] double dyFeet displacement to the right of heading 0
+ */
+void Odometry::arcDisplacement(const double arcFeet,
+                               const double headingChangeRadians,
+                               const double startHeadingRadians,
+                               double &dxFeet, double &dyFeet) {
+  const double halfTurn = headingChangeRadians * 0.5;
+  const double chordFeet =
+      std::fabs(halfTurn) > 1e-12 ?
+          arcFeet * std::sin(halfTurn) / halfTurn : arcFeet;
+  dxFeet = chordFeet * std::cos(startHeadingRadians + halfTurn);
+  dyFeet = chordFeet * std::sin(startHeadingRadians + halfTurn);
+  return;
+}
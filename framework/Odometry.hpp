@@ -0,0 +1,74 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file Odometry.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Shares its arc step with the drive simulator; rejects unset gearing
+ * @date Oct 19, 2026 - Configures from a const TankDrive
+ *
+ * @brief Dead-reckoning chassis pose from a pair of left and right trajectories
+ *
+ * Odometry turns the left and right trajectories produced for a tank drive move into a time
+ * series of chassis poses (x, y, heading), using the drive width and the motor rotations per
+ * foot of movement.  The pose series is kept as a structure of arrays (one contiguous array per
+ * quantity) and computed in a few straight passes over those arrays, so the element-wise work
+ * vectorizes and the whole series for a long move is computed quickly.
+ *
+ * The pose uses the same conventions as ChassisTurnRate: x is along the starting heading, y is
+ * to the right of the starting heading, and a positive heading is a turn to the right.  Each
+ * step between trajectory points is treated as an exact circular arc, so a constant turn rate
+ * move produces poses exactly on its turning circle.
+ *
+ */
+#ifndef ODOMETRY_HPP_
+#define ODOMETRY_HPP_
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "TankDrive.hpp"
+#include "Trajectory.hpp"
+
+/** @brief Computes chassis poses over time from paired left and right trajectories
+ */
+
+class Odometry {
+ public:
+  Odometry();
+  virtual ~Odometry();
+  void configureFromTankDrive(const TankDrive &tankDrive);
+  void setMotorRotPerMovementFoot(const double rotations);
+  double getMotorRotPerMovementFoot() const;
+  void setWidthInFeet(const double width);
+  double getWidthInFeet() const;
+  bool integrate(const Trajectory &leftTrajectory,
+                 const Trajectory &rightTrajectory);
+  unsigned int size() const;
+  const std::vector<double> &getTimeS() const;
+  const std::vector<double> &getXFeet() const;
+  const std::vector<double> &getYFeet() const;
+  const std::vector<double> &getHeadingRadians() const;
+  const std::vector<double> &getDistanceFeet() const;
+  bool getPose(const unsigned int index, double &poseXFeet,
+               double &poseYFeet, double &headingDegrees) const;
+  void outputCSV(const std::string &odometryFileName) const;
+  static void arcDisplacement(const double arcFeet,
+                              const double headingChangeRadians,
+                              const double startHeadingRadians,
+                              double &dxFeet, double &dyFeet);
+
+ private:
+  double motorRotPerMovementFoot;      // gearing from motor to chassis
+  double widthInFeet;                  // distance between the sides
+  std::vector<double> timeS;           // time of each pose
+  std::vector<double> leftFeet;        // left side travel
+  std::vector<double> rightFeet;       // right side travel
+  std::vector<double> distanceFeet;    // chassis center travel
+  std::vector<double> headingRadians;  // chassis heading
+  std::vector<double> xFeet;           // chassis center x
+  std::vector<double> yFeet;           // chassis center y
+};
+
+#endif /* ODOMETRY_HPP_ */
@@ -0,0 +1,450 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file ParameterSweep.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief Parallel sweeps of a move over many tank drive configurations
+ *
+ * A parameter sweep evaluates one requested move over many drive system configurations
+ * (maximum motor velocity and acceleration, motor rotations per foot, trajectory iteration
+ * period, and drive width).  Configurations are laid out either as a grid over the range of
+ * each parameter or as seeded random samples within those ranges.  Each configuration's
+ * trajectories are generated by a TankDrive and followed by a DriveSimulator; worker threads
+ * claim configurations from a shared atomic counter and write their results into a
+ * preallocated columnar table (one array per column), so no locking is needed and the results
+ * do not depend on the number of threads.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+#include "DriveSimulator.hpp"
+#include "ParameterSweep.hpp"
+#include "TankDrive.hpp"
+#include "Trajectory.hpp"
+
+ParameterSweep::ParameterSweep()
+    : moveDistanceFeet(0.0),
+      moveTurnRate(),
+      moveVelocity(),
+      moveAcceleration(),
+      motorModel(),
+      maxVelocityRange { 0.0, 0.0, 1 },
+      maxAccelerationRange { 0.0, 0.0, 1 },
+      rotPerFootRange { 0.0, 0.0, 1 },
+      iterationPeriodRange { 10.0, 10.0, 1 },
+      widthRange { 0.0, 0.0, 1 },
+      nextConfiguration(0),
+      maxVelocityRPM(),
+      maxAccelerationRPMpS(),
+      motorRotPerMovementFoot(),
+      iterationPeriodMS(),
+      widthFeet(),
+      moveTimeS(),
+      peakAccelerationFPSS(),
+      endpointErrorFeet(),
+      maxTrackingErrorFeet() {
+}
+
+ParameterSweep::~ParameterSweep() {
+}
+
+/**
+ * @brief Set the move to be made by every configuration
+ * @param [in] double distanceFeet to move the chassis
+ * @param [in] ChassisTurnRate chassisTurnRate in degrees per foot
+ * @param [in] ChassisVelocity chassisVelocityRequested
+ * @param [in] ChassisAcceleration chassisAccelerationRequested
+ */
+void ParameterSweep::setMove(double distanceFeet,
+                             ChassisTurnRate chassisTurnRate,
+                             ChassisVelocity chassisVelocityRequested,
+                             ChassisAcceleration chassisAccelerationRequested) {
+  moveDistanceFeet = distanceFeet;
+  moveTurnRate = chassisTurnRate;
+  moveVelocity = chassisVelocityRequested;
+  moveAcceleration = chassisAccelerationRequested;
+  return;
+}
+
+/**
+ * @brief Set the motor model used to simulate both sides of every configuration
+ * @param [in] DCMotorModel model with the desired motor characteristics
+ */
+void ParameterSweep::setMotorModel(const DCMotorModel &model) {
+  motorModel = model;
+  return;
+}
+
+/**
+ * @brief Set the range of maximum motor velocities to sweep
+ * @param [in] double minimumRPM
+ * @param [in] double maximumRPM
+ * @param [in] unsigned int steps across the range for a grid sweep
+ */
+void ParameterSweep::setMaxVelocityRange(const double minimumRPM,
+                                         const double maximumRPM,
+                                         const unsigned int steps) {
+  maxVelocityRange = SweepRange { minimumRPM, maximumRPM, steps };
+  return;
+}
+
+/**
+ * @brief Set the range of maximum motor accelerations to sweep
+ * @param [in] double minimumRPMpS
+ * @param [in] double maximumRPMpS
+ * @param [in] unsigned int steps across the range for a grid sweep
+ */
+void ParameterSweep::setMaxAccelerationRange(const double minimumRPMpS,
+                                             const double maximumRPMpS,
+                                             const unsigned int steps) {
+  maxAccelerationRange = SweepRange { minimumRPMpS, maximumRPMpS, steps };
+  return;
+}
+
+/**
+ * @brief Set the range of motor rotations per foot of movement to sweep
+ * @param [in] double minimum rotations per foot
+ * @param [in] double maximum rotations per foot
+ * @param [in] unsigned int steps across the range for a grid sweep
+ */
+void ParameterSweep::setMotorRotPerMovementFootRange(const double minimum,
+                                                     const double maximum,
+                                                     const unsigned int steps) {
+  rotPerFootRange = SweepRange { minimum, maximum, steps };
+  return;
+}
+
+/**
+ * @brief Set the range of trajectory iteration periods to sweep
+ * @param [in] unsigned int minimumMS
+ * @param [in] unsigned int maximumMS
+ * @param [in] unsigned int steps across the range for a grid sweep
+ */
+void ParameterSweep::setIterationPeriodRange(const unsigned int minimumMS,
+                                             const unsigned int maximumMS,
+                                             const unsigned int steps) {
+  iterationPeriodRange = SweepRange { static_cast<double>(minimumMS),
+      static_cast<double>(maximumMS), steps };
+  return;
+}
+
+/**
+ * @brief Set the range of drive widths to sweep
+ * @param [in] double minimumFeet
+ * @param [in] double maximumFeet
+ * @param [in] unsigned int steps across the range for a grid sweep
+ */
+void ParameterSweep::setWidthRange(const double minimumFeet,
+                                   const double maximumFeet,
+                                   const unsigned int steps) {
+  widthRange = SweepRange { minimumFeet, maximumFeet, steps };
+  return;
+}
+
+/**
+ * @brief Lay out one configuration for every combination of parameter range steps
+ */
+void ParameterSweep::generateGrid() {
+  const unsigned int velocitySteps = std::max(maxVelocityRange.steps, 1u);
+  const unsigned int accelerationSteps = std::max(maxAccelerationRange.steps,
+                                                  1u);
+  const unsigned int rotPerFootSteps = std::max(rotPerFootRange.steps, 1u);
+  const unsigned int periodSteps = std::max(iterationPeriodRange.steps, 1u);
+  const unsigned int widthSteps = std::max(widthRange.steps, 1u);
+  clearTable(
+      velocitySteps * accelerationSteps * rotPerFootSteps * periodSteps
+          * widthSteps);
+  unsigned int index = 0;
+  for (unsigned int v = 0; v < velocitySteps; v++)
+    for (unsigned int a = 0; a < accelerationSteps; a++)
+      for (unsigned int r = 0; r < rotPerFootSteps; r++)
+        for (unsigned int p = 0; p < periodSteps; p++)
+          for (unsigned int w = 0; w < widthSteps; w++) {
+            maxVelocityRPM[index] = maxVelocityRange.value(v);
+            maxAccelerationRPMpS[index] = maxAccelerationRange.value(a);
+            motorRotPerMovementFoot[index] = rotPerFootRange.value(r);
+            iterationPeriodMS[index] = static_cast<unsigned int>(std::lround(
+                iterationPeriodRange.value(p)));
+            widthFeet[index] = widthRange.value(w);
+            index++;
+          }
+  return;
+}
+
+/**
+ * @brief Lay out configurations with every parameter drawn uniformly from its range
+ * @param [in] unsigned int count of configurations
+ * @param [in] unsigned int seed for the random number generator (the same seed always lays
+ * out the same configurations)
+ */
+void ParameterSweep::generateRandom(const unsigned int count,
+                                    const unsigned int seed) {
+  clearTable(count);
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  auto draw = [&](const SweepRange &range) {
+    return range.minimum + (range.maximum - range.minimum) * unit(generator);
+  };
+  for (unsigned int index = 0; index < count; index++) {
+    maxVelocityRPM[index] = draw(maxVelocityRange);
+    maxAccelerationRPMpS[index] = draw(maxAccelerationRange);
+    motorRotPerMovementFoot[index] = draw(rotPerFootRange);
+    iterationPeriodMS[index] = static_cast<unsigned int>(std::lround(
+        draw(iterationPeriodRange)));
+    widthFeet[index] = draw(widthRange);
+  }
+  return;
+}
+
+/**
+ * @brief Run the move for every configuration, filling in the result columns
+ * @param [in] unsigned int threadCount of worker threads (0 for one per hardware thread)
+ */
+void ParameterSweep::run(unsigned int threadCount) {
+  if (threadCount == 0)
+    threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+  threadCount = std::min(threadCount, std::max(size(), 1u));
+
+  // Each worker claims the next unrun configuration until none are left;
+  // every configuration writes only its own row of the result columns
+  nextConfiguration = 0;
+  auto worker = [this]() {
+    for (unsigned int index = nextConfiguration++; index < size(); index =
+        nextConfiguration++)
+      runConfiguration(index);
+  };
+  std::vector<std::thread> workers;
+  for (unsigned int t = 1; t < threadCount; t++)
+    workers.emplace_back(worker);
+  worker();
+  for (auto &thread : workers)
+    thread.join();
+  return;
+}
+
+/**
+ * @brief Get the number of configurations in the table
+ * @return unsigned int number of configurations
+ */
+unsigned int ParameterSweep::size() const {
+  return maxVelocityRPM.size();
+}
+
+/**
+ * @brief Get the maximum motor velocity column
+ * @return std::vector<double> maximum motor velocity of each configuration in RPM
+ */
+const std::vector<double> &ParameterSweep::getMaxVelocityRPM() const {
+  return maxVelocityRPM;
+}
+
+/**
+ * @brief Get the maximum motor acceleration column
+ * @return std::vector<double> maximum motor acceleration of each configuration in RPM/s
+ */
+const std::vector<double> &ParameterSweep::getMaxAccelerationRPMpS() const {
+  return maxAccelerationRPMpS;
+}
+
+/**
+ * @brief Get the motor rotations per foot column
+ * @return std::vector<double> motor rotations per foot of each configuration
+ */
+const std::vector<double> &ParameterSweep::getMotorRotPerMovementFoot() const {
+  return motorRotPerMovementFoot;
+}
+
+/**
+ * @brief Get the trajectory iteration period column
+ * @return std::vector<unsigned int> iteration period of each configuration in ms
+ */
+const std::vector<unsigned int> &ParameterSweep::getIterationPeriodMS() const {
+  return iterationPeriodMS;
+}
+
+/**
+ * @brief Get the drive width column
+ * @return std::vector<double> drive width of each configuration in feet
+ */
+const std::vector<double> &ParameterSweep::getWidthFeet() const {
+  return widthFeet;
+}
+
+/**
+ * @brief Get the move time column
+ * @return std::vector<double> time the trajectories take for each configuration in seconds
+ */
+const std::vector<double> &ParameterSweep::getMoveTimeS() const {
+  return moveTimeS;
+}
+
+/**
+ * @brief Get the peak chassis acceleration column
+ * @return std::vector<double> peak chassis center acceleration of each configuration in ft/s/s
+ */
+const std::vector<double> &ParameterSweep::getPeakAccelerationFPSS() const {
+  return peakAccelerationFPSS;
+}
+
+/**
+ * @brief Get the endpoint error column
+ * @return std::vector<double> distance in feet between the simulated final chassis position
+ * and the requested move's ideal end point for each configuration
+ */
+const std::vector<double> &ParameterSweep::getEndpointErrorFeet() const {
+  return endpointErrorFeet;
+}
+
+/**
+ * @brief Get the tracking error column
+ * @return std::vector<double> worst simulated tracking error of either side of each
+ * configuration in feet
+ */
+const std::vector<double> &ParameterSweep::getMaxTrackingErrorFeet() const {
+  return maxTrackingErrorFeet;
+}
+
+/**
+ * @brief Find the configuration with the shortest move time within an endpoint error limit
+ * @param [in] double maxEndpointErrorFeet allowed
+ * @param [out] unsigned int index of the fastest configuration
+ * @return bool true if any configuration was within the endpoint error limit
+ */
+bool ParameterSweep::getFastest(const double maxEndpointErrorFeet,
+                                unsigned int &index) const {
+  bool found = false;
+  for (unsigned int i = 0; i < size(); i++)
+    if (endpointErrorFeet[i] <= maxEndpointErrorFeet
+        && (!found || moveTimeS[i] < moveTimeS[index])) {
+      index = i;
+      found = true;
+    }
+  return found;
+}
+
+/**
+ * @brief Write the configuration and result table to a CSV file
+ * @param [in] std::string sweepFileName to write
+ */
+void ParameterSweep::outputCSV(const std::string &sweepFileName) const {
+  // Open the sweep file for output, wiping any current content
+  std::ofstream sFile(sweepFileName, std::ios::out | std::ios::trunc);
+  // Identify this file
+  sFile << "\"Drive Parameter Sweep generated by MCSF\"" << std::endl;
+
+  // Write out the table, one configuration per row
+  sFile << "maxV(rpm),maxA(rpm/s),rotPerFoot,ItP(ms),width(ft),"
+        << "moveTime(s),peakAccel(ft/s/s),endpointError(ft),"
+        << "maxTrackingError(ft)" << std::endl;
+  for (unsigned int i = 0; i < size(); i++)
+    sFile << maxVelocityRPM[i] << "," << maxAccelerationRPMpS[i] << ","
+          << motorRotPerMovementFoot[i] << "," << iterationPeriodMS[i] << ","
+          << widthFeet[i] << "," << moveTimeS[i] << ","
+          << peakAccelerationFPSS[i] << "," << endpointErrorFeet[i] << ","
+          << maxTrackingErrorFeet[i] << std::endl;
+
+  // Close out the sweep file, and return from whence we were called
+  sFile.close();
+  return;
+}
+
+/**
+ * @brief Value of a swept parameter at a step of its range
+ * @param [in] unsigned int step across the range
+ * @return double parameter value
+ */
+double ParameterSweep::SweepRange::value(const unsigned int step) {
+  if (steps <= 1)
+    return minimum;
+  return minimum + (maximum - minimum) * step / (steps - 1);
+}
+
+/**
+ * @brief Size every column of the table for a number of configurations, clearing results
+ * @param [in] unsigned int count of configurations
+ */
+void ParameterSweep::clearTable(const unsigned int count) {
+  maxVelocityRPM.assign(count, 0.0);
+  maxAccelerationRPMpS.assign(count, 0.0);
+  motorRotPerMovementFoot.assign(count, 0.0);
+  iterationPeriodMS.assign(count, 0);
+  widthFeet.assign(count, 0.0);
+  moveTimeS.assign(count, 0.0);
+  peakAccelerationFPSS.assign(count, 0.0);
+  endpointErrorFeet.assign(count, 0.0);
+  maxTrackingErrorFeet.assign(count, 0.0);
+  return;
+}
+
+/**
+ * @brief Generate, simulate and evaluate the move for one configuration
+ * @param [in] unsigned int index of the configuration
+ */
+void ParameterSweep::runConfiguration(const unsigned int index) {
+  // Build the configuration's drive and generate its trajectories
+  TankDrive aTankDrive;
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(maxVelocityRPM[index]);
+  aTankDrive.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(maxAccelerationRPMpS[index]);
+  aTankDrive.setMaxAcceleration(maxAcceleration);
+  aTankDrive.setMotorRotPerMovementFoot(motorRotPerMovementFoot[index]);
+  aTankDrive.setTrajectoryIterationPeriodMS(iterationPeriodMS[index]);
+  aTankDrive.setWidthInFeet(widthFeet[index]);
+  Trajectory leftTrajectory, rightTrajectory;
+  aTankDrive.generateTrajectories(moveDistanceFeet, moveTurnRate,
+                                  moveVelocity, moveAcceleration,
+                                  leftTrajectory, rightTrajectory);
+
+  // Move time and peak chassis center acceleration come from the trajectories
+  moveTimeS[index] = leftTrajectory.size() == 0 ? 0.0 :
+      (leftTrajectory.size() - 1) * leftTrajectory.getAlgoItPMS() / 1000.0;
+  double peakAccelerationRPMpS = 0.0;
+  const std::vector<TrajectoryPoint> &leftPoints =
+      leftTrajectory.getTrajectoryPoints();
+  const std::vector<TrajectoryPoint> &rightPoints =
+      rightTrajectory.getTrajectoryPoints();
+  for (unsigned int i = 0; i < leftPoints.size() && i < rightPoints.size();
+      i++) {
+    const TrajectoryPoint &leftPoint = leftPoints[i];
+    const TrajectoryPoint &rightPoint = rightPoints[i];
+    peakAccelerationRPMpS = std::max(
+        peakAccelerationRPMpS,
+        std::fabs(
+            (leftPoint.getAcceleration().getRotationsPerMinutePerSecond()
+                + rightPoint.getAcceleration()
+                    .getRotationsPerMinutePerSecond()) / 2));
+  }
+  peakAccelerationFPSS[index] = peakAccelerationRPMpS / 60
+      / motorRotPerMovementFoot[index];
+
+  // Simulate the move and compare where the chassis ends up with where the
+  // requested move ends (on its turning circle, or straight ahead)
+  DriveSimulator aSimulator;
+  aSimulator.configureFromTankDrive(aTankDrive);
+  aSimulator.setMotorModel(motorModel);
+  aSimulator.simulate(leftTrajectory, rightTrajectory);
+  double idealXFeet = moveDistanceFeet;
+  double idealYFeet = 0.0;
+  if (moveTurnRate.getDegreesPerFoot() != 0) {
+    const double pi = 4 * atan(1.0);
+    const double radiusFeet = 360 / moveTurnRate.getDegreesPerFoot()
+        / (2 * pi);
+    const double headingRadians = moveDistanceFeet / radiusFeet;
+    idealXFeet = radiusFeet * std::sin(headingRadians);
+    idealYFeet = radiusFeet * (1 - std::cos(headingRadians));
+  }
+  endpointErrorFeet[index] = std::hypot(aSimulator.getXFeet() - idealXFeet,
+                                        aSimulator.getYFeet() - idealYFeet);
+  maxTrackingErrorFeet[index] = std::max(
+      aSimulator.getMaxLeftTrackingError().getRotations(),
+      aSimulator.getMaxRightTrackingError().getRotations())
+      / motorRotPerMovementFoot[index];
+  return;
+}
@@ -0,0 +1,108 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file ParameterSweep.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief Parallel sweeps of a move over many tank drive configurations
+ *
+ * A parameter sweep evaluates one requested move over many drive system configurations
+ * (maximum motor velocity and acceleration, motor rotations per foot, trajectory iteration
+ * period, and drive width).  Configurations are laid out either as a grid over the range of
+ * each parameter or as seeded random samples within those ranges.  Each configuration's
+ * trajectories are generated by a TankDrive and followed by a DriveSimulator; worker threads
+ * claim configurations from a shared atomic counter and write their results into a
+ * preallocated columnar table (one array per column), so no locking is needed and the results
+ * do not depend on the number of threads.
+ *
+ */
+#ifndef PARAMETERSWEEP_HPP_
+#define PARAMETERSWEEP_HPP_
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "ChassisAcceleration.hpp"
+#include "ChassisTurnRate.hpp"
+#include "ChassisVelocity.hpp"
+#include "DCMotorModel.hpp"
+
+/** @brief Runs a move across many drive configurations and tabulates the outcomes
+ */
+
+class ParameterSweep {
+ public:
+  ParameterSweep();
+  virtual ~ParameterSweep();
+  void setMove(double distanceFeet, ChassisTurnRate chassisTurnRate,
+               ChassisVelocity chassisVelocityRequested,
+               ChassisAcceleration chassisAccelerationRequested);
+  void setMotorModel(const DCMotorModel &model);
+  void setMaxVelocityRange(const double minimumRPM, const double maximumRPM,
+                           const unsigned int steps);
+  void setMaxAccelerationRange(const double minimumRPMpS,
+                               const double maximumRPMpS,
+                               const unsigned int steps);
+  void setMotorRotPerMovementFootRange(const double minimum,
+                                       const double maximum,
+                                       const unsigned int steps);
+  void setIterationPeriodRange(const unsigned int minimumMS,
+                               const unsigned int maximumMS,
+                               const unsigned int steps);
+  void setWidthRange(const double minimumFeet, const double maximumFeet,
+                     const unsigned int steps);
+  void generateGrid();
+  void generateRandom(const unsigned int count, const unsigned int seed);
+  void run(unsigned int threadCount = 0);
+  unsigned int size() const;
+  const std::vector<double> &getMaxVelocityRPM() const;
+  const std::vector<double> &getMaxAccelerationRPMpS() const;
+  const std::vector<double> &getMotorRotPerMovementFoot() const;
+  const std::vector<unsigned int> &getIterationPeriodMS() const;
+  const std::vector<double> &getWidthFeet() const;
+  const std::vector<double> &getMoveTimeS() const;
+  const std::vector<double> &getPeakAccelerationFPSS() const;
+  const std::vector<double> &getEndpointErrorFeet() const;
+  const std::vector<double> &getMaxTrackingErrorFeet() const;
+  bool getFastest(const double maxEndpointErrorFeet, unsigned int &index) const;
+  void outputCSV(const std::string &sweepFileName) const;
+
+ private:
+  /** @brief The range of values a swept parameter takes
+   */
+  struct SweepRange {
+    double minimum;
+    double maximum;
+    unsigned int steps;
+    double value(const unsigned int step);
+  };
+  void clearTable(const unsigned int count);
+  void runConfiguration(const unsigned int index);
+  double moveDistanceFeet;
+  ChassisTurnRate moveTurnRate;
+  ChassisVelocity moveVelocity;
+  ChassisAcceleration moveAcceleration;
+  DCMotorModel motorModel;
+  SweepRange maxVelocityRange;
+  SweepRange maxAccelerationRange;
+  SweepRange rotPerFootRange;
+  SweepRange iterationPeriodRange;
+  SweepRange widthRange;
+  std::atomic<unsigned int> nextConfiguration;
+  // Configuration columns
+  std::vector<double> maxVelocityRPM;
+  std::vector<double> maxAccelerationRPMpS;
+  std::vector<double> motorRotPerMovementFoot;
+  std::vector<unsigned int> iterationPeriodMS;
+  std::vector<double> widthFeet;
+  // Result columns
+  std::vector<double> moveTimeS;
+  std::vector<double> peakAccelerationFPSS;
+  std::vector<double> endpointErrorFeet;
+  std::vector<double> maxTrackingErrorFeet;
+};
+
+#endif /* PARAMETERSWEEP_HPP_ */
@@ -7,6 +7,11 @@
  * @date Mar 9, 2017 - Removed planTrajectory (moved to Trajectory object)
  * @date Mar 9, 2017 - Added getFirstPathPoint, getNextPathPoint, and
  * size methods to facilitate trajectory generation from Trajectory object
+ * @date Oct 19, 2026 - Const-correct; path points readable in place without copies
+ * @date Oct 19, 2026 - Added const iterator and indexed access, and reserve and
+ * in-place construction of path points; deprecated the path point cursor
+ * @date Oct 19, 2026 - Added writable indexed access, for planners that refine path points
+ * @date Oct 19, 2026 - Added clear, so a path's storage can be re-used
  *
  * * @brief A motion path is a vector of Path Points
  *
@@ -26,6 +31,24 @@ Path::~Path() {
   // TODO(Mark Jenkins): Auto-generated destructor stub
 }
 
+/**
+ * @brief Make room for a number of path points, so adding them never moves the path
+ * @param [in] unsigned int pathPointCount the path will hold
+ */
+void Path::reserve(const unsigned int pathPointCount) {
+  path.reserve(pathPointCount);
+  return;
+}
+
+/**
+ * @brief Remove every path point, keeping the room made for them, so the path can be re-used
+ */
+void Path::clear() {
+  path.clear();
+  nextPathPoint = 0;
+  return;
+}
+
 /**
  * @brief Add a path point onto this path
  * @param [in] a PathPoint pathPoint to add to the current path
@@ -35,8 +58,23 @@ void Path::addPathPoint(const PathPoint &pathPoint) {
   return;
 }
 
+/**
+ * @brief Construct a path point in place at the end of this path
+ * @param [in] MotorPosition position of the new path point
+ * @param [in] MotorVelocity maxVelocity from the new path point
+ * @param [in] MotorAcceleration maxAcceleration from the new path point
+ */
+void Path::emplacePathPoint(const MotorPosition &position,
+                            const MotorVelocity &maxVelocity,
+                            const MotorAcceleration &maxAcceleration) {
+  path.emplace_back(position, maxVelocity, maxAcceleration);
+  return;
+}
+
 /**
  * @brief Return the first path point in the path
+ * @deprecated Copies the point and moves a cursor shared by all readers;
+ * use begin()/end() or indexed access instead
  * @param [out] PathPoint set equal to the value of the first path point on the path
  * @return bool indication of whether the requested point was on the path
  */
@@ -52,6 +90,8 @@ bool Path::getFirstPathPoint(PathPoint &pathPoint) {
 
 /**
  * @brief Return the next path point on the path
+ * @deprecated Copies the point and moves a cursor shared by all readers;
+ * use begin()/end() or indexed access instead
  * @param [out] PathPoint set equal to the value of the next path point on the path
  * @return bool indication of whether the requested point was on the path
  */
@@ -69,16 +109,58 @@ bool Path::getNextPathPoint(PathPoint &pathPoint) {
  * @brief Reports the number of path points in this path
  * @return int number of path points in path
  */
-unsigned int Path::size() {
+unsigned int Path::size() const {
   return path.size();
 }
 
+/**
+ * @brief Get a const iterator to the first path point of this path
+ * @return const_iterator to the first path point
+ */
+Path::const_iterator Path::begin() const {
+  return path.begin();
+}
+
+/**
+ * @brief Get a const iterator past the last path point of this path
+ * @return const_iterator past the last path point
+ */
+Path::const_iterator Path::end() const {
+  return path.end();
+}
+
+/**
+ * @brief Read a path point in place, without bounds checking
+ * @param [in] unsigned int index of the path point (0 is the first point; must be less than size())
+ * @return PathPoint at the index, read-only
+ */
+const PathPoint &Path::operator[](const unsigned int index) const {
+  return path[index];
+}
+
+/**
+ * @brief Change a path point in place, without bounds checking
+ * @param [in] unsigned int index of the path point (0 is the first point; must be less than size())
+ * @return PathPoint at the index
+ */
+PathPoint &Path::operator[](const unsigned int index) {
+  return path[index];
+}
+
+/**
+ * @brief Gives read-only access to the path points of this path, without copying them
+ * @return vector of PathPoint - the path points of this path, in order
+ */
+const std::vector<PathPoint> &Path::getPathPoints() const {
+  return path;
+}
+
 /**
  * @brief Shows this motion path on the default output device
  */
-void Path::show() {
+void Path::show() const {
   std::cout << "Motion path:" << std::endl;
-  for (auto pathPoint : path) {
+  for (const auto &pathPoint : path) {
     pathPoint.show();
     std::cout << std::endl;
   }
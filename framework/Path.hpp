@@ -7,6 +7,11 @@
  * @date Mar 9, 2017 - Removed planTrajectory (moved to Trajectory object)
  * @date Mar 9, 2017 - Added getFirstPathPoint, getNextPathPoint, and
  * size methods to facilitate trajectory generation from Trajectory object
+ * @date Oct 19, 2026 - Const-correct; path points readable in place without copies
+ * @date Oct 19, 2026 - Added const iterator and indexed access, and reserve and
+ * in-place construction of path points; deprecated the path point cursor
+ * @date Oct 19, 2026 - Added writable indexed access, for planners that refine path points
+ * @date Oct 19, 2026 - Added clear, so a path's storage can be re-used
  *
  * @brief A motion path is a vector of Path Points
  *
@@ -14,6 +19,12 @@
  * a motion will travel.  The path can be used to plan a motion profile
  * trajectory.
  *
+ * Path points are read in place through const iterators or by index, so
+ * any number of threads can scan a path at once, and standard algorithms
+ * can be applied to it.  The getFirstPathPoint/getNextPathPoint cursor is
+ * deprecated: it copies each point out and its position is shared by all
+ * readers.
+ *
  */
 #ifndef PATH_HPP_
 #define PATH_HPP_
@@ -27,13 +38,25 @@
 
 class Path {
  public:
+  typedef std::vector<PathPoint>::const_iterator const_iterator;
+
   Path();
   virtual ~Path();
+  void reserve(const unsigned int pathPointCount);
+  void clear();
   void addPathPoint(const PathPoint &pathPoint);
+  void emplacePathPoint(const MotorPosition &position,
+                        const MotorVelocity &maxVelocity,
+                        const MotorAcceleration &maxAcceleration);
   bool getFirstPathPoint(PathPoint &pathPoint);
   bool getNextPathPoint(PathPoint &pathPoint);
-  unsigned int size();
-  void show();
+  unsigned int size() const;
+  const_iterator begin() const;
+  const_iterator end() const;
+  const PathPoint &operator[](const unsigned int index) const;
+  PathPoint &operator[](const unsigned int index);
+  const std::vector<PathPoint> &getPathPoints() const;
+  void show() const;
 
  private:
   std::vector<PathPoint> path;
@@ -0,0 +1,248 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file PathIndex.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief Fast nearest point and lookahead point queries on a spline path
+ *
+ * A path follower finds the point of its path nearest the chassis every control period, and a
+ * point a set distance further along.  The path index samples a spline path at evenly spaced
+ * distances into contiguous x and y arrays, and answers those queries without scanning every
+ * point:
+ *
+ * - findNearest searches a two dimensional tree of the points (a balanced k-d tree, stored as
+ *   a reordered array of point indexes with each subtree's median at its middle), in
+ *   logarithmic time, for when nothing is known about where the chassis is;
+ * - findNearestFrom walks along the path from a hint (the previous period's nearest point),
+ *   for as long as the points get closer, in amortized constant time as the chassis moves
+ *   along the path (it finds the nearest point along the path near the hint, so a path that
+ *   doubles back near itself is not mistaken for its later part);
+ * - findLookahead steps a distance along the path from a point in constant time, since the
+ *   points are evenly spaced.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "PathIndex.hpp"
+
+PathIndex::PathIndex()
+    : xFeet(),
+      yFeet(),
+      tree(),
+      spacingFeet(0.0) {
+}
+
+PathIndex::~PathIndex() {
+}
+
+/**
+ * @brief Sample a spline path at evenly spaced distances and index the points
+ * @param [in] SplinePath splinePath to index
+ * @param [in] double stepFeet - spacing of the points along the path (the last point is at
+ * its end)
+ * @return bool indication of whether the path was indexed
+ */
+bool PathIndex::build(const SplinePath &splinePath, const double stepFeet) {
+  xFeet.clear();
+  yFeet.clear();
+  tree.clear();
+  spacingFeet = stepFeet;
+  if (splinePath.getSegmentCount() == 0 || stepFeet <= 0)
+    return false;
+
+  const unsigned int pointCount = static_cast<unsigned int>(std::ceil(
+      splinePath.getLengthFeet() / spacingFeet)) + 1;
+  xFeet.resize(pointCount);
+  yFeet.resize(pointCount);
+  double headingDegrees, curvaturePerFoot;
+  for (unsigned int i = 0; i < pointCount; i++)
+    splinePath.sample(std::min(i * spacingFeet, splinePath.getLengthFeet()),
+                      xFeet[i], yFeet[i], headingDegrees, curvaturePerFoot);
+
+  tree.resize(pointCount);
+  for (unsigned int i = 0; i < pointCount; i++)
+    tree[i] = i;
+  buildTree(0, pointCount, 0);
+  return true;
+}
+
+/**
+ * @brief Get the number of points in the index
+ * @return unsigned int count of points (0 if nothing has been indexed)
+ */
+unsigned int PathIndex::size() const {
+  return xFeet.size();
+}
+
+/**
+ * @brief Get the distance along the path between points
+ * @return double spacing in feet
+ */
+double PathIndex::getSpacingFeet() const {
+  return spacingFeet;
+}
+
+/**
+ * @brief Get the forward position of a point
+ * @param [in] unsigned int index of the point (must be less than size())
+ * @return double feet forward of the starting position
+ */
+double PathIndex::getXFeet(const unsigned int index) const {
+  return xFeet[index];
+}
+
+/**
+ * @brief Get the rightward position of a point
+ * @param [in] unsigned int index of the point (must be less than size())
+ * @return double feet right of the starting position
+ */
+double PathIndex::getYFeet(const unsigned int index) const {
+  return yFeet[index];
+}
+
+/**
+ * @brief Find the point of the path nearest a position, searching the whole path
+ * @param [in] double x - feet forward of the starting position
+ * @param [in] double y - feet right of the starting position
+ * @return unsigned int index of the nearest point (0 if nothing has been indexed)
+ */
+unsigned int PathIndex::findNearest(const double x, const double y) const {
+  unsigned int nearest = 0;
+  double nearestSquared = std::numeric_limits<double>::infinity();
+  searchTree(0, tree.size(), 0, x, y, nearest, nearestSquared);
+  return nearest;
+}
+
+/**
+ * @brief Find the point of the path nearest a position, walking along the path from a hint
+ * @param [in] double x - feet forward of the starting position
+ * @param [in] double y - feet right of the starting position
+ * @param [in] unsigned int hint - index of a point near the position (usually the last
+ * nearest point found)
+ * @return unsigned int index of the nearest point along the path near the hint (0 if nothing
+ * has been indexed)
+ */
+unsigned int PathIndex::findNearestFrom(const double x, const double y,
+                                        const unsigned int hint) const {
+  if (xFeet.empty())
+    return 0;
+  unsigned int nearest = std::min<unsigned int>(hint, xFeet.size() - 1);
+  double nearestSquared = distanceSquared(nearest, x, y);
+
+  // Walk ahead while the points get closer; if that gets no closer, walk back
+  const unsigned int start = nearest;
+  while (nearest + 1 < xFeet.size()) {
+    const double nextSquared = distanceSquared(nearest + 1, x, y);
+    if (nextSquared >= nearestSquared)
+      break;
+    nearestSquared = nextSquared;
+    nearest++;
+  }
+  if (nearest == start) {
+    while (nearest > 0) {
+      const double previousSquared = distanceSquared(nearest - 1, x, y);
+      if (previousSquared >= nearestSquared)
+        break;
+      nearestSquared = previousSquared;
+      nearest--;
+    }
+  }
+  return nearest;
+}
+
+/**
+ * @brief Find the point a distance further along the path than another
+ * @param [in] unsigned int index of the point to start from
+ * @param [in] double lookaheadFeet - distance along the path to look ahead
+ * @return unsigned int index of the point that distance ahead (the last point if the path ends
+ * sooner; 0 if nothing has been indexed)
+ */
+unsigned int PathIndex::findLookahead(const unsigned int index,
+                                      const double lookaheadFeet) const {
+  if (xFeet.empty())
+    return 0;
+  const double ahead = std::max(0.0, std::round(lookaheadFeet / spacingFeet));
+  return std::min<double>(index + ahead, xFeet.size() - 1);
+}
+
+/**
+ * @brief Squared distance from a point of the path to a position
+ * @param [in] unsigned int index of the point
+ * @param [in] double x - feet forward of the starting position
+ * @param [in] double y - feet right of the starting position
+ * @return double squared distance in square feet
+ */
+double PathIndex::distanceSquared(const unsigned int index, const double x,
+                                  const double y) const {
+  const double dx = xFeet[index] - x;
+  const double dy = yFeet[index] - y;
+  return dx * dx + dy * dy;
+}
+
+/**
+ * @brief Arrange a range of the tree so its median (by x on even depths, y on odd) is at its
+ * middle, with lesser points before it and greater points after, and likewise each half
+ * @param [in] unsigned int first position of the range in the tree
+ * @param [in] unsigned int last position past the end of the range
+ * @param [in] unsigned int depth of the range in the tree
+ */
+void PathIndex::buildTree(const unsigned int first, const unsigned int last,
+                          const unsigned int depth) {
+  if (last - first < 2)
+    return;
+  const unsigned int middle = first + (last - first) / 2;
+  const std::vector<double> &axis = (depth % 2 == 0) ? xFeet : yFeet;
+  std::nth_element(tree.begin() + first, tree.begin() + middle,
+                   tree.begin() + last,
+                   [&axis](unsigned int a, unsigned int b) {
+                     return axis[a] < axis[b];
+                   });
+  buildTree(first, middle, depth + 1);
+  buildTree(middle + 1, last, depth + 1);
+  return;
+}
+
+/**
+ * @brief Search a range of the tree for a point nearer a position than the nearest so far,
+ * skipping any half that cannot hold one
+ * @param [in] unsigned int first position of the range in the tree
+ * @param [in] unsigned int last position past the end of the range
+ * @param [in] unsigned int depth of the range in the tree
+ * @param [in] double x - feet forward of the starting position
+ * @param [in] double y - feet right of the starting position
+ * @param [in/out] unsigned int nearest - index of the nearest point so far
+ * @param [in/out] double nearestSquared - squared distance to the nearest point so far
+ */
+void PathIndex::searchTree(const unsigned int first, const unsigned int last,
+                           const unsigned int depth, const double x,
+                           const double y, unsigned int &nearest,
+                           double &nearestSquared) const {
+  if (first >= last)
+    return;
+  const unsigned int middle = first + (last - first) / 2;
+  const unsigned int point = tree[middle];
+  const double pointSquared = distanceSquared(point, x, y);
+  if (pointSquared < nearestSquared
+      || (pointSquared == nearestSquared && point < nearest)) {
+    nearestSquared = pointSquared;
+    nearest = point;
+  }
+
+  // Search the half holding the position first, then the other half only
+  // if the splitting line is nearer than the nearest point found
+  const double split =
+      (depth % 2 == 0) ? x - xFeet[point] : y - yFeet[point];
+  if (split < 0) {
+    searchTree(first, middle, depth + 1, x, y, nearest, nearestSquared);
+    if (split * split < nearestSquared)
+      searchTree(middle + 1, last, depth + 1, x, y, nearest, nearestSquared);
+  } else {
+    searchTree(middle + 1, last, depth + 1, x, y, nearest, nearestSquared);
+    if (split * split <= nearestSquared)
+      searchTree(first, middle, depth + 1, x, y, nearest, nearestSquared);
+  }
+  return;
+}
@@ -0,0 +1,64 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file PathIndex.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief Fast nearest point and lookahead point queries on a spline path
+ *
+ * A path follower finds the point of its path nearest the chassis every control period, and a
+ * point a set distance further along.  The path index samples a spline path at evenly spaced
+ * distances into contiguous x and y arrays, and answers those queries without scanning every
+ * point:
+ *
+ * - findNearest searches a two dimensional tree of the points (a balanced k-d tree, stored as
+ *   a reordered array of point indexes with each subtree's median at its middle), in
+ *   logarithmic time, for when nothing is known about where the chassis is;
+ * - findNearestFrom walks along the path from a hint (the previous period's nearest point),
+ *   for as long as the points get closer, in amortized constant time as the chassis moves
+ *   along the path (it finds the nearest point along the path near the hint, so a path that
+ *   doubles back near itself is not mistaken for its later part);
+ * - findLookahead steps a distance along the path from a point in constant time, since the
+ *   points are evenly spaced.
+ *
+ */
+#ifndef PATHINDEX_HPP_
+#define PATHINDEX_HPP_
+
+#include <vector>
+#include "SplinePath.hpp"
+
+/** @brief Indexes the points of a spline path for nearest and lookahead point queries
+ */
+
+class PathIndex {
+ public:
+  PathIndex();
+  virtual ~PathIndex();
+  bool build(const SplinePath &splinePath, const double stepFeet);
+  unsigned int size() const;
+  double getSpacingFeet() const;
+  double getXFeet(const unsigned int index) const;
+  double getYFeet(const unsigned int index) const;
+  unsigned int findNearest(const double x, const double y) const;
+  unsigned int findNearestFrom(const double x, const double y,
+                               const unsigned int hint) const;
+  unsigned int findLookahead(const unsigned int index,
+                             const double lookaheadFeet) const;
+
+ private:
+  double distanceSquared(const unsigned int index, const double x,
+                         const double y) const;
+  void buildTree(const unsigned int first, const unsigned int last,
+                 const unsigned int depth);
+  void searchTree(const unsigned int first, const unsigned int last,
+                  const unsigned int depth, const double x, const double y,
+                  unsigned int &nearest, double &nearestSquared) const;
+  std::vector<double> xFeet;       // forward position of each point
+  std::vector<double> yFeet;       // rightward position of each point
+  std::vector<unsigned int> tree;  // point indexes in k-d tree order
+  double spacingFeet;              // distance along the path between points
+};
+
+#endif /* PATHINDEX_HPP_ */
@@ -4,6 +4,8 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Added a constructor setting all of the path point values
  *
  * @brief A representation of a point along a path with maximum velocity
  * and maximum acceleration constraints
@@ -21,6 +23,19 @@ PathPoint::PathPoint()
       maxAcceleration() {
 }
 
+/**
+ * @brief Construct a path point with its position and motion constraints
+ * @param [in] MotorPosition pos of the path point
+ * @param [in] MotorVelocity maxV maximum velocity from this path point
+ * @param [in] MotorAcceleration maxA maximum acceleration from this path point
+ */
+PathPoint::PathPoint(const MotorPosition &pos, const MotorVelocity &maxV,
+                     const MotorAcceleration &maxA)
+    : maxVelocity(maxV),
+      maxAcceleration(maxA) {
+  position = pos;
+}
+
 PathPoint::~PathPoint() {
 }
 
@@ -37,7 +52,7 @@ void PathPoint::setMaxVelocity(const MotorVelocity &maxV) {
  * @brief Get the maximum allowable velocity for this path point
  * @return a MotorVelocity value representing the maximum allowable velocity
  */
-MotorVelocity PathPoint::getMaxVelocity() {
+MotorVelocity PathPoint::getMaxVelocity() const {
   return maxVelocity;
 }
 
@@ -54,14 +69,14 @@ void PathPoint::setMaxAcceleration(const MotorAcceleration &maxA) {
  * @brief Get the maximum allowable acceleration for this path point
  * @return a MotorAcceleration value representing the maximum allowable acceleration
  */
-MotorAcceleration PathPoint::getMaxAcceleration() {
+MotorAcceleration PathPoint::getMaxAcceleration() const {
   return maxAcceleration;
 }
 
 /**
  * @brief Show the details of the current path point
  */
-void PathPoint::show() {
+void PathPoint::show() const {
   std::cout << "Position: " << position.getRotations()
             << " rotations; " << "Max Vel: "
             << maxVelocity.getRotationsPerMinute() << " RPM; "
@@ -4,6 +4,8 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Added a constructor setting all of the path point values
  *
  * @brief A representation of a point along a path with maximum velocity
  * and maximum acceleration constraints
@@ -28,12 +30,14 @@
 class PathPoint : public Point {
  public:
   PathPoint();
+  PathPoint(const MotorPosition &pos, const MotorVelocity &maxV,
+            const MotorAcceleration &maxA);
   virtual ~PathPoint();
   void setMaxVelocity(const MotorVelocity &maxV);
-  MotorVelocity getMaxVelocity();
+  MotorVelocity getMaxVelocity() const;
   void setMaxAcceleration(const MotorAcceleration &maxA);
-  MotorAcceleration getMaxAcceleration();
-  void show();
+  MotorAcceleration getMaxAcceleration() const;
+  void show() const;
 
  private:
   MotorVelocity maxVelocity;
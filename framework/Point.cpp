@@ -4,6 +4,7 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
+ * @date Oct 19, 2026 - Const-correct accessors; optional copy counting
  *
  * @brief A base class to define common members of Point objects
  *
@@ -35,15 +36,55 @@ void Point::setPosition(const MotorPosition &pos) {
  * @brief Get the previously set position of a generic Point object
  * @return MotorPosition position of this point
  */
-MotorPosition Point::getPosition() {
+MotorPosition Point::getPosition() const {
   return position;
 }
 
 /**
  * @brief Show the point's position (in motor rotations)
  */
-void Point::show() {
+void Point::show() const {
   std::cout << "Position: " << position.getRotations()
             << " motor rotations";
   return;
 }
+
+#ifdef MCSF_COUNT_POINT_COPIES
+std::atomic<unsigned long> Point::copyCount(0);
+
+/**
+ * @brief Copy a point, counting the copy
+ * @param [in] Point other point to copy
+ */
+Point::Point(const Point &other)
+    : position(other.position) {
+  copyCount++;
+}
+
+/**
+ * @brief Assign a copy of a point, counting the copy
+ * @param [in] Point other point to copy
+ * @return Point this point
+ */
+Point &Point::operator=(const Point &other) {
+  position = other.position;
+  copyCount++;
+  return *this;
+}
+
+/**
+ * @brief Get the number of point copies made since the count was last reset
+ * @return unsigned long count of point copies
+ */
+unsigned long Point::getCopyCount() {
+  return copyCount;
+}
+
+/**
+ * @brief Reset the count of point copies to zero
+ */
+void Point::resetCopyCount() {
+  copyCount = 0;
+  return;
+}
+#endif
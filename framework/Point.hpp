@@ -4,6 +4,7 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
+ * @date Oct 19, 2026 - Const-correct accessors; optional copy counting
  *
  * @brief A superclass to define Point objects; subclasses will inherit
  *
@@ -12,12 +13,19 @@
  * position with accessor methods to set and get the position.  This
  * superclass is a generalization of those three types of points.
  *
+ * When built with MCSF_COUNT_POINT_COPIES defined, every copy of a point
+ * (of any type) is counted, so tests can verify that an operation makes
+ * no copies of points beyond the ones it has to.
+ *
  */
 #ifndef POINT_HPP_
 #define POINT_HPP_
 
 #include <iostream>
 #include <MotorPosition.hpp>
+#ifdef MCSF_COUNT_POINT_COPIES
+#include <atomic>
+#endif
 
 /** @brief A point is position reference for a motor
  */
@@ -27,11 +35,22 @@ class Point {
   Point();
   virtual ~Point();
   void setPosition(const MotorPosition &pos);
-  MotorPosition getPosition();
-  void show();
+  MotorPosition getPosition() const;
+  void show() const;
+#ifdef MCSF_COUNT_POINT_COPIES
+  Point(const Point &other);
+  Point &operator=(const Point &other);
+  static unsigned long getCopyCount();
+  static void resetCopyCount();
+#endif
 
  protected:
   MotorPosition position;
+
+#ifdef MCSF_COUNT_POINT_COPIES
+ private:
+  static std::atomic<unsigned long> copyCount;  // copies made of any point
+#endif
 };
 
 
@@ -0,0 +1,85 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file PoseWayPoint.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A route-planning Way Point on the field, as a chassis pose
+ *
+ * A pose way point is a position on the field and the heading the chassis should have when
+ * it passes through it, for planning smooth two dimensional routes.  It uses the same
+ * conventions as Odometry: x is along the starting heading, y is to the right of the
+ * starting heading, and a positive heading is a turn to the right.
+ *
+ */
+#include "PoseWayPoint.hpp"
+
+PoseWayPoint::PoseWayPoint()
+    : xFeet(0.0),
+      yFeet(0.0),
+      headingDegrees(0.0) {
+}
+
+/**
+ * @brief Constructor for a pose way point at a position and heading
+ * @param [in] double x - feet forward of the starting position
+ * @param [in] double y - feet right of the starting position
+ * @param [in] double heading - degrees right of the starting heading
+ */
+PoseWayPoint::PoseWayPoint(const double x, const double y,
+                           const double heading)
+    : xFeet(x),
+      yFeet(y),
+      headingDegrees(heading) {
+}
+
+PoseWayPoint::~PoseWayPoint() {
+}
+
+/**
+ * @brief Set the position and heading of this pose way point
+ * @param [in] double x - feet forward of the starting position
+ * @param [in] double y - feet right of the starting position
+ * @param [in] double heading - degrees right of the starting heading
+ */
+void PoseWayPoint::setPose(const double x, const double y,
+                           const double heading) {
+  xFeet = x;
+  yFeet = y;
+  headingDegrees = heading;
+  return;
+}
+
+/**
+ * @brief Get the forward position of this pose way point
+ * @return double feet forward of the starting position
+ */
+double PoseWayPoint::getXFeet() const {
+  return xFeet;
+}
+
+/**
+ * @brief Get the rightward position of this pose way point
+ * @return double feet right of the starting position
+ */
+double PoseWayPoint::getYFeet() const {
+  return yFeet;
+}
+
+/**
+ * @brief Get the heading of this pose way point
+ * @return double degrees right of the starting heading
+ */
+double PoseWayPoint::getHeadingDegrees() const {
+  return headingDegrees;
+}
+
+/**
+ * @brief Show the pose of this way point on the default output device
+ */
+void PoseWayPoint::show() const {
+  std::cout << "Pose way point x " << xFeet << " ft, y " << yFeet
+            << " ft, heading " << headingDegrees << " deg";
+  return;
+}
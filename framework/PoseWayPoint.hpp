@@ -0,0 +1,41 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file PoseWayPoint.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A route-planning Way Point on the field, as a chassis pose
+ *
+ * A pose way point is a position on the field and the heading the chassis should have when
+ * it passes through it, for planning smooth two dimensional routes.  It uses the same
+ * conventions as Odometry: x is along the starting heading, y is to the right of the
+ * starting heading, and a positive heading is a turn to the right.
+ *
+ */
+#ifndef POSEWAYPOINT_HPP_
+#define POSEWAYPOINT_HPP_
+
+#include <iostream>
+
+/** @brief A way point with a field position and heading
+ */
+
+class PoseWayPoint {
+ public:
+  PoseWayPoint();
+  PoseWayPoint(const double x, const double y, const double heading);
+  virtual ~PoseWayPoint();
+  void setPose(const double x, const double y, const double heading);
+  double getXFeet() const;
+  double getYFeet() const;
+  double getHeadingDegrees() const;
+  void show() const;
+
+ private:
+  double xFeet;           // forward of the starting position
+  double yFeet;           // right of the starting position
+  double headingDegrees;  // positive to the right of the starting heading
+};
+
+#endif /* POSEWAYPOINT_HPP_ */
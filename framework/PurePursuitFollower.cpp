@@ -0,0 +1,148 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file PurePursuitFollower.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A pure pursuit controller for steering a tank drive along a spline path
+ *
+ * Each control period, the follower finds the point of its path nearest the chassis's pose
+ * (walking on from the last period's nearest point, through a PathIndex), picks the point a
+ * lookahead distance further along the path, and steers the chassis onto the circular arc
+ * from its pose through that point: an arc to a point ahead by x and to the side by y has
+ * curvature 2 * y / (x * x + y * y).  The commanded chassis velocity is split between the two
+ * sides of the drive for that curvature.  Poses use the same conventions as Odometry.
+ *
+ */
+#include <cmath>
+#include "PurePursuitFollower.hpp"
+
+PurePursuitFollower::PurePursuitFollower()
+    : pathIndex(nullptr),
+      lookaheadFeet(1.0),
+      widthInFeet(0.0),
+      nearestIndex(0),
+      lastCurvaturePerFoot(0.0) {
+}
+
+PurePursuitFollower::~PurePursuitFollower() {
+}
+
+/**
+ * @brief Set the path to follow, and start following it from its beginning
+ * @param [in] PathIndex index of the path to follow (must outlive its use by the follower)
+ */
+void PurePursuitFollower::setPathIndex(const PathIndex &index) {
+  pathIndex = &index;
+  reset();
+  return;
+}
+
+/**
+ * @brief Set the distance along the path, past the nearest point, to steer toward
+ * @param [in] double lookahead distance in feet
+ */
+void PurePursuitFollower::setLookaheadFeet(const double lookahead) {
+  lookaheadFeet = lookahead;
+  return;
+}
+
+/**
+ * @brief Get the distance along the path, past the nearest point, to steer toward
+ * @return double lookahead distance in feet
+ */
+double PurePursuitFollower::getLookaheadFeet() const {
+  return lookaheadFeet;
+}
+
+/**
+ * @brief Set the distance between the left and right sides of the drive
+ * @param [in] double width in feet
+ */
+void PurePursuitFollower::setWidthInFeet(const double width) {
+  widthInFeet = width;
+  return;
+}
+
+/**
+ * @brief Get the distance between the left and right sides of the drive
+ * @return double width in feet
+ */
+double PurePursuitFollower::getWidthInFeet() const {
+  return widthInFeet;
+}
+
+/**
+ * @brief Start following the path from its beginning again
+ */
+void PurePursuitFollower::reset() {
+  nearestIndex = 0;
+  lastCurvaturePerFoot = 0.0;
+  return;
+}
+
+/**
+ * @brief Calculate the side velocities that steer the chassis along the path for one period
+ * @param [in] double x - feet forward of the starting position
+ * @param [in] double y - feet right of the starting position
+ * @param [in] double headingDegrees - degrees right of the starting heading
+ * @param [in] ChassisVelocity chassisVelocity to move the chassis center at
+ * @param [out] ChassisVelocity leftVelocity for the left side
+ * @param [out] ChassisVelocity rightVelocity for the right side
+ * @return bool indication of whether there is a path to follow
+ */
+bool PurePursuitFollower::calculate(const double x, const double y,
+                                    const double headingDegrees,
+                                    const ChassisVelocity &chassisVelocity,
+                                    ChassisVelocity &leftVelocity,
+                                    ChassisVelocity &rightVelocity) {
+  if (pathIndex == nullptr || pathIndex->size() == 0)
+    return false;
+
+  // The lookahead point, in the chassis's frame (ahead, and to the right)
+  nearestIndex = pathIndex->findNearestFrom(x, y, nearestIndex);
+  const unsigned int target = pathIndex->findLookahead(nearestIndex,
+                                                       lookaheadFeet);
+  const double dx = pathIndex->getXFeet(target) - x;
+  const double dy = pathIndex->getYFeet(target) - y;
+  const double heading = headingDegrees * std::acos(-1.0) / 180;
+  const double ahead = dx * std::cos(heading) + dy * std::sin(heading);
+  const double side = -dx * std::sin(heading) + dy * std::cos(heading);
+  const double distanceSquared = ahead * ahead + side * side;
+  lastCurvaturePerFoot =
+      (distanceSquared > 0) ? 2 * side / distanceSquared : 0.0;
+
+  // Turning right (positive curvature), the left side is on the outside
+  const double offsetScale = lastCurvaturePerFoot * 0.5 * widthInFeet;
+  leftVelocity.setFeetPerSecond(
+      chassisVelocity.getFeetPerSecond() * (1 + offsetScale));
+  rightVelocity.setFeetPerSecond(
+      chassisVelocity.getFeetPerSecond() * (1 - offsetScale));
+  return true;
+}
+
+/**
+ * @brief Get the path point nearest the chassis at the last period
+ * @return unsigned int index of the nearest point
+ */
+unsigned int PurePursuitFollower::getNearestIndex() const {
+  return nearestIndex;
+}
+
+/**
+ * @brief Get the curvature steered at the last period
+ * @return double curvature in 1/feet (positive turning right)
+ */
+double PurePursuitFollower::getLastCurvaturePerFoot() const {
+  return lastCurvaturePerFoot;
+}
+
+/**
+ * @brief Check whether the chassis has reached the end of the path
+ * @return bool indication of whether the nearest point at the last period was the last one
+ */
+bool PurePursuitFollower::isAtEnd() const {
+  return pathIndex != nullptr && pathIndex->size() > 0
+      && nearestIndex + 1 >= pathIndex->size();
+}
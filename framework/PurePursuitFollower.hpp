@@ -0,0 +1,52 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file PurePursuitFollower.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A pure pursuit controller for steering a tank drive along a spline path
+ *
+ * Each control period, the follower finds the point of its path nearest the chassis's pose
+ * (walking on from the last period's nearest point, through a PathIndex), picks the point a
+ * lookahead distance further along the path, and steers the chassis onto the circular arc
+ * from its pose through that point: an arc to a point ahead by x and to the side by y has
+ * curvature 2 * y / (x * x + y * y).  The commanded chassis velocity is split between the two
+ * sides of the drive for that curvature.  Poses use the same conventions as Odometry.
+ *
+ */
+#ifndef PUREPURSUITFOLLOWER_HPP_
+#define PUREPURSUITFOLLOWER_HPP_
+
+#include "ChassisVelocity.hpp"
+#include "PathIndex.hpp"
+
+/** @brief Steers a tank drive along an indexed path toward a point ahead on it
+ */
+
+class PurePursuitFollower {
+ public:
+  PurePursuitFollower();
+  virtual ~PurePursuitFollower();
+  void setPathIndex(const PathIndex &index);
+  void setLookaheadFeet(const double lookahead);
+  double getLookaheadFeet() const;
+  void setWidthInFeet(const double width);
+  double getWidthInFeet() const;
+  void reset();
+  bool calculate(const double x, const double y, const double headingDegrees,
+                 const ChassisVelocity &chassisVelocity,
+                 ChassisVelocity &leftVelocity, ChassisVelocity &rightVelocity);
+  unsigned int getNearestIndex() const;
+  double getLastCurvaturePerFoot() const;
+  bool isAtEnd() const;
+
+ private:
+  const PathIndex *pathIndex;
+  double lookaheadFeet;         // distance along the path to steer toward
+  double widthInFeet;           // distance between the left and right sides
+  unsigned int nearestIndex;    // nearest path point at the last period
+  double lastCurvaturePerFoot;  // curvature steered at the last period
+};
+
+#endif /* PUREPURSUITFOLLOWER_HPP_ */
@@ -4,17 +4,38 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Added grid way points and path planning across a field map
+ * @date Oct 19, 2026 - Path points constructed in place
+ * @date Oct 19, 2026 - Added incremental re-planning of grid paths as the map changes
+ * @date Oct 19, 2026 - Added pose way points and smooth spline paths through them
+ * @date Oct 19, 2026 - Added ordering of pose way points for the fastest visit
  *
  * @brief A Route represents a series of Way Points to be traveled to
  *
  * Routes are planned as a series of Way Points indicating positions
  * to be traveled to.
  *
+ * A route across a field map is a series of grid way points (cells of an
+ * OccupancyGrid); its path is planned by a GridPlanner, one leg between
+ * consecutive grid way points at a time, and reduced to the cells where the
+ * route changes direction.  The path points are at the distances traveled
+ * along the route to each of those corners.  When cells of the map change,
+ * the path can be re-planned with one IncrementalGridPlanner per leg, each
+ * repairing its leg's previous search rather than searching again.
+ *
+ * A smooth route on the field is a series of pose way points (positions
+ * with headings); its spline path passes through each of them along its
+ * heading, and can be sampled by distance along it.
+ *
  */
+#include <cmath>
 #include "Route.hpp"
 
 Route::Route()
-    : route() {
+    : route(),
+      gridRoute(),
+      poseRoute() {
 }
 
 Route::~Route() {
@@ -36,24 +57,256 @@ void Route::addWayPoint(const WayPoint &wayPoint) {
  * @return a Path object specifying the path points to traverse
  */
 Path Route::planPath(const MotorVelocity &maxVelocity,
-                     const MotorAcceleration &maxAcceleration) {
+                     const MotorAcceleration &maxAcceleration) const {
   Path path;
-  for (auto wp : route) {
-    PathPoint pathpoint;
-    pathpoint.setPosition(wp.getPosition());
-    pathpoint.setMaxVelocity(maxVelocity);
-    pathpoint.setMaxAcceleration(maxAcceleration);
-    path.addPathPoint(pathpoint);
-  }
+  path.reserve(route.size());
+  for (const auto &wp : route)
+    path.emplacePathPoint(wp.getPosition(), maxVelocity, maxAcceleration);
   return path;
 }
 
+/**
+ * @brief Add a grid way point (a cell of a field map) to this route
+ * @param [in] unsigned int column of the way point's cell
+ * @param [in] unsigned int row of the way point's cell
+ */
+void Route::addGridWayPoint(const unsigned int column,
+                            const unsigned int row) {
+  gridRoute.push_back(GridWayPoint { column, row });
+  return;
+}
+
+/**
+ * @brief Get the number of grid way points on this route
+ * @return unsigned int count of grid way points
+ */
+unsigned int Route::getGridWayPointCount() const {
+  return gridRoute.size();
+}
+
+/**
+ * @brief Plan a path through this route's grid way points, around the obstacles of a field map
+ * @param [in] GridPlanner planner with the field map's grid set (its search buffers are re-used)
+ * @param [in] double motorRotPerMovementFoot to convert distances along the route to positions
+ * @param [in] MotorVelocity maxVelocity for every path point
+ * @param [in] MotorAcceleration maxAcceleration for every path point
+ * @param [out] Path path with a path point at the start, each corner, and the end of the route
+ * @param [out] vector of unsigned int cornerCells - the grid cell of each path point
+ * @return bool indication of whether every leg of the route could be planned
+ */
+bool Route::planGridPath(GridPlanner &planner,
+                         const double motorRotPerMovementFoot,
+                         const MotorVelocity &maxVelocity,
+                         const MotorAcceleration &maxAcceleration, Path &path,
+                         std::vector<unsigned int> &cornerCells) const {
+  path = Path();
+  cornerCells.clear();
+  const OccupancyGrid *grid = planner.getGrid();
+  if (grid == nullptr || gridRoute.size() < 2)
+    return false;
+
+  // Plan each leg, keeping the cells where the route changes direction
+  std::vector<unsigned int> legCells;
+  for (std::vector<GridWayPoint>::size_type leg = 1; leg < gridRoute.size();
+      leg++) {
+    if (!planner.plan(gridRoute[leg - 1].column, gridRoute[leg - 1].row,
+                      gridRoute[leg].column, gridRoute[leg].row, legCells)) {
+      cornerCells.clear();
+      return false;
+    }
+    appendLegCorners(*grid, legCells, cornerCells);
+  }
+  placeCornerPathPoints(*grid, motorRotPerMovementFoot, maxVelocity,
+                        maxAcceleration, cornerCells, path);
+  return true;
+}
+
+/**
+ * @brief Re-plan the path of this route across a field map after cells of the map change,
+ * repairing each leg's previous search instead of searching again
+ * @param [in/out] vector of IncrementalGridPlanner legPlanners - one planner per leg, holding
+ * that leg's search (at least one, the first with the grid set; resized to the number of legs,
+ * and a leg whose planner holds no search for it is planned from scratch)
+ * @param [in] vector of unsigned int changedCells - indexes of the cells whose occupancy
+ * changed since the last plan (the grid must already hold their new occupancy)
+ * @param [in] double motorRotPerMovementFoot for converting distance to motor position
+ * @param [in] MotorVelocity maxVelocity allowed at each path point
+ * @param [in] MotorAcceleration maxAcceleration allowed at each path point
+ * @param [out] Path path with a path point at each corner of the route
+ * @param [out] vector of unsigned int cornerCells - the cells where the route changes direction
+ * @return bool indication of whether every leg of the route could be planned
+ */
+bool Route::replanGridPath(std::vector<IncrementalGridPlanner> &legPlanners,
+                           const std::vector<unsigned int> &changedCells,
+                           const double motorRotPerMovementFoot,
+                           const MotorVelocity &maxVelocity,
+                           const MotorAcceleration &maxAcceleration,
+                           Path &path,
+                           std::vector<unsigned int> &cornerCells) const {
+  path = Path();
+  cornerCells.clear();
+  if (legPlanners.empty() || legPlanners.front().getGrid() == nullptr
+      || gridRoute.size() < 2)
+    return false;
+  const OccupancyGrid *grid = legPlanners.front().getGrid();
+  legPlanners.resize(gridRoute.size() - 1);
+
+  std::vector<unsigned int> legCells;
+  for (std::vector<GridWayPoint>::size_type leg = 1; leg < gridRoute.size();
+      leg++) {
+    IncrementalGridPlanner &planner = legPlanners[leg - 1];
+    if (planner.getGrid() != grid)
+      planner.setGrid(*grid);
+    bool planned;
+    if (planner.isPlannedFor(gridRoute[leg - 1].column, gridRoute[leg - 1].row,
+                             gridRoute[leg].column, gridRoute[leg].row))
+      planned = planner.update(changedCells, legCells);
+    else
+      planned = planner.plan(gridRoute[leg - 1].column, gridRoute[leg - 1].row,
+                             gridRoute[leg].column, gridRoute[leg].row,
+                             legCells);
+    if (!planned) {
+      cornerCells.clear();
+      return false;
+    }
+    appendLegCorners(*grid, legCells, cornerCells);
+  }
+  placeCornerPathPoints(*grid, motorRotPerMovementFoot, maxVelocity,
+                        maxAcceleration, cornerCells, path);
+  return true;
+}
+
+/**
+ * @brief Add the cells of a leg where the route changes direction to the route's corners
+ * (the cell joining two legs is only kept once)
+ * @param [in] OccupancyGrid grid the leg was planned across
+ * @param [in] vector of unsigned int legCells - every cell on the leg, from start to end
+ * @param [in/out] vector of unsigned int cornerCells - the route's corners so far
+ */
+void Route::appendLegCorners(const OccupancyGrid &grid,
+                             const std::vector<unsigned int> &legCells,
+                             std::vector<unsigned int> &cornerCells) {
+  if (legCells.empty())
+    return;
+  if (cornerCells.empty())
+    cornerCells.push_back(legCells.front());
+
+  // The direction the route was last moving in, from its last two corners
+  int lastColumnStep = 0, lastRowStep = 0;
+  if (cornerCells.size() > 1) {
+    const int columns = static_cast<int>(grid.cellColumn(cornerCells.back()))
+        - static_cast<int>(grid.cellColumn(cornerCells[cornerCells.size() - 2]));
+    const int rows = static_cast<int>(grid.cellRow(cornerCells.back()))
+        - static_cast<int>(grid.cellRow(cornerCells[cornerCells.size() - 2]));
+    lastColumnStep = (columns > 0) - (columns < 0);
+    lastRowStep = (rows > 0) - (rows < 0);
+  }
+  for (std::vector<unsigned int>::size_type i = 1; i < legCells.size(); i++) {
+    const int columnStep = static_cast<int>(grid.cellColumn(legCells[i]))
+        - static_cast<int>(grid.cellColumn(legCells[i - 1]));
+    const int rowStep = static_cast<int>(grid.cellRow(legCells[i]))
+        - static_cast<int>(grid.cellRow(legCells[i - 1]));
+    // Continuing in the same direction moves the last corner along
+    if (cornerCells.size() > 1 && columnStep == lastColumnStep
+        && rowStep == lastRowStep)
+      cornerCells.back() = legCells[i];
+    else
+      cornerCells.push_back(legCells[i]);
+    lastColumnStep = columnStep;
+    lastRowStep = rowStep;
+  }
+  return;
+}
+
+/**
+ * @brief Place a path point at the distance traveled to each corner of a route
+ * @param [in] OccupancyGrid grid the route was planned across
+ * @param [in] double motorRotPerMovementFoot for converting distance to motor position
+ * @param [in] MotorVelocity maxVelocity allowed at each path point
+ * @param [in] MotorAcceleration maxAcceleration allowed at each path point
+ * @param [in] vector of unsigned int cornerCells - the cells where the route changes direction
+ * @param [out] Path path to add the path points to
+ */
+void Route::placeCornerPathPoints(const OccupancyGrid &grid,
+                                  const double motorRotPerMovementFoot,
+                                  const MotorVelocity &maxVelocity,
+                                  const MotorAcceleration &maxAcceleration,
+                                  const std::vector<unsigned int> &cornerCells,
+                                  Path &path) {
+  path.reserve(cornerCells.size());
+  double distanceFeet = 0.0;
+  MotorPosition position;
+  for (std::vector<unsigned int>::size_type i = 0; i < cornerCells.size();
+      i++) {
+    if (i > 0) {
+      const double columns = static_cast<double>(grid.cellColumn(
+          cornerCells[i])) - grid.cellColumn(cornerCells[i - 1]);
+      const double rows = static_cast<double>(grid.cellRow(cornerCells[i]))
+          - grid.cellRow(cornerCells[i - 1]);
+      distanceFeet += std::sqrt(columns * columns + rows * rows)
+          * grid.getCellSizeFeet();
+    }
+    position.setFromDistanceFeetByRotPerMovementFoot(distanceFeet,
+                                                     motorRotPerMovementFoot);
+    path.emplacePathPoint(position, maxVelocity, maxAcceleration);
+  }
+  return;
+}
+
+/**
+ * @brief Add a pose way point to this route's smooth route on the field
+ * @param [in] PoseWayPoint poseWayPoint to be added to this route
+ */
+void Route::addPoseWayPoint(const PoseWayPoint &poseWayPoint) {
+  poseRoute.push_back(poseWayPoint);
+  return;
+}
+
+/**
+ * @brief Get the number of pose way points in this route
+ * @return unsigned int count of pose way points
+ */
+unsigned int Route::getPoseWayPointCount() const {
+  return poseRoute.size();
+}
+
+/**
+ * @brief Reorder this route's pose way points for the fastest estimated visit to all of them
+ * @param [in/out] RouteOptimizer optimizer with the chassis's motion limits and time budget
+ * @param [out] vector of unsigned int order - previous indices of the pose way points, in
+ * their new order (the first pose way point stays first)
+ * @return bool indication of whether the pose way points could be ordered (if not, they are
+ * left as they were)
+ */
+bool Route::orderPoseWayPoints(RouteOptimizer &optimizer,
+                               std::vector<unsigned int> &order) {
+  if (!optimizer.optimize(poseRoute, order))
+    return false;
+  std::vector<PoseWayPoint> orderedRoute;
+  orderedRoute.reserve(poseRoute.size());
+  for (const auto index : order)
+    orderedRoute.push_back(poseRoute[index]);
+  poseRoute.swap(orderedRoute);
+  return true;
+}
+
+/**
+ * @brief Plan a smooth spline path through this route's pose way points
+ * @param [out] SplinePath splinePath through the pose way points
+ * @param [in] double tableStepFeet - distance between the spline's arc length table entries
+ * @return bool indication of whether the spline path could be planned
+ */
+bool Route::planSplinePath(SplinePath &splinePath,
+                           const double tableStepFeet) const {
+  return splinePath.generate(poseRoute, tableStepFeet);
+}
+
 /**
  * @brief Show the details of this route on the default output device
  */
-void Route::show() {
+void Route::show() const {
   std::cout << "Route way points:" << std::endl;
-  for (auto wayPoint : route) {
+  for (const auto &wayPoint : route) {
     wayPoint.show();
     std::cout << std::endl;
   }
@@ -4,19 +4,43 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 5, 2017 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Added grid way points and path planning across a field map
+ * @date Oct 19, 2026 - Added incremental re-planning of grid paths as the map changes
+ * @date Oct 19, 2026 - Added pose way points and smooth spline paths through them
+ * @date Oct 19, 2026 - Added ordering of pose way points for the fastest visit
  *
  * @brief A Route represents a series of Way Points to be traveled to
  *
  * Routes are planned as a series of Way Points indicating positions
  * to be traveled to.
  *
+ * A route across a field map is a series of grid way points (cells of an
+ * OccupancyGrid); its path is planned by a GridPlanner, one leg between
+ * consecutive grid way points at a time, and reduced to the cells where the
+ * route changes direction.  The path points are at the distances traveled
+ * along the route to each of those corners.  When cells of the map change,
+ * the path can be re-planned with one IncrementalGridPlanner per leg, each
+ * repairing its leg's previous search rather than searching again.
+ *
+ * A smooth route on the field is a series of pose way points (positions
+ * with headings); its spline path passes through each of them along its
+ * heading, and can be sampled by distance along it.  When the pose way
+ * points are locations that may be visited in any order, a RouteOptimizer
+ * can reorder them (after the first) for the fastest estimated visit.
+ *
  */
 #ifndef ROUTE_HPP_
 #define ROUTE_HPP_
 
 #include <iostream>
 #include <vector>
+#include "GridPlanner.hpp"
+#include "IncrementalGridPlanner.hpp"
 #include "Path.hpp"
+#include "PoseWayPoint.hpp"
+#include "RouteOptimizer.hpp"
+#include "SplinePath.hpp"
 #include "WayPoint.hpp"
 
 /** @brief A Route represents a series of Way Points to be traveled to
@@ -28,11 +52,45 @@ class Route {
   virtual ~Route();
   void addWayPoint(const WayPoint &wayPoint);
   Path planPath(const MotorVelocity &maxVelocity,
-                const MotorAcceleration &maxAcceleration);
-  void show();
+                const MotorAcceleration &maxAcceleration) const;
+  void addGridWayPoint(const unsigned int column, const unsigned int row);
+  unsigned int getGridWayPointCount() const;
+  bool planGridPath(GridPlanner &planner, const double motorRotPerMovementFoot,
+                    const MotorVelocity &maxVelocity,
+                    const MotorAcceleration &maxAcceleration, Path &path,
+                    std::vector<unsigned int> &cornerCells) const;
+  bool replanGridPath(std::vector<IncrementalGridPlanner> &legPlanners,
+                      const std::vector<unsigned int> &changedCells,
+                      const double motorRotPerMovementFoot,
+                      const MotorVelocity &maxVelocity,
+                      const MotorAcceleration &maxAcceleration, Path &path,
+                      std::vector<unsigned int> &cornerCells) const;
+  void addPoseWayPoint(const PoseWayPoint &poseWayPoint);
+  unsigned int getPoseWayPointCount() const;
+  bool orderPoseWayPoints(RouteOptimizer &optimizer,
+                          std::vector<unsigned int> &order);
+  bool planSplinePath(SplinePath &splinePath,
+                      const double tableStepFeet) const;
+  void show() const;
 
  private:
+  // A way point on a field map, as a grid cell
+  struct GridWayPoint {
+    unsigned int column;
+    unsigned int row;
+  };
+  static void appendLegCorners(const OccupancyGrid &grid,
+                               const std::vector<unsigned int> &legCells,
+                               std::vector<unsigned int> &cornerCells);
+  static void placeCornerPathPoints(const OccupancyGrid &grid,
+                                    const double motorRotPerMovementFoot,
+                                    const MotorVelocity &maxVelocity,
+                                    const MotorAcceleration &maxAcceleration,
+                                    const std::vector<unsigned int> &cornerCells,
+                                    Path &path);
   std::vector<WayPoint> route;
+  std::vector<GridWayPoint> gridRoute;
+  std::vector<PoseWayPoint> poseRoute;
 };
 
 #endif /* ROUTE_HPP_ */
@@ -0,0 +1,425 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file RouteOptimizer.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Added a cap on the perturbations each worker makes
+ *
+ * @brief Orders the locations of a route for the shortest time to visit them all
+ *
+ * The route optimizer finds a fast order in which to visit a set of locations on the field,
+ * starting from the first of them (the chassis's starting location) and ending wherever the
+ * last visit happens to be.  The cost of each move between two locations is the time to
+ * travel straight between them from rest to rest, accelerating and decelerating at the
+ * chassis's maximum acceleration and cruising at no more than its maximum velocity (a
+ * trapezoidal velocity profile, or a triangular one if the move is too short to reach the
+ * maximum velocity).  Because short moves are dominated by accelerating and stopping, this
+ * ranks orders differently than their distance alone would.
+ *
+ * Finding the fastest order exactly takes time exponential in the number of locations, so the
+ * optimizer searches within a time budget instead.  It starts from the nearest neighbor order
+ * (always moving to the quickest unvisited location next), then improves it with 2-opt moves
+ * (reversing a stretch of the order) and Or-opt moves (moving a stretch of one to three
+ * locations elsewhere in the order, either way round) until no such move helps.  Each worker
+ * thread then repeatedly perturbs its best order (a double bridge: cutting it into four
+ * stretches and swapping the middle two, which 2-opt and Or-opt cannot undo in one move) and
+ * improves it again, keeping the result if it is faster, until the budget is spent (or, if a
+ * cap is set, until it has made that many perturbations, so a single worker's result does not
+ * depend on the speed of the machine).  The fastest order found by any worker is returned.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+#include "RouteOptimizer.hpp"
+
+namespace {
+// Smallest time saving (in seconds) counted as an improvement, so rounding
+// differences between equal orders do not cycle forever
+const double improvementSeconds = 1e-9;
+// Longest stretch of locations moved by an Or-opt move
+const unsigned int maxOrOptLength = 3;
+}  // namespace
+
+RouteOptimizer::RouteOptimizer()
+    : maxVelocityFPS(0.0),
+      maxAccelerationFPSS(0.0),
+      timeBudgetMS(10),
+      threadCount(0),
+      maxPerturbations(0),
+      locationCount(0),
+      moveSecondsTable(),
+      nearestNeighborSeconds(0.0),
+      bestSeconds(0.0),
+      perturbationCount(0) {
+}
+
+RouteOptimizer::~RouteOptimizer() {
+}
+
+/**
+ * @brief Set the chassis's limits used to estimate the time of each move
+ * @param [in] ChassisVelocity maxVelocity the chassis may cruise at
+ * @param [in] ChassisAcceleration maxAcceleration the chassis may speed up and slow down at
+ */
+void RouteOptimizer::setMotionLimits(
+    const ChassisVelocity &maxVelocity,
+    const ChassisAcceleration &maxAcceleration) {
+  maxVelocityFPS = maxVelocity.getFeetPerSecond();
+  maxAccelerationFPSS = maxAcceleration.getFeetPerSecondPerSecond();
+  return;
+}
+
+/**
+ * @brief Set the time allowed for improving the order after the nearest neighbor order is found
+ * @param [in] unsigned int budgetMS - search time allowed, in milliseconds
+ */
+void RouteOptimizer::setTimeBudgetMS(const unsigned int budgetMS) {
+  timeBudgetMS = budgetMS;
+  return;
+}
+
+/**
+ * @brief Get the time allowed for improving the order
+ * @return unsigned int search time allowed, in milliseconds
+ */
+unsigned int RouteOptimizer::getTimeBudgetMS() const {
+  return timeBudgetMS;
+}
+
+/**
+ * @brief Set the number of worker threads searching for faster orders
+ * @param [in] unsigned int count of worker threads (0 for one per hardware thread)
+ */
+void RouteOptimizer::setThreadCount(const unsigned int count) {
+  threadCount = count;
+  return;
+}
+
+/**
+ * @brief Set the most perturbations each worker makes, even if time remains in the budget
+ * @param [in] unsigned int count of perturbations per worker (0 for no limit)
+ */
+void RouteOptimizer::setMaxPerturbations(const unsigned int count) {
+  maxPerturbations = count;
+  return;
+}
+
+/**
+ * @brief Get the most perturbations each worker makes
+ * @return unsigned int count of perturbations per worker (0 for no limit)
+ */
+unsigned int RouteOptimizer::getMaxPerturbations() const {
+  return maxPerturbations;
+}
+
+/**
+ * @brief Estimate the time to move straight between two locations, from rest to rest
+ * @param [in] double distanceFeet between the locations
+ * @return double time in seconds at the chassis's limits
+ */
+double RouteOptimizer::estimateMoveSeconds(const double distanceFeet) const {
+  if (distanceFeet <= 0)
+    return 0.0;
+
+  // Cruise if the maximum velocity is reached before half way, otherwise
+  // accelerate to half way and decelerate from there
+  const double rampFeet = maxVelocityFPS * maxVelocityFPS
+      / maxAccelerationFPSS;
+  if (distanceFeet >= rampFeet)
+    return distanceFeet / maxVelocityFPS + maxVelocityFPS / maxAccelerationFPSS;
+  return 2 * std::sqrt(distanceFeet / maxAccelerationFPSS);
+}
+
+/**
+ * @brief Find a fast order in which to visit locations, starting from the first of them
+ * @param [in] vector of PoseWayPoint locations to visit (the first is where the chassis
+ * starts; their headings are not used)
+ * @param [out] vector of unsigned int order - indices of the locations in visiting order,
+ * starting with 0
+ * @return bool indication of whether an order was found (false if there are no locations, or
+ * the motion limits are not positive)
+ */
+bool RouteOptimizer::optimize(const std::vector<PoseWayPoint> &locations,
+                              std::vector<unsigned int> &order) {
+  order.clear();
+  nearestNeighborSeconds = 0.0;
+  bestSeconds = 0.0;
+  perturbationCount = 0;
+  if (locations.empty() || maxVelocityFPS <= 0 || maxAccelerationFPSS <= 0)
+    return false;
+  const Deadline deadline = std::chrono::steady_clock::now()
+      + std::chrono::milliseconds(timeBudgetMS);
+
+  // Every move's time is estimated once, up front
+  locationCount = locations.size();
+  moveSecondsTable.resize(locationCount * locationCount);
+  for (unsigned int from = 0; from < locationCount; from++)
+    for (unsigned int to = 0; to < locationCount; to++)
+      moveSecondsTable[from * locationCount + to] = estimateMoveSeconds(
+          std::hypot(locations[to].getXFeet() - locations[from].getXFeet(),
+                     locations[to].getYFeet() - locations[from].getYFeet()));
+
+  nearestNeighborOrder(order);
+  nearestNeighborSeconds = orderSeconds(order);
+
+  // Each worker improves the seed order with its own perturbations; the
+  // fastest of their results is kept
+  unsigned int workerCount = threadCount;
+  if (workerCount == 0)
+    workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+  std::vector<std::vector<unsigned int>> workerOrders(workerCount, order);
+  std::vector<unsigned int> workerPerturbations(workerCount, 0);
+  std::vector<std::thread> workers;
+  for (unsigned int w = 1; w < workerCount; w++)
+    workers.emplace_back(&RouteOptimizer::search, this, w, std::cref(deadline),
+                         std::ref(workerOrders[w]),
+                         std::ref(workerPerturbations[w]));
+  search(0, deadline, workerOrders[0], workerPerturbations[0]);
+  for (auto &thread : workers)
+    thread.join();
+  for (const unsigned int perturbations : workerPerturbations)
+    perturbationCount += perturbations;
+
+  bestSeconds = nearestNeighborSeconds;
+  for (const auto &workerOrder : workerOrders) {
+    const double workerSeconds = orderSeconds(workerOrder);
+    if (workerSeconds < bestSeconds) {
+      bestSeconds = workerSeconds;
+      order = workerOrder;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Get the estimated time of the nearest neighbor order from the last optimize
+ * @return double time in seconds to visit every location in that order
+ */
+double RouteOptimizer::getNearestNeighborSeconds() const {
+  return nearestNeighborSeconds;
+}
+
+/**
+ * @brief Get the estimated time of the order returned by the last optimize
+ * @return double time in seconds to visit every location in that order
+ */
+double RouteOptimizer::getOrderSeconds() const {
+  return bestSeconds;
+}
+
+/**
+ * @brief Get the number of perturbations made by all workers in the last optimize
+ * @return unsigned int count of perturbations
+ */
+unsigned int RouteOptimizer::getPerturbationCount() const {
+  return perturbationCount;
+}
+
+/**
+ * @brief Estimated time to visit locations in an order
+ * @param [in] vector of unsigned int order - indices of the locations in visiting order
+ * @return double time in seconds
+ */
+double RouteOptimizer::orderSeconds(
+    const std::vector<unsigned int> &order) const {
+  double seconds = 0.0;
+  for (std::vector<unsigned int>::size_type i = 1; i < order.size(); i++)
+    seconds += moveSeconds(order[i - 1], order[i]);
+  return seconds;
+}
+
+/**
+ * @brief Estimated time of the move between two locations
+ * @param [in] unsigned int from - index of the location moved from
+ * @param [in] unsigned int to - index of the location moved to
+ * @return double time in seconds
+ */
+double RouteOptimizer::moveSeconds(const unsigned int from,
+                                   const unsigned int to) const {
+  return moveSecondsTable[from * locationCount + to];
+}
+
+/**
+ * @brief Order the locations by always moving to the quickest unvisited one next
+ * @param [out] vector of unsigned int order - indices of the locations, starting with 0
+ */
+void RouteOptimizer::nearestNeighborOrder(
+    std::vector<unsigned int> &order) const {
+  std::vector<bool> visited(locationCount, false);
+  order.assign(1, 0);
+  visited[0] = true;
+  while (order.size() < locationCount) {
+    unsigned int nearest = 0;
+    for (unsigned int to = 0; to < locationCount; to++)
+      if (!visited[to] && (nearest == 0 || moveSeconds(order.back(), to)
+          < moveSeconds(order.back(), nearest)))
+        nearest = to;
+    visited[nearest] = true;
+    order.push_back(nearest);
+  }
+  return;
+}
+
+/**
+ * @brief Improve an order with 2-opt and Or-opt moves until neither helps or time runs out
+ * @param [in/out] vector of unsigned int order - indices of the locations in visiting order
+ * @param [in] Deadline deadline after which no more passes are started
+ */
+void RouteOptimizer::improve(std::vector<unsigned int> &order,
+                             const Deadline &deadline) const {
+  while (std::chrono::steady_clock::now() < deadline) {
+    const bool twoOptImproved = improveTwoOpt(order);
+    const bool orOptImproved = improveOrOpt(order);
+    if (!twoOptImproved && !orOptImproved)
+      break;
+  }
+  return;
+}
+
+/**
+ * @brief Make one pass of 2-opt moves, reversing each stretch of the order that saves time
+ * @param [in/out] vector of unsigned int order - indices of the locations in visiting order
+ * @return bool indication of whether the order was improved
+ */
+bool RouteOptimizer::improveTwoOpt(std::vector<unsigned int> &order) const {
+  const unsigned int n = order.size();
+  bool improved = false;
+
+  // Reversing the stretch from i to j only changes the moves into and out of
+  // it (the time between two locations is the same either way)
+  for (unsigned int i = 1; i + 1 < n; i++) {
+    for (unsigned int j = i + 1; j < n; j++) {
+      double deltaSeconds = moveSeconds(order[i - 1], order[j])
+          - moveSeconds(order[i - 1], order[i]);
+      if (j + 1 < n)
+        deltaSeconds += moveSeconds(order[i], order[j + 1])
+            - moveSeconds(order[j], order[j + 1]);
+      if (deltaSeconds < -improvementSeconds) {
+        std::reverse(order.begin() + i, order.begin() + j + 1);
+        improved = true;
+      }
+    }
+  }
+  return improved;
+}
+
+/**
+ * @brief Make one pass of Or-opt moves, moving each short stretch of the order that saves time
+ * @param [in/out] vector of unsigned int order - indices of the locations in visiting order
+ * @return bool indication of whether the order was improved
+ */
+bool RouteOptimizer::improveOrOpt(std::vector<unsigned int> &order) const {
+  const unsigned int n = order.size();
+  bool improved = false;
+  std::vector<unsigned int> stretch;
+
+  for (unsigned int length = 1; length <= maxOrOptLength; length++) {
+    for (unsigned int i = 1; i + length <= n; i++) {
+      const unsigned int before = order[i - 1];
+      const unsigned int first = order[i];
+      const unsigned int last = order[i + length - 1];
+      const bool hasAfter = (i + length < n);
+
+      // Time saved by taking the stretch out and joining its neighbors
+      double removedSeconds = moveSeconds(before, first);
+      if (hasAfter)
+        removedSeconds += moveSeconds(last, order[i + length])
+            - moveSeconds(before, order[i + length]);
+
+      // Time added by putting it back after position p, either way round
+      bool found = false;
+      unsigned int bestPosition = 0;
+      bool bestReversed = false;
+      double bestDeltaSeconds = -improvementSeconds;
+      for (unsigned int p = 0; p < n; p++) {
+        if (p + 1 >= i && p < i + length)
+          continue;
+        const bool hasNext = (p + 1 < n);
+        double forwardSeconds = moveSeconds(order[p], first);
+        double reversedSeconds = moveSeconds(order[p], last);
+        if (hasNext) {
+          const double joinedSeconds = moveSeconds(order[p], order[p + 1]);
+          forwardSeconds += moveSeconds(last, order[p + 1]) - joinedSeconds;
+          reversedSeconds += moveSeconds(first, order[p + 1]) - joinedSeconds;
+        }
+        if (forwardSeconds - removedSeconds < bestDeltaSeconds) {
+          bestDeltaSeconds = forwardSeconds - removedSeconds;
+          bestPosition = p;
+          bestReversed = false;
+          found = true;
+        }
+        if (length > 1 && reversedSeconds - removedSeconds < bestDeltaSeconds) {
+          bestDeltaSeconds = reversedSeconds - removedSeconds;
+          bestPosition = p;
+          bestReversed = true;
+          found = true;
+        }
+      }
+      if (!found)
+        continue;
+
+      // Move the stretch (positions after it shift back by its length)
+      stretch.assign(order.begin() + i, order.begin() + i + length);
+      if (bestReversed)
+        std::reverse(stretch.begin(), stretch.end());
+      order.erase(order.begin() + i, order.begin() + i + length);
+      const unsigned int insertAt = (bestPosition < i) ?
+          bestPosition + 1 : bestPosition + 1 - length;
+      order.insert(order.begin() + insertAt, stretch.begin(), stretch.end());
+      improved = true;
+    }
+  }
+  return improved;
+}
+
+/**
+ * @brief Improve an order, then perturb and improve it repeatedly until time (or the
+ * perturbation cap) runs out
+ * @param [in] unsigned int seed for this worker's perturbations
+ * @param [in] Deadline deadline after which the search stops
+ * @param [in/out] vector of unsigned int order - starting order, replaced by the fastest found
+ * @param [out] unsigned int perturbations - number of perturbations made
+ */
+void RouteOptimizer::search(const unsigned int seed, const Deadline &deadline,
+                            std::vector<unsigned int> &order,
+                            unsigned int &perturbations) const {
+  perturbations = 0;
+  improve(order, deadline);
+  const unsigned int n = order.size();
+  if (n < 4)
+    return;
+
+  // A double bridge cuts the order (after its start) at three random
+  // positions and swaps the two middle stretches
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<unsigned int> cutDistribution(1, n - 1);
+  double orderTime = orderSeconds(order);
+  std::vector<unsigned int> candidate;
+  while (std::chrono::steady_clock::now() < deadline
+      && (maxPerturbations == 0 || perturbations < maxPerturbations)) {
+    perturbations++;
+    unsigned int cuts[3];
+    do {
+      for (auto &cut : cuts)
+        cut = cutDistribution(generator);
+      std::sort(cuts, cuts + 3);
+    } while (cuts[0] == cuts[1] || cuts[1] == cuts[2]);
+    candidate.assign(order.begin(), order.begin() + cuts[0]);
+    candidate.insert(candidate.end(), order.begin() + cuts[1],
+                     order.begin() + cuts[2]);
+    candidate.insert(candidate.end(), order.begin() + cuts[0],
+                     order.begin() + cuts[1]);
+    candidate.insert(candidate.end(), order.begin() + cuts[2], order.end());
+
+    improve(candidate, deadline);
+    const double candidateTime = orderSeconds(candidate);
+    if (candidateTime < orderTime - improvementSeconds) {
+      order.swap(candidate);
+      orderTime = candidateTime;
+    }
+  }
+  return;
+}
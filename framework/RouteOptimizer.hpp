@@ -0,0 +1,86 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file RouteOptimizer.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Added a cap on the perturbations each worker makes
+ *
+ * @brief Orders the locations of a route for the shortest time to visit them all
+ *
+ * The route optimizer finds a fast order in which to visit a set of locations on the field,
+ * starting from the first of them (the chassis's starting location) and ending wherever the
+ * last visit happens to be.  The cost of each move between two locations is the time to
+ * travel straight between them from rest to rest, accelerating and decelerating at the
+ * chassis's maximum acceleration and cruising at no more than its maximum velocity (a
+ * trapezoidal velocity profile, or a triangular one if the move is too short to reach the
+ * maximum velocity).  Because short moves are dominated by accelerating and stopping, this
+ * ranks orders differently than their distance alone would.
+ *
+ * Finding the fastest order exactly takes time exponential in the number of locations, so the
+ * optimizer searches within a time budget instead.  It starts from the nearest neighbor order
+ * (always moving to the quickest unvisited location next), then improves it with 2-opt moves
+ * (reversing a stretch of the order) and Or-opt moves (moving a stretch of one to three
+ * locations elsewhere in the order, either way round) until no such move helps.  Each worker
+ * thread then repeatedly perturbs its best order (a double bridge: cutting it into four
+ * stretches and swapping the middle two, which 2-opt and Or-opt cannot undo in one move) and
+ * improves it again, keeping the result if it is faster, until the budget is spent (or, if a
+ * cap is set, until it has made that many perturbations, so a single worker's result does not
+ * depend on the speed of the machine).  The fastest order found by any worker is returned.
+ *
+ */
+#ifndef ROUTEOPTIMIZER_HPP_
+#define ROUTEOPTIMIZER_HPP_
+
+#include <chrono>
+#include <vector>
+#include "ChassisAcceleration.hpp"
+#include "ChassisVelocity.hpp"
+#include "PoseWayPoint.hpp"
+
+/** @brief Orders route locations for the shortest estimated travel time, within a time budget
+ */
+
+class RouteOptimizer {
+ public:
+  RouteOptimizer();
+  virtual ~RouteOptimizer();
+  void setMotionLimits(const ChassisVelocity &maxVelocity,
+                       const ChassisAcceleration &maxAcceleration);
+  void setTimeBudgetMS(const unsigned int budgetMS);
+  unsigned int getTimeBudgetMS() const;
+  void setThreadCount(const unsigned int count);
+  void setMaxPerturbations(const unsigned int count);
+  unsigned int getMaxPerturbations() const;
+  double estimateMoveSeconds(const double distanceFeet) const;
+  bool optimize(const std::vector<PoseWayPoint> &locations,
+                std::vector<unsigned int> &order);
+  double getNearestNeighborSeconds() const;
+  double getOrderSeconds() const;
+  unsigned int getPerturbationCount() const;
+
+ private:
+  typedef std::chrono::steady_clock::time_point Deadline;
+  double orderSeconds(const std::vector<unsigned int> &order) const;
+  double moveSeconds(const unsigned int from, const unsigned int to) const;
+  void nearestNeighborOrder(std::vector<unsigned int> &order) const;
+  void improve(std::vector<unsigned int> &order,
+               const Deadline &deadline) const;
+  bool improveTwoOpt(std::vector<unsigned int> &order) const;
+  bool improveOrOpt(std::vector<unsigned int> &order) const;
+  void search(const unsigned int seed, const Deadline &deadline,
+              std::vector<unsigned int> &order,
+              unsigned int &perturbations) const;
+  double maxVelocityFPS;                 // cruising velocity limit
+  double maxAccelerationFPSS;            // acceleration and deceleration limit
+  unsigned int timeBudgetMS;             // search time allowed per optimize
+  unsigned int threadCount;              // 0 for one per hardware thread
+  unsigned int maxPerturbations;         // per worker, 0 for no limit
+  unsigned int locationCount;            // locations being ordered
+  std::vector<double> moveSecondsTable;  // from * locationCount + to
+  double nearestNeighborSeconds;         // time of the starting order
+  double bestSeconds;                    // time of the order returned
+  unsigned int perturbationCount;        // made by all workers in optimize
+};
+
+#endif /* ROUTEOPTIMIZER_HPP_ */
@@ -0,0 +1,79 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file SimulatedMotor.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief A SimulatedMotor is a kind of MotorOutput that follows commanded motion ideally
+ *
+ * The simulated motor lets trajectories be executed on any computer, without motor
+ * hardware.  Each trajectory point it receives is treated as a command to ramp to the
+ * point's velocity over the point's duration; the simulated motor position advances
+ * accordingly, and the last commanded position and velocity are kept so that the
+ * execution can be checked against the trajectory.
+ *
+ */
+#include "SimulatedMotor.hpp"
+
+SimulatedMotor::SimulatedMotor()
+    : commandedPosition(),
+      commandedVelocity(),
+      simulatedPosition(),
+      pointCount(0) {
+}
+
+SimulatedMotor::~SimulatedMotor() {
+}
+
+/**
+ * @brief Ramp the simulated motor to the trajectory point's velocity over the point's duration
+ * @param [in] TrajectoryPoint trajectoryPoint released for execution
+ */
+void SimulatedMotor::outputTrajectoryPoint(
+    const TrajectoryPoint &trajectoryPoint) {
+  // Ramp from the previous commanded velocity to the new one over the
+  // point's duration, advancing by the average velocity times the duration
+  double lastVelocityRPM = commandedVelocity.getRotationsPerMinute();
+  commandedPosition = trajectoryPoint.getPosition();
+  commandedVelocity = trajectoryPoint.getVelocity();
+  simulatedPosition.setRotations(
+      simulatedPosition.getRotations()
+          + (lastVelocityRPM + commandedVelocity.getRotationsPerMinute()) / 2
+              / 60 * trajectoryPoint.getDurationMS() / 1000.0);
+  pointCount++;
+  return;
+}
+
+/**
+ * @brief Get the position of the last trajectory point received
+ * @return MotorPosition commanded position
+ */
+MotorPosition SimulatedMotor::getCommandedPosition() const {
+  return commandedPosition;
+}
+
+/**
+ * @brief Get the velocity of the last trajectory point received
+ * @return MotorVelocity commanded velocity
+ */
+MotorVelocity SimulatedMotor::getCommandedVelocity() const {
+  return commandedVelocity;
+}
+
+/**
+ * @brief Get the position the simulated motor has reached by running the points received
+ * @return MotorPosition simulated position
+ */
+MotorPosition SimulatedMotor::getSimulatedPosition() const {
+  return simulatedPosition;
+}
+
+/**
+ * @brief Get the number of trajectory points received
+ * @return unsigned int count of trajectory points received
+ */
+unsigned int SimulatedMotor::getPointCount() const {
+  return pointCount;
+}
@@ -0,0 +1,46 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file SimulatedMotor.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief A SimulatedMotor is a kind of MotorOutput that follows commanded motion ideally
+ *
+ * The simulated motor lets trajectories be executed on any computer, without motor
+ * hardware.  Each trajectory point it receives is treated as a command to ramp to the
+ * point's velocity over the point's duration; the simulated motor position advances
+ * accordingly, and the last commanded position and velocity are kept so that the
+ * execution can be checked against the trajectory.
+ *
+ */
+#ifndef SIMULATEDMOTOR_HPP_
+#define SIMULATEDMOTOR_HPP_
+
+#include "MotorOutput.hpp"
+#include "MotorPosition.hpp"
+#include "MotorVelocity.hpp"
+#include "TrajectoryPoint.hpp"
+
+/** @brief SimulatedMotor is derived from the base class MotorOutput
+ */
+
+class SimulatedMotor : public MotorOutput {
+ public:
+  SimulatedMotor();
+  virtual ~SimulatedMotor();
+  void outputTrajectoryPoint(const TrajectoryPoint &trajectoryPoint);
+  MotorPosition getCommandedPosition() const;
+  MotorVelocity getCommandedVelocity() const;
+  MotorPosition getSimulatedPosition() const;
+  unsigned int getPointCount() const;
+
+ private:
+  MotorPosition commandedPosition;  // position of the last point received
+  MotorVelocity commandedVelocity;  // velocity of the last point received
+  MotorPosition simulatedPosition;  // position reached by running the points
+  unsigned int pointCount;          // number of points received
+};
+
+#endif /* SIMULATEDMOTOR_HPP_ */
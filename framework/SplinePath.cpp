@@ -0,0 +1,267 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file SplinePath.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A smooth two dimensional path through pose way points, sampled by distance
+ *
+ * A spline path joins each pair of consecutive pose way points with a quintic Hermite spline
+ * segment: the segment starts and ends at the way points' positions, leaves and arrives along
+ * their headings (with a speed along the segment's parameter equal to the distance between
+ * them), and has no acceleration at either end, so consecutive segments join with matching
+ * heading and curvature.
+ *
+ * A spline's parameter does not advance evenly with distance along it, so when the path is
+ * generated, the length of each segment is integrated once (Gauss-Legendre quadrature over
+ * short steps of the parameter), and a table of the parameter at evenly spaced distances along
+ * the whole path is built from it.  Sampling the path at a distance then reads the two nearest
+ * table entries and interpolates between them, in constant time, instead of integrating the
+ * length again on every query.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include "SplinePath.hpp"
+
+namespace {
+const double pi = std::acos(-1.0);
+// Five point Gauss-Legendre quadrature on [0, 1]: nodes and weights
+const double gaussNode[5] = { 0.5 - 0.4530899229693320, 0.5
+    - 0.2692346550528416, 0.5, 0.5 + 0.2692346550528416, 0.5
+    + 0.4530899229693320 };
+const double gaussWeight[5] = { 0.1184634425280945, 0.2393143352496832,
+    0.2844444444444444, 0.2393143352496832, 0.1184634425280945 };
+// Parameter steps integrated per table step (at least), for an accurate
+// length between table entries
+const double integrationStepsPerTableStep = 2.0;
+}  // namespace
+
+SplinePath::SplinePath()
+    : segments(),
+      tableParameter(),
+      tableStepFeet(0.0),
+      lengthFeet(0.0) {
+}
+
+SplinePath::~SplinePath() {
+}
+
+/**
+ * @brief Generate the spline through a series of pose way points, and its arc length table
+ * @param [in] vector of PoseWayPoint wayPoints to pass through, in order (at least two, with
+ * no two consecutive way points at the same position)
+ * @param [in] double stepFeet - distance between arc length table entries
+ * @return bool indication of whether the spline was generated
+ */
+bool SplinePath::generate(const std::vector<PoseWayPoint> &wayPoints,
+                          const double stepFeet) {
+  segments.clear();
+  tableParameter.clear();
+  tableStepFeet = stepFeet;
+  lengthFeet = 0.0;
+  if (wayPoints.size() < 2 || stepFeet <= 0)
+    return false;
+
+  // Each segment's coefficients from the quintic Hermite basis, with the
+  // ends' velocities along their headings and no acceleration at either end
+  segments.reserve(wayPoints.size() - 1);
+  for (std::vector<PoseWayPoint>::size_type i = 1; i < wayPoints.size();
+      i++) {
+    const PoseWayPoint &from = wayPoints[i - 1];
+    const PoseWayPoint &to = wayPoints[i];
+    const double chordFeet = std::hypot(to.getXFeet() - from.getXFeet(),
+                                        to.getYFeet() - from.getYFeet());
+    if (chordFeet == 0) {
+      segments.clear();
+      return false;
+    }
+    const double p0[2] = { from.getXFeet(), from.getYFeet() };
+    const double p1[2] = { to.getXFeet(), to.getYFeet() };
+    const double v0[2] = {
+        chordFeet * std::cos(from.getHeadingDegrees() * pi / 180),
+        chordFeet * std::sin(from.getHeadingDegrees() * pi / 180) };
+    const double v1[2] = {
+        chordFeet * std::cos(to.getHeadingDegrees() * pi / 180),
+        chordFeet * std::sin(to.getHeadingDegrees() * pi / 180) };
+    Segment segment;
+    double *coefficients[2] = { segment.x, segment.y };
+    for (unsigned int axis = 0; axis < 2; axis++) {
+      double *c = coefficients[axis];
+      c[0] = p0[axis];
+      c[1] = v0[axis];
+      c[2] = 0.0;
+      c[3] = -10 * p0[axis] - 6 * v0[axis] - 4 * v1[axis] + 10 * p1[axis];
+      c[4] = 15 * p0[axis] + 8 * v0[axis] + 7 * v1[axis] - 15 * p1[axis];
+      c[5] = -6 * p0[axis] - 3 * v0[axis] - 3 * v1[axis] + 6 * p1[axis];
+    }
+    segments.push_back(segment);
+  }
+
+  // Integrate the length over short parameter steps, recording the
+  // distance reached at each step's end
+  std::vector<double> stepParameter(1, 0.0), stepDistance(1, 0.0);
+  for (std::vector<Segment>::size_type s = 0; s < segments.size(); s++) {
+    const double chordFeet = std::hypot(
+        wayPoints[s + 1].getXFeet() - wayPoints[s].getXFeet(),
+        wayPoints[s + 1].getYFeet() - wayPoints[s].getYFeet());
+    const unsigned int steps = std::max(
+        8.0, std::ceil(chordFeet / tableStepFeet
+            * integrationStepsPerTableStep));
+    for (unsigned int step = 0; step < steps; step++) {
+      double stepLength = 0.0;
+      for (unsigned int node = 0; node < 5; node++)
+        stepLength += gaussWeight[node]
+            * speedAt(segments[s], (step + gaussNode[node]) / steps);
+      lengthFeet += stepLength / steps;
+      stepParameter.push_back(s + static_cast<double>(step + 1) / steps);
+      stepDistance.push_back(lengthFeet);
+    }
+  }
+
+  // The parameter at each multiple of the table step, interpolated between
+  // the integration steps (the last entry is at or past the end, and is
+  // extrapolated from the last step, so the end interpolates exactly)
+  const unsigned int tableSize =
+      static_cast<unsigned int>(std::ceil(lengthFeet / tableStepFeet)) + 1;
+  tableParameter.reserve(std::max(tableSize, 2u));
+  std::vector<double>::size_type j = 0;
+  for (unsigned int k = 0; k < std::max(tableSize, 2u); k++) {
+    const double distanceFeet = k * tableStepFeet;
+    while (j + 2 < stepDistance.size() && stepDistance[j + 1] < distanceFeet)
+      j++;
+    const double span = stepDistance[j + 1] - stepDistance[j];
+    const double fraction = (span > 0) ?
+        (distanceFeet - stepDistance[j]) / span : 1.0;
+    tableParameter.push_back(stepParameter[j]
+        + fraction * (stepParameter[j + 1] - stepParameter[j]));
+  }
+  return true;
+}
+
+/**
+ * @brief Get the number of spline segments (one less than the number of way points)
+ * @return unsigned int count of segments (0 if the path has not been generated)
+ */
+unsigned int SplinePath::getSegmentCount() const {
+  return segments.size();
+}
+
+/**
+ * @brief Get the length of the path
+ * @return double length in feet
+ */
+double SplinePath::getLengthFeet() const {
+  return lengthFeet;
+}
+
+/**
+ * @brief Get the distance between arc length table entries
+ * @return double table step in feet
+ */
+double SplinePath::getTableStepFeet() const {
+  return tableStepFeet;
+}
+
+/**
+ * @brief Sample the path's pose and curvature at a distance along it, in constant time
+ * @param [in] double distanceFeet along the path (from 0 to the path's length)
+ * @param [out] double xFeet - forward position at that distance
+ * @param [out] double yFeet - rightward position at that distance
+ * @param [out] double headingDegrees of the path at that distance
+ * @param [out] double curvaturePerFoot of the path at that distance (positive turning right)
+ * @return bool indication of whether the distance is on the path
+ */
+bool SplinePath::sample(const double distanceFeet, double &xFeet,
+                        double &yFeet, double &headingDegrees,
+                        double &curvaturePerFoot) const {
+  if (segments.empty() || distanceFeet < 0 || distanceFeet > lengthFeet)
+    return false;
+
+  // Interpolate the parameter between the two nearest table entries
+  const double tablePosition = distanceFeet / tableStepFeet;
+  const unsigned int entry = std::min<unsigned int>(tablePosition,
+                                                    tableParameter.size() - 2);
+  const double parameter = std::min<double>(
+      tableParameter[entry] + (tablePosition - entry)
+          * (tableParameter[entry + 1] - tableParameter[entry]),
+      segments.size());
+  const unsigned int s = std::min<unsigned int>(parameter,
+                                                segments.size() - 1);
+  const double u = parameter - s;
+
+  // Position and its first two derivatives along the segment
+  const Segment &segment = segments[s];
+  double position[2], velocity[2], acceleration[2];
+  const double *coefficients[2] = { segment.x, segment.y };
+  for (unsigned int axis = 0; axis < 2; axis++) {
+    const double *c = coefficients[axis];
+    position[axis] = c[0]
+        + u * (c[1] + u * (c[2] + u * (c[3] + u * (c[4] + u * c[5]))));
+    velocity[axis] = c[1]
+        + u * (2 * c[2] + u * (3 * c[3] + u * (4 * c[4] + u * 5 * c[5])));
+    acceleration[axis] = 2 * c[2]
+        + u * (6 * c[3] + u * (12 * c[4] + u * 20 * c[5]));
+  }
+  xFeet = position[0];
+  yFeet = position[1];
+  headingDegrees = std::atan2(velocity[1], velocity[0]) * 180 / pi;
+  const double speed = std::hypot(velocity[0], velocity[1]);
+  curvaturePerFoot = (speed > 0) ?
+      (velocity[0] * acceleration[1] - velocity[1] * acceleration[0])
+          / (speed * speed * speed) : 0.0;
+  return true;
+}
+
+/**
+ * @brief Plan a motion path of points evenly spaced along this spline path
+ * @param [in] double spacingFeet between path points (the last point is at the path's end)
+ * @param [in] double motorRotPerMovementFoot for converting distance to motor position
+ * @param [in] MotorVelocity maxVelocity allowed at each path point
+ * @param [in] MotorAcceleration maxAcceleration allowed at each path point
+ * @param [out] Path path with a point at each distance along the spline path
+ * @param [out] vector of double curvaturePerFoot of the spline path at each path point
+ * @return bool indication of whether the path was planned
+ */
+bool SplinePath::planPath(const double spacingFeet,
+                          const double motorRotPerMovementFoot,
+                          const MotorVelocity &maxVelocity,
+                          const MotorAcceleration &maxAcceleration,
+                          Path &path,
+                          std::vector<double> &curvaturePerFoot) const {
+  path = Path();
+  curvaturePerFoot.clear();
+  if (segments.empty() || spacingFeet <= 0)
+    return false;
+
+  const unsigned int pointCount =
+      static_cast<unsigned int>(std::ceil(lengthFeet / spacingFeet)) + 1;
+  path.reserve(pointCount);
+  curvaturePerFoot.reserve(pointCount);
+  double xFeet, yFeet, headingDegrees, curvature;
+  for (unsigned int i = 0; i < pointCount; i++) {
+    const double distanceFeet = std::min(i * spacingFeet, lengthFeet);
+    sample(distanceFeet, xFeet, yFeet, headingDegrees, curvature);
+    path.emplacePathPoint(
+        MotorPosition::fromDistanceFeetByRotPerMovementFoot(
+            distanceFeet, motorRotPerMovementFoot),
+        maxVelocity, maxAcceleration);
+    curvaturePerFoot.push_back(curvature);
+  }
+  return true;
+}
+
+/**
+ * @brief Speed along a segment with respect to its parameter
+ * @param [in] Segment segment to evaluate
+ * @param [in] double u - parameter along the segment, from 0 to 1
+ * @return double feet per unit of the parameter
+ */
+double SplinePath::speedAt(const Segment &segment, const double u) {
+  const double dx = segment.x[1] + u * (2 * segment.x[2] + u * (3 * segment.x[3]
+      + u * (4 * segment.x[4] + u * 5 * segment.x[5])));
+  const double dy = segment.y[1] + u * (2 * segment.y[2] + u * (3 * segment.y[3]
+      + u * (4 * segment.y[4] + u * 5 * segment.y[5])));
+  return std::hypot(dx, dy);
+}
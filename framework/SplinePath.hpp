@@ -0,0 +1,66 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file SplinePath.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief A smooth two dimensional path through pose way points, sampled by distance
+ *
+ * A spline path joins each pair of consecutive pose way points with a quintic Hermite spline
+ * segment: the segment starts and ends at the way points' positions, leaves and arrives along
+ * their headings (with a speed along the segment's parameter equal to the distance between
+ * them), and has no acceleration at either end, so consecutive segments join with matching
+ * heading and curvature.
+ *
+ * A spline's parameter does not advance evenly with distance along it, so when the path is
+ * generated, the length of each segment is integrated once (Gauss-Legendre quadrature over
+ * short steps of the parameter), and a table of the parameter at evenly spaced distances along
+ * the whole path is built from it.  Sampling the path at a distance then reads the two nearest
+ * table entries and interpolates between them, in constant time, instead of integrating the
+ * length again on every query.
+ *
+ */
+#ifndef SPLINEPATH_HPP_
+#define SPLINEPATH_HPP_
+
+#include <vector>
+#include "MotorAcceleration.hpp"
+#include "MotorVelocity.hpp"
+#include "Path.hpp"
+#include "PoseWayPoint.hpp"
+
+/** @brief Quintic Hermite spline path through pose way points, with an arc length table
+ */
+
+class SplinePath {
+ public:
+  SplinePath();
+  virtual ~SplinePath();
+  bool generate(const std::vector<PoseWayPoint> &wayPoints,
+                const double stepFeet);
+  unsigned int getSegmentCount() const;
+  double getLengthFeet() const;
+  double getTableStepFeet() const;
+  bool sample(const double distanceFeet, double &xFeet, double &yFeet,
+              double &headingDegrees, double &curvaturePerFoot) const;
+  bool planPath(const double spacingFeet, const double motorRotPerMovementFoot,
+                const MotorVelocity &maxVelocity,
+                const MotorAcceleration &maxAcceleration, Path &path,
+                std::vector<double> &curvaturePerFoot) const;
+
+ private:
+  // The polynomial coefficients of a segment, x(u) = x[0] + x[1] u + ...
+  // + x[5] u^5 (and likewise y) for u from 0 to 1
+  struct Segment {
+    double x[6];
+    double y[6];
+  };
+  static double speedAt(const Segment &segment, const double u);
+  std::vector<Segment> segments;
+  std::vector<double> tableParameter;  // parameter at each table distance
+  double tableStepFeet;                // distance between table entries
+  double lengthFeet;                   // length of the whole path
+};
+
+#endif /* SPLINEPATH_HPP_ */
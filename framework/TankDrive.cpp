@@ -4,6 +4,15 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 13, 2017 - Creation
+ * @date Oct 19, 2026 - Generate the governing side once, derive the other side
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Path points constructed in place
+ * @date Oct 19, 2026 - Added trajectories for following a curved spline path
+ * @date Oct 19, 2026 - Added move time estimates without generating trajectories
+ * @date Oct 19, 2026 - Instrumented moves per chassis
+ * @date Oct 19, 2026 - Governing path points planned in place; callers may own move trajectories;
+ * CSV file names kept from when the chassis name is set
+ * @date Oct 19, 2026 - Spline path trajectories need a velocity and acceleration to move at
  *
  * @brief TankDrive is a kind of DriveSystem with two wheeled or tracked motivators, one per side
  *
@@ -17,6 +26,12 @@
  *
  */
 #include "TankDrive.hpp"
+#include "Instrumentation.hpp"
+
+namespace {
+// Spacing of the points at which a spline path's velocity is planned
+const double pathSamplingFeet = 0.01;
+}  // namespace
 
 TankDrive::TankDrive()
     : widthInFeet(0.0) {
@@ -38,7 +53,7 @@ void TankDrive::setWidthInFeet(double width) {
  * @brief Get the distance between the two TankDrive motivators (left and right sides)
  * @return double width as the distance between the two TankDrive motivators (left and right sides)
  */
-double TankDrive::getWidthInFeet() {
+double TankDrive::getWidthInFeet() const {
   return widthInFeet;
 }
 
@@ -52,6 +67,140 @@ double TankDrive::getWidthInFeet() {
 void TankDrive::move(double distanceFeet, ChassisTurnRate chassisTurnRate,
                      ChassisVelocity chassisVelocityRequested,
                      ChassisAcceleration chassisAccelerationRequested) {
+  // Create the left and right motion profile trajectories, and move with them
+  Trajectory leftTrajectory, rightTrajectory;
+  move(distanceFeet, chassisTurnRate, chassisVelocityRequested,
+       chassisAccelerationRequested, leftTrajectory, rightTrajectory);
+  return;
+}
+
+/**
+ * @brief Move the TankDrive according to the movement parameters, generating its trajectories
+ * into the caller's trajectories (so repeated moves can re-use their storage)
+ * @param [in] double distanceFeet - distance to move in feet
+ * @param [in] ChassisTurnRate chassisTurnRate - go straight or change heading as moving
+ * @param [in] ChassisVelocity chassisVelocityRequested - move at this rate
+ * @param [in] ChassisAcceleration chassisAccelerationRequested - accelerate at this rate
+ * @param [out] Trajectory leftTrajectory for the left side motivator
+ * @param [out] Trajectory rightTrajectory for the right side motivator
+ */
+void TankDrive::move(double distanceFeet, ChassisTurnRate chassisTurnRate,
+                     ChassisVelocity chassisVelocityRequested,
+                     ChassisAcceleration chassisAccelerationRequested,
+                     Trajectory &leftTrajectory,
+                     Trajectory &rightTrajectory) const {
+  MCSF_MOVE_SCOPE(chassisName);
+
+  // Generate the left and right motion profile trajectories for this
+  // movement
+  generateTrajectories(distanceFeet, chassisTurnRate, chassisVelocityRequested,
+                       chassisAccelerationRequested, leftTrajectory,
+                       rightTrajectory);
+
+  /* With motor outputs for a real drive system, a TrajectoryExecutor with
+   *    executor.addTrajectory(leftTrajectory, leftMotorOutput);
+   *    executor.addTrajectory(rightTrajectory, rightMotorOutput);
+   *    executor.execute();
+   * would simultaneously run the left and right trajectories,
+   * and the drive system would move.
+   */
+
+  // For demonstration purposes, output CSV files for the two trajectories
+  // (named for the chassis when its name was set)
+  leftTrajectory.outputCSV(leftTrajectoryFileName);
+  rightTrajectory.outputCSV(rightTrajectoryFileName);
+
+  return;
+}
+
+/**
+ * @brief Generate the left and right trajectories for a TankDrive movement
+ *
+ * Only the governing side (the outer side of a turn, or the left side of a
+ * straight move) is run through the trajectory generation algorithm; the
+ * other side has the same timing with its motion scaled down, so it is
+ * derived from the governing side's trajectory in a single scaling pass.
+ *
+ * @param [in] double distanceFeet - distance to move in feet
+ * @param [in] ChassisTurnRate chassisTurnRate - go straight or change heading as moving
+ * @param [in] ChassisVelocity chassisVelocityRequested - move at this rate
+ * @param [in] ChassisAcceleration chassisAccelerationRequested - accelerate at this rate
+ * @param [out] Trajectory leftTrajectory for the left side motivator
+ * @param [out] Trajectory rightTrajectory for the right side motivator
+ */
+void TankDrive::generateTrajectories(
+    double distanceFeet, ChassisTurnRate chassisTurnRate,
+    ChassisVelocity chassisVelocityRequested,
+    ChassisAcceleration chassisAccelerationRequested,
+    Trajectory &leftTrajectory, Trajectory &rightTrajectory) const {
+  MCSF_MOVE_SCOPE(chassisName);
+  PathPoint beginPathPoint, endPathPoint;
+  double derivedPathMotionScaleFactor;
+  bool leftPathGoverns;
+  planGoverningPath(distanceFeet, chassisTurnRate, chassisVelocityRequested,
+                    chassisAccelerationRequested, beginPathPoint, endPathPoint,
+                    derivedPathMotionScaleFactor, leftPathGoverns);
+
+  // Generate the governing side's trajectory between the governing path's
+  // points, then derive the other side's trajectory by scaling the governing
+  // side's motion
+  Trajectory &governingTrajectory =
+      leftPathGoverns ? leftTrajectory : rightTrajectory;
+  Trajectory &derivedTrajectory =
+      leftPathGoverns ? rightTrajectory : leftTrajectory;
+  governingTrajectory.generate(beginPathPoint, endPathPoint,
+                               trajectoryIterationPeriodMS);
+  derivedTrajectory.generateScaled(governingTrajectory,
+                                   derivedPathMotionScaleFactor);
+
+  return;
+}
+
+/**
+ * @brief Estimate the time a TankDrive movement takes, without generating its trajectories
+ * @param [in] double distanceFeet - distance to move in feet
+ * @param [in] ChassisTurnRate chassisTurnRate - go straight or change heading as moving
+ * @param [in] ChassisVelocity chassisVelocityRequested - move at this rate
+ * @param [in] ChassisAcceleration chassisAccelerationRequested - accelerate at this rate
+ * @param [out] unsigned int pointCount - number of points in each side's trajectory
+ * @param [out] double durationS - time from the first trajectory point to the last, in seconds
+ * @return bool indication of whether the movement's trajectories can be generated
+ */
+bool TankDrive::estimateMoveTime(
+    double distanceFeet, ChassisTurnRate chassisTurnRate,
+    ChassisVelocity chassisVelocityRequested,
+    ChassisAcceleration chassisAccelerationRequested, unsigned int &pointCount,
+    double &durationS) const {
+  // Both sides share the governing side's timing
+  PathPoint beginPathPoint, endPathPoint;
+  double derivedPathMotionScaleFactor;
+  bool leftPathGoverns;
+  planGoverningPath(distanceFeet, chassisTurnRate, chassisVelocityRequested,
+                    chassisAccelerationRequested, beginPathPoint, endPathPoint,
+                    derivedPathMotionScaleFactor, leftPathGoverns);
+  return Trajectory::estimateDuration(beginPathPoint, endPathPoint,
+                                      trajectoryIterationPeriodMS, pointCount,
+                                      durationS);
+}
+
+/**
+ * @brief Plan the governing side's two path points for a TankDrive movement
+ * @param [in] double distanceFeet - distance to move in feet
+ * @param [in] ChassisTurnRate chassisTurnRate - go straight or change heading as moving
+ * @param [in] ChassisVelocity chassisVelocityRequested - move at this rate
+ * @param [in] ChassisAcceleration chassisAccelerationRequested - accelerate at this rate
+ * @param [out] PathPoint beginPathPoint - start of the governing side's path
+ * @param [out] PathPoint endPathPoint - end of the governing side's path
+ * @param [out] double derivedPathMotionScaleFactor - scale from the governing side's motion to
+ * the other side's
+ * @param [out] bool leftPathGoverns - whether the left side is the governing side
+ */
+void TankDrive::planGoverningPath(
+    double distanceFeet, ChassisTurnRate chassisTurnRate,
+    ChassisVelocity chassisVelocityRequested,
+    ChassisAcceleration chassisAccelerationRequested, PathPoint &beginPathPoint,
+    PathPoint &endPathPoint, double &derivedPathMotionScaleFactor,
+    bool &leftPathGoverns) const {
   // Calculate chassis max velocity from drive system's maximum motor velocity
   // and motor Rotationsper movement foot
   double chassisMaxVelocityFPS = maxVelocity.getRotationsPerMinute() / 60
@@ -62,31 +211,33 @@ void TankDrive::move(double distanceFeet, ChassisTurnRate chassisTurnRate,
   double chassisMaxAccelerationFPSS = maxAcceleration
       .getRotationsPerMinutePerSecond() / 60 * motorRotPerMovementFoot;
 
-  // Create the variables to contain the parameters for the paths used for
-  // trajectory generation
-  double leftPathDistanceFeet, rightPathDistanceFeet;
-  ChassisVelocity leftPathVelocity, rightPathVelocity;
-  ChassisAcceleration leftPathAcceleration, rightPathAcceleration;
+  // Create the variables to contain the parameters for the governing path
+  // used for trajectory generation
+  double governingPathDistanceFeet;
+  ChassisVelocity governingPathVelocity;
+  ChassisAcceleration governingPathAcceleration;
 
   // Is this movement straight?
   if (chassisTurnRate.getDegreesPerFoot() == 0) {
-    // Set left and right path distances in feet to the move distance in feet
-    leftPathDistanceFeet = distanceFeet;
-    rightPathDistanceFeet = distanceFeet;
+    // Set the path distance in feet to the move distance in feet
+    governingPathDistanceFeet = distanceFeet;
 
-    // Set left and right path velocities to the lesser of the requested
+    // Set the path velocity to the lesser of the requested
     // velocity and the maximum chassis velocity
-    leftPathVelocity.setFeetPerSecond(
+    governingPathVelocity.setFeetPerSecond(
         std::min(chassisVelocityRequested.getFeetPerSecond(),
                  chassisMaxVelocityFPS));
-    rightPathVelocity = leftPathVelocity;
 
-    // Set left and right path accelerations to the lesser of the requested
+    // Set the path acceleration to the lesser of the requested
     // acceleration and the maximum chassis acceleration
-    leftPathAcceleration.setFeetPerSecondPerSecond(
+    governingPathAcceleration.setFeetPerSecondPerSecond(
         std::min(chassisAccelerationRequested.getFeetPerSecondPerSecond(),
                  chassisMaxAccelerationFPSS));
-    rightPathAcceleration = leftPathAcceleration;
+
+    // Both sides move identically, so the left path governs and the right
+    // path is an unscaled copy of it
+    derivedPathMotionScaleFactor = 1.0;
+    leftPathGoverns = true;
   } else {
     // movement is circular(not straight) - the path variables will be
     // smaller on the inside of the turn, bigger on the outside
@@ -127,137 +278,213 @@ void TankDrive::move(double distanceFeet, ChassisTurnRate chassisTurnRate,
 
     // Scale up the center path velocity to get the outer path velocity, being
     // careful not to exceed the maximum chassis velocity
-    const double outerPathVelocityFPS = std::min(
-        (chassisVelocityRequested.getFeetPerSecond()
-            * centerToOuterPathMotionScaleFactor),
-        chassisMaxVelocityFPS);
+    governingPathVelocity.setFeetPerSecond(
+        std::min(
+            (chassisVelocityRequested.getFeetPerSecond()
+                * centerToOuterPathMotionScaleFactor),
+            chassisMaxVelocityFPS));
 
     // Scale up the center acceleration to get the outer path acceleration,
     // being careful not to exceed the maximum chassis acceleration
-    const double outerPathAccelerationFPSS = std::min(
-        (chassisAccelerationRequested.getFeetPerSecondPerSecond()
-            * centerToOuterPathMotionScaleFactor),
-        chassisMaxAccelerationFPSS);
-
-    // Calculate the outer to inner path motion scaling factor
-    const double outerToInnerPathMotionScaleFactor = innerPathDistanceFeet
+    governingPathAcceleration.setFeetPerSecondPerSecond(
+        std::min(
+            (chassisAccelerationRequested.getFeetPerSecondPerSecond()
+                * centerToOuterPathMotionScaleFactor),
+            chassisMaxAccelerationFPSS));
+
+    // The outer path governs the movement; the inner path distance,
+    // velocity, and acceleration are the outer path's scaled down by the
+    // outer to inner path motion scaling factor, so the inner path motion
+    // takes the same amount of time as the outer path motion
+    governingPathDistanceFeet = outerPathDistanceFeet;
+    derivedPathMotionScaleFactor = innerPathDistanceFeet
         / outerPathDistanceFeet;
 
-    // Scale down the outer path velocity to get the inner path velocity
-    const double innerPathVelocityFPS = outerPathVelocityFPS
-        * outerToInnerPathMotionScaleFactor;
-
-    // Scale down the outer path acceleration to get the inner path acceleration
-    const double innerPathAccelerationFPSS = outerPathAccelerationFPSS
-        * outerToInnerPathMotionScaleFactor;
-
-    // ****** Finally, set the left and right path motion variables from the
-    // ****** inner and outer path motion variables based on sign of turn rate
-    if (chassisTurnRate.getDegreesPerFoot() < 0) {
-      // negative turn rate is a deviation (turn) to the left
-      // so the left path is the inner path
-      leftPathDistanceFeet = innerPathDistanceFeet;
-      leftPathVelocity.setFeetPerSecond(innerPathVelocityFPS);
-      leftPathAcceleration.setFeetPerSecondPerSecond(innerPathAccelerationFPSS);
-      // and the right path is the outer path
-      rightPathDistanceFeet = outerPathDistanceFeet;
-      rightPathVelocity.setFeetPerSecond(outerPathVelocityFPS);
-      rightPathAcceleration.setFeetPerSecondPerSecond(
-          outerPathAccelerationFPSS);
-    } else {
-      // positive turn rate is deviation (turn) to the right
-      // so the right path is the inner path
-      rightPathDistanceFeet = innerPathDistanceFeet;
-      rightPathVelocity.setFeetPerSecond(innerPathVelocityFPS);
-      rightPathAcceleration.setFeetPerSecondPerSecond(
-          innerPathAccelerationFPSS);
-      // and the left path is the outer path
-      leftPathDistanceFeet = outerPathDistanceFeet;
-      leftPathVelocity.setFeetPerSecond(outerPathVelocityFPS);
-      leftPathAcceleration.setFeetPerSecondPerSecond(outerPathAccelerationFPSS);
-    }
+    // Negative turn rate is a deviation (turn) to the left, so the right path
+    // is the outer path; positive turn rate is a deviation (turn) to the
+    // right, so the left path is the outer path
+    leftPathGoverns = (chassisTurnRate.getDegreesPerFoot() > 0);
     // This is the end of "Straight?" or turning movement decision
   }
-  // Convert the chassis distances, velocities, and accelerations for each
-  // side's path to motor distances (positions), velocities, and
-  // accelerations to that we can build the motion paths for this movement
-
-  // Specify left path beginning and ending position, velocity, and acceleration
-  MotorPosition beginLeftPathMotorPosition, endLeftPathMotorPosition;
-  beginLeftPathMotorPosition.setRotations(0.0);
-  endLeftPathMotorPosition.setFromDistanceFeetByRotPerMovementFoot(
-      leftPathDistanceFeet, motorRotPerMovementFoot);
-  MotorVelocity beginLeftPathMotorVelocity, endLeftPathMotorVelocity;
-  beginLeftPathMotorVelocity.setFromChassisVelocityByRotPerMovementFoot(
-      leftPathVelocity, motorRotPerMovementFoot);
-  endLeftPathMotorVelocity.setRotationsPerMinute(0.0);
-  MotorAcceleration beginLeftPathMotorAcceleration,
-      endLeftPathMotorAcceleration;
-  beginLeftPathMotorAcceleration
-      .setFromChassisAccelerationByRotPerMovementFoot(
-      leftPathAcceleration, motorRotPerMovementFoot);
-
-  // Create the left path with the two points specified
-  Path leftPath;
-  PathPoint beginLeftPathPoint, endLeftPathPoint;
-  beginLeftPathPoint.setPosition(beginLeftPathMotorPosition);
-  beginLeftPathPoint.setMaxVelocity(beginLeftPathMotorVelocity);
-  beginLeftPathPoint.setMaxAcceleration(beginLeftPathMotorAcceleration);
-  leftPath.addPathPoint(beginLeftPathPoint);
-  endLeftPathPoint.setPosition(endLeftPathMotorPosition);
-  endLeftPathPoint.setMaxVelocity(endLeftPathMotorVelocity);
-  endLeftPathPoint.setMaxAcceleration(endLeftPathMotorAcceleration);
-  leftPath.addPathPoint(endLeftPathPoint);
-
-  // Specify right path beginning and ending position, velocity,
-  // and acceleration
-  MotorPosition beginRightPathMotorPosition, endRightPathMotorPosition;
-  beginRightPathMotorPosition.setRotations(0.0);
-  endRightPathMotorPosition.setFromDistanceFeetByRotPerMovementFoot(
-      rightPathDistanceFeet, motorRotPerMovementFoot);
-  MotorVelocity beginRightPathMotorVelocity, endRightPathMotorVelocity;
-  beginRightPathMotorVelocity.setFromChassisVelocityByRotPerMovementFoot(
-      rightPathVelocity, motorRotPerMovementFoot);
-  endRightPathMotorVelocity.setRotationsPerMinute(0.0);
-  MotorAcceleration beginRightPathMotorAcceleration,
-      endRightPathMotorAcceleration;
-  beginRightPathMotorAcceleration
-      .setFromChassisAccelerationByRotPerMovementFoot(
-      rightPathAcceleration, motorRotPerMovementFoot);
-
-  // Create the right path with the two points specified
-  Path rightPath;
-  PathPoint beginRightPathPoint, endRightPathPoint;
-  beginRightPathPoint.setPosition(beginRightPathMotorPosition);
-  beginRightPathPoint.setMaxVelocity(beginRightPathMotorVelocity);
-  beginRightPathPoint.setMaxAcceleration(beginRightPathMotorAcceleration);
-  rightPath.addPathPoint(beginRightPathPoint);
-  endRightPathPoint.setPosition(endRightPathMotorPosition);
-  endRightPathPoint.setMaxVelocity(endRightPathMotorVelocity);
-  endRightPathPoint.setMaxAcceleration(endRightPathMotorAcceleration);
-  rightPath.addPathPoint(endRightPathPoint);
-
-  // Create the left and right motion profile trajectories,
-  //  and generate them using the respective paths
-  Trajectory leftTrajectory;
-  leftTrajectory.generate(leftPath, trajectoryIterationPeriodMS);
-  Trajectory rightTrajectory;
-  rightTrajectory.generate(rightPath, trajectoryIterationPeriodMS);
-
-  /* When trajectory.execute has been implemented for a real drive system:
-   *    leftTrajectory.execute();
-   *    rightTrajectory.execute();
-   * would simultaneously run the left and right trajectories,
-   * and the drive system would move.
-   */
+  // Convert the chassis distance, velocity, and acceleration for the
+  // governing path to motor distances (positions), velocities, and
+  // accelerations to that we can build the motion path for this movement
+
+  // Specify path beginning and ending position, velocity, and acceleration
+  MotorPosition beginPathMotorPosition, endPathMotorPosition;
+  beginPathMotorPosition.setRotations(0.0);
+  endPathMotorPosition.setFromDistanceFeetByRotPerMovementFoot(
+      governingPathDistanceFeet, motorRotPerMovementFoot);
+  MotorVelocity beginPathMotorVelocity, endPathMotorVelocity;
+  beginPathMotorVelocity.setFromChassisVelocityByRotPerMovementFoot(
+      governingPathVelocity, motorRotPerMovementFoot);
+  endPathMotorVelocity.setRotationsPerMinute(0.0);
+  MotorAcceleration beginPathMotorAcceleration, endPathMotorAcceleration;
+  beginPathMotorAcceleration.setFromChassisAccelerationByRotPerMovementFoot(
+      governingPathAcceleration, motorRotPerMovementFoot);
+
+  // Set the governing path's two points in place
+  beginPathPoint.setPosition(beginPathMotorPosition);
+  beginPathPoint.setMaxVelocity(beginPathMotorVelocity);
+  beginPathPoint.setMaxAcceleration(beginPathMotorAcceleration);
+  endPathPoint.setPosition(endPathMotorPosition);
+  endPathPoint.setMaxVelocity(endPathMotorVelocity);
+  endPathPoint.setMaxAcceleration(endPathMotorAcceleration);
 
-  // For demonstration purposes, create meaningful CSV file names
-  std::string leftTrajectoryFileName = chassisName + "-left.CSV";
-  std::string rightTrajectoryFileName = chassisName + "-right.CSV";
+  return;
+}
 
-  // Output CSV files for the two trajectories
-  leftTrajectory.outputCSV(leftTrajectoryFileName);
-  rightTrajectory.outputCSV(rightTrajectoryFileName);
+/**
+ * @brief Generate the left and right trajectories for following a curved spline path
+ *
+ * The chassis center follows the spline path at the fastest velocity profile for which
+ * neither side exceeds the drive system's maximum motor velocity and acceleration (or the
+ * requested velocity and acceleration, scaled up on the outside of each curve): on a curve of
+ * curvature k, the outer side moves (1 + |k| * width / 2) times as fast as the center.  The
+ * profile is sampled once per trajectory iteration period, and each side's position is the
+ * center's distance plus or minus half the width times the heading change so far, and its
+ * velocity the center's velocity scaled by (1 +/- k * width / 2), computed for every sample
+ * in a single pass over contiguous arrays.
+ *
+ * @param [in] SplinePath splinePath for the chassis center to follow, from rest to rest
+ * @param [in] ChassisVelocity chassisVelocityRequested - move the center at no more than this rate
+ * @param [in] ChassisAcceleration chassisAccelerationRequested - accelerate at no more than this rate
+ * @param [out] Trajectory leftTrajectory for the left side motivator
+ * @param [out] Trajectory rightTrajectory for the right side motivator
+ * @return bool indication of whether the trajectories were generated (not for an empty path, or
+ * a zero velocity or acceleration, requested or maximum, which would never reach its end)
+ */
+bool TankDrive::generatePathTrajectories(
+    const SplinePath &splinePath, ChassisVelocity chassisVelocityRequested,
+    ChassisAcceleration chassisAccelerationRequested,
+    Trajectory &leftTrajectory, Trajectory &rightTrajectory) const {
+  MCSF_MOVE_SCOPE(chassisName);
+
+  // Sample the path densely at the requested velocity and acceleration
+  const MotorVelocity requestedVelocity =
+      MotorVelocity::fromChassisVelocityByRotPerMovementFoot(
+          chassisVelocityRequested, motorRotPerMovementFoot);
+  const MotorAcceleration requestedAcceleration =
+      MotorAcceleration::fromChassisAccelerationByRotPerMovementFoot(
+          chassisAccelerationRequested, motorRotPerMovementFoot);
+  Path centerPath;
+  std::vector<double> curvaturePerFoot;
+  if (trajectoryIterationPeriodMS == 0 || motorRotPerMovementFoot <= 0
+      || !splinePath.planPath(pathSamplingFeet, motorRotPerMovementFoot,
+                              requestedVelocity, requestedAcceleration,
+                              centerPath, curvaturePerFoot))
+    return false;
+
+  // Limit the center so the outer side stays within the motors' limits,
+  // then plan the center's velocity profile
+  const double halfWidthFeet = 0.5 * widthInFeet;
+  const double velocityLimitRPS = std::min(
+      requestedVelocity.getRotationsPerSecond(),
+      maxVelocity.getRotationsPerSecond());
+  const double accelerationLimitRPSpS = std::min(
+      requestedAcceleration.getRotationsPerSecondPerSecond(),
+      maxAcceleration.getRotationsPerSecondPerSecond());
+  if (velocityLimitRPS <= 0 || accelerationLimitRPSpS <= 0)
+    return false;
+  for (unsigned int i = 0; i < centerPath.size(); i++) {
+    const double outerScale = 1 + std::fabs(curvaturePerFoot[i])
+        * halfWidthFeet;
+    centerPath[i].setMaxVelocity(
+        MotorVelocity::fromRotationsPerSecond(velocityLimitRPS / outerScale));
+    centerPath[i].setMaxAcceleration(
+        MotorAcceleration::fromRotationsPerSecondPerSecond(
+            accelerationLimitRPSpS / outerScale));
+  }
+  VelocityPlanner velocityPlanner;
+  velocityPlanner.plan(centerPath, curvaturePerFoot, motorRotPerMovementFoot);
+
+  // The heading change (radians) at each path point, from its curvature
+  const unsigned int pointCount = centerPath.size();
+  std::vector<double> pointTurnRadians(pointCount, 0.0);
+  for (unsigned int i = 1; i < pointCount; i++)
+    pointTurnRadians[i] = pointTurnRadians[i - 1]
+        + 0.5 * (curvaturePerFoot[i - 1] + curvaturePerFoot[i])
+            * (centerPath[i].getPosition().getRotations()
+                - centerPath[i - 1].getPosition().getRotations())
+            / motorRotPerMovementFoot;
+
+  // Sample the center's motion once per iteration period, moving with
+  // constant acceleration between path points, until it comes to rest at
+  // the end of the path
+  const double periodS = trajectoryIterationPeriodMS / 1000.0;
+  const double profileS = VelocityPlanner::profileTimeSeconds(centerPath);
+  if (!std::isfinite(profileS))
+    return false;
+  std::vector<double> centerRotations, centerRPS, centerCurvature,
+      centerTurnRadians;
+  const unsigned int sampleEstimate = static_cast<unsigned int>(profileS
+      / periodS) + 2;
+  centerRotations.reserve(sampleEstimate);
+  centerRPS.reserve(sampleEstimate);
+  centerCurvature.reserve(sampleEstimate);
+  centerTurnRadians.reserve(sampleEstimate);
+  unsigned int i = 1;
+  double segmentStartS = 0.0;
+  for (unsigned int sample = 0;; sample++) {
+    const double timeS = sample * periodS;
+    double startRotations = 0.0, distanceRotations = 0.0;
+    double startRPS = 0.0, endRPS = 0.0;
+    while (i < pointCount) {
+      startRotations = centerPath[i - 1].getPosition().getRotations();
+      distanceRotations = centerPath[i].getPosition().getRotations()
+          - startRotations;
+      startRPS = centerPath[i - 1].getMaxVelocity().getRotationsPerSecond();
+      endRPS = centerPath[i].getMaxVelocity().getRotationsPerSecond();
+      const double segmentS =
+          (distanceRotations > 0) ?
+              2 * distanceRotations / (startRPS + endRPS) : 0.0;
+      if (segmentStartS + segmentS >= timeS)
+        break;
+      segmentStartS += segmentS;
+      i++;
+    }
+    if (i >= pointCount) {
+      centerRotations.push_back(
+          centerPath[pointCount - 1].getPosition().getRotations());
+      centerRPS.push_back(0.0);
+      centerCurvature.push_back(curvaturePerFoot[pointCount - 1]);
+      centerTurnRadians.push_back(pointTurnRadians[pointCount - 1]);
+      break;
+    }
+    const double elapsedS = timeS - segmentStartS;
+    const double accelerationRPSpS =
+        (distanceRotations > 0) ?
+            (endRPS * endRPS - startRPS * startRPS) / (2 * distanceRotations) :
+            0.0;
+    const double travelRotations = startRPS * elapsedS
+        + 0.5 * accelerationRPSpS * elapsedS * elapsedS;
+    const double fraction =
+        (distanceRotations > 0) ?
+            std::min(1.0, travelRotations / distanceRotations) : 1.0;
+    centerRotations.push_back(startRotations + fraction * distanceRotations);
+    centerRPS.push_back(startRPS + accelerationRPSpS * elapsedS);
+    centerCurvature.push_back(curvaturePerFoot[i - 1] + fraction
+        * (curvaturePerFoot[i] - curvaturePerFoot[i - 1]));
+    centerTurnRadians.push_back(pointTurnRadians[i - 1] + fraction
+        * (pointTurnRadians[i] - pointTurnRadians[i - 1]));
+  }
 
-  return;
+  // Each side's motion from the center's, in a single pass (a positive
+  // curvature turns right, so the left side is on the outside)
+  const unsigned int sampleCount = centerRotations.size();
+  const double halfWidthRotations = halfWidthFeet * motorRotPerMovementFoot;
+  std::vector<double> leftRotations(sampleCount), leftRPS(sampleCount),
+      rightRotations(sampleCount), rightRPS(sampleCount);
+  for (unsigned int s = 0; s < sampleCount; s++) {
+    const double offsetRotations = halfWidthRotations * centerTurnRadians[s];
+    const double offsetScale = centerCurvature[s] * halfWidthFeet;
+    leftRotations[s] = centerRotations[s] + offsetRotations;
+    rightRotations[s] = centerRotations[s] - offsetRotations;
+    leftRPS[s] = centerRPS[s] * (1 + offsetScale);
+    rightRPS[s] = centerRPS[s] * (1 - offsetScale);
+  }
+  return leftTrajectory.generateFromSamples(leftRotations, leftRPS,
+                                            trajectoryIterationPeriodMS)
+      && rightTrajectory.generateFromSamples(rightRotations, rightRPS,
+                                             trajectoryIterationPeriodMS);
 }
@@ -4,6 +4,12 @@
  *
  * @author MJenkins, ENPM 808X Spring 2017
  * @date Mar 13, 2017 - Creation
+ * @date Oct 19, 2026 - Generate the governing side once, derive the other side
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Added trajectories for following a curved spline path
+ * @date Oct 19, 2026 - Added move time estimates without generating trajectories
+ * @date Oct 19, 2026 - Governing path points planned in place; callers may own move trajectories;
+ * CSV file names kept from when the chassis name is set
  *
  * @brief TankDrive is a kind of DriveSystem with two wheeled or tracked motivators, one per side
  *
@@ -31,7 +37,9 @@
 #include "MotorVelocity.hpp"
 #include "Path.hpp"
 #include "PathPoint.hpp"
+#include "SplinePath.hpp"
 #include "Trajectory.hpp"
+#include "VelocityPlanner.hpp"
 
 
 /** @brief TankDrive is derived from the base class DriveSystem
@@ -42,12 +50,37 @@ class TankDrive : public DriveSystem {
   TankDrive();
   virtual ~TankDrive();
   void setWidthInFeet(double width);
-  double getWidthInFeet();
+  double getWidthInFeet() const;
   void move(double distanceFeet, ChassisTurnRate chassisTurnRate,
             ChassisVelocity chassisVelocityRequested,
             ChassisAcceleration chassisAccelelerationRequested);
+  void move(double distanceFeet, ChassisTurnRate chassisTurnRate,
+            ChassisVelocity chassisVelocityRequested,
+            ChassisAcceleration chassisAccelerationRequested,
+            Trajectory &leftTrajectory, Trajectory &rightTrajectory) const;
+  void generateTrajectories(double distanceFeet,
+                            ChassisTurnRate chassisTurnRate,
+                            ChassisVelocity chassisVelocityRequested,
+                            ChassisAcceleration chassisAccelerationRequested,
+                            Trajectory &leftTrajectory,
+                            Trajectory &rightTrajectory) const;
+  bool estimateMoveTime(double distanceFeet, ChassisTurnRate chassisTurnRate,
+                        ChassisVelocity chassisVelocityRequested,
+                        ChassisAcceleration chassisAccelerationRequested,
+                        unsigned int &pointCount, double &durationS) const;
+  bool generatePathTrajectories(
+      const SplinePath &splinePath, ChassisVelocity chassisVelocityRequested,
+      ChassisAcceleration chassisAccelerationRequested,
+      Trajectory &leftTrajectory, Trajectory &rightTrajectory) const;
 
  private:
+  void planGoverningPath(double distanceFeet, ChassisTurnRate chassisTurnRate,
+                         ChassisVelocity chassisVelocityRequested,
+                         ChassisAcceleration chassisAccelerationRequested,
+                         PathPoint &beginPathPoint,
+                         PathPoint &endPathPoint,
+                         double &derivedPathMotionScaleFactor,
+                         bool &leftPathGoverns) const;
   double widthInFeet;  // the distance between the left and right side
                        // motivators of the tank drive
 };
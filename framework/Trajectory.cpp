@@ -6,6 +6,16 @@
  * @date Mar 6, 2017 - Creation
  * @date Mar 8, 2017 - Updates to attributes to support trajectory generation
  * @date Mar 9, 2017 - added "generate" method using Path input
+ * @date Oct 19, 2026 - added "generateScaled" to derive a scaled trajectory
+ * @date Oct 19, 2026 - "execute" releases points to a motor output in real time
+ * @date Oct 19, 2026 - Const-correct; generated in place from a const path; points readable without copies
+ * @date Oct 19, 2026 - added "generateFromSamples" to build a trajectory from sampled motion
+ * @date Oct 19, 2026 - added lookup and interpolation of points by time
+ * @date Oct 19, 2026 - added "estimateDuration" to count points without generating them
+ * @date Oct 19, 2026 - Instrumented generation and CSV export
+ * @date Oct 19, 2026 - Filter 1 sum history re-used between generations
+ * @date Oct 19, 2026 - Scaled copies counted apart from generated points
+ * @date Oct 19, 2026 - "generate" and "estimateDuration" also take the two path points directly
  *
  * @brief A trajectory is a vector of motion profile trajectory points
  *
@@ -16,8 +26,24 @@
  * process are stored with the trajectory for information and/or
  * debugging purposes.
  *
+ * The trajectory points are evenly spaced in time, one iteration period
+ * apart, so the point at or before any time is found directly from the
+ * time, without searching.  A consumer running at a faster rate than the
+ * iteration period can interpolate between that point and the next, either
+ * linearly or with a cubic Hermite spline through both points' positions and
+ * velocities (which keeps the velocity continuous across points).
+ *
  */
 #include "Trajectory.hpp"
+#include "Instrumentation.hpp"
+#include "TrajectoryExecutor.hpp"
+
+namespace {
+// Fraction of an iteration period by which a time may fall short of a
+// point's time and still be taken as that point's (so a time computed as a
+// multiple of the period is not put a point early by rounding)
+const double timeTolerancePeriods = 1e-9;
+}  // namespace
 
 Trajectory::Trajectory()
     : maxVelocity(),
@@ -30,7 +56,8 @@ Trajectory::Trajectory()
       algoFL1count(0),
       algoFL2count(0),
       algoNcount(0),
-      trajectory() {
+      trajectory(),
+      filter1SumHistory() {
 }
 
 Trajectory::~Trajectory() {
@@ -40,7 +67,7 @@ Trajectory::~Trajectory() {
  * @brief Get the maximum velocity for this trajectory
  * @return a MotorVelocity representing this trajectory's maximum velocity
  */
-MotorVelocity Trajectory::getMaxVelocity() {
+MotorVelocity Trajectory::getMaxVelocity() const {
   return maxVelocity;
 }
 
@@ -48,7 +75,7 @@ MotorVelocity Trajectory::getMaxVelocity() {
  * @brief Get the maximum acceleration for this trajectory
  * @return a MotorAcceleration representing this trajectory's maximum acceleration
  */
-MotorAcceleration Trajectory::getMaxAcceleration() {
+MotorAcceleration Trajectory::getMaxAcceleration() const {
   return maxAcceleration;
 }
 
@@ -56,7 +83,7 @@ MotorAcceleration Trajectory::getMaxAcceleration() {
  * @brief Get the distance covered by this trajectory (in MotorPosition units)
  * @return a MotorPosition representing this trajectory's distance covered
  */
-MotorPosition Trajectory::getDistance() {
+MotorPosition Trajectory::getDistance() const {
   return distance;
 }
 
@@ -64,7 +91,7 @@ MotorPosition Trajectory::getDistance() {
  * @brief Get the iteration period for this trajectory in milliseconds
  * @return int iteration period in milliseconds
  */
-unsigned int Trajectory::getAlgoItPMS() {
+unsigned int Trajectory::getAlgoItPMS() const {
   return algoItPMS;
 }
 
@@ -72,7 +99,7 @@ unsigned int Trajectory::getAlgoItPMS() {
  * @brief Get the algorithmic variable T1 for this trajectory in milliseconds
  * @return int algorithmic variable T1 for this trajectory in milliseconds
  */
-unsigned int Trajectory::getAlgoT1MS() {
+unsigned int Trajectory::getAlgoT1MS() const {
   return algoT1MS;
 }
 
@@ -80,7 +107,7 @@ unsigned int Trajectory::getAlgoT1MS() {
  * @brief Get the algorithmic variable T2 for this trajectory in milliseconds
  * @return int algorithmic variable T2 for this trajectory in milliseconds
  */
-unsigned int Trajectory::getAlgoT2MS() {
+unsigned int Trajectory::getAlgoT2MS() const {
   return algoT2MS;
 }
 
@@ -88,7 +115,7 @@ unsigned int Trajectory::getAlgoT2MS() {
  * @brief Get the algorithmic variable T4 for this trajectory in milliseconds
  * @return int algorithmic variable T4 for this trajectory in milliseconds
  */
-unsigned int Trajectory::getAlgoT4MS() {
+unsigned int Trajectory::getAlgoT4MS() const {
   return algoT4MS;
 }
 
@@ -96,7 +123,7 @@ unsigned int Trajectory::getAlgoT4MS() {
  * @brief Get the algorithmic variable FL1 for this trajectory as a count
  * @return int algorithmic variable FL1 for this trajectory as a count
  */
-unsigned int Trajectory::getAlgoFL1count() {
+unsigned int Trajectory::getAlgoFL1count() const {
   return algoFL1count;
 }
 
@@ -104,7 +131,7 @@ unsigned int Trajectory::getAlgoFL1count() {
  * @brief Get the algorithmic variable FL2 for this trajectory as a count
  * @return int algorithmic variable FL2 for this trajectory as a count
  */
-unsigned int Trajectory::getAlgoFL2count() {
+unsigned int Trajectory::getAlgoFL2count() const {
   return algoFL2count;
 }
 
@@ -112,7 +139,7 @@ unsigned int Trajectory::getAlgoFL2count() {
  * @brief Get the algorithmic variable N for this trajectory as a count
  * @return int algorithmic variable N for this trajectory as a count
  */
-unsigned int Trajectory::getAlgoNcount() {
+unsigned int Trajectory::getAlgoNcount() const {
   return algoNcount;
 }
 
@@ -138,16 +165,49 @@ void Trajectory::addToHistory(std::vector<double> &history,
   return;
 }
 
+/**
+ * @brief Private function to derive the trajectory generation algorithm's time factors and counts
+ * @param [in] double distanceRotations to be traveled
+ * @param [in] double maxVelocityRPS - maximum velocity in rotations per second
+ * @param [in] double maxAccelerationRPSpS - maximum acceleration in rotations per second per
+ * second
+ * @param [in] unsigned int iterationPeriodMS - time slice for each trajectory point
+ * @return AlgorithmParameters time factors (in milliseconds) and counts (in iteration periods)
+ */
+Trajectory::AlgorithmParameters Trajectory::deriveParameters(
+    const double distanceRotations, const double maxVelocityRPS,
+    const double maxAccelerationRPSpS, const unsigned int iterationPeriodMS) {
+  AlgorithmParameters parameters;
+  // Algorithm time factor T1 in milliseconds
+  // - time to reach max vel at max accel
+  parameters.t1MS = (maxVelocityRPS / maxAccelerationRPSpS) * 1000;
+  // Algorithm time factor T2 in milliseconds - used to calculate lookback time
+  // for the Filter 2 sum (manually adjustable in the Talon SRX model)
+  // This implementation currently fixes it at half of T1; may need tuning later
+  parameters.t2MS = parameters.t1MS / 2;
+  // Algorithm time factor T4  in milliseconds
+  // - the time to traverse the distance at max velocity
+  parameters.t4MS = (distanceRotations / maxVelocityRPS) * 1000;
+  // Algorithm FL1 count - number of iteration periods in time T1
+  parameters.fl1Count = ceil(
+      static_cast<double>(parameters.t1MS)
+          / static_cast<double>(iterationPeriodMS));
+  // Algorithm FL2 count - number of iteration periods in time T2
+  parameters.fl2Count = ceil(
+      static_cast<double>(parameters.t2MS)
+          / static_cast<double>(iterationPeriodMS));
+  // Algorithm N count - number of iteration periods in time T4
+  parameters.nCount = static_cast<double>(parameters.t4MS)
+      / static_cast<double>(iterationPeriodMS);
+  return parameters;
+}
+
 /**
  * @brief Generate a trajectory based on a provided 2-point path
  * @param [in] path A motion path consisting of a series of path points
  * @param [in] unsigned int iteration period in milliseconds (time slice for execution of each trajectory point)
  */
-// Note that the path parameter cannot be set to a "const reference" without
-// causing the path.size, pathGetFirstPathPoint, and pathGetNextPathPoint
-// methods to no longer be recognized; fixing this is future work
-
-void Trajectory::generate(Path &path,
+void Trajectory::generate(const Path &path,
                           const unsigned int iterationPeriodMS) {
   // This is the two-point path version of trajectory generation - only
   // paths where the counting of the path points is two, no more, and
@@ -161,26 +221,34 @@ void Trajectory::generate(Path &path,
     return;
   }
 
+  // The path points are read in place, without copying them
+  generate(path[0], path[1], iterationPeriodMS);
+  return;
+}
+
+/**
+ * @brief Generate a trajectory between two path points, as for a 2-point path holding them
+ * @param [in] PathPoint firstPathPoint - where the motion starts, with its maximum velocity and acceleration
+ * @param [in] PathPoint nextPathPoint - where the motion ends
+ * @param [in] unsigned int iteration period in milliseconds (time slice for execution of each trajectory point)
+ */
+void Trajectory::generate(const PathPoint &firstPathPoint,
+                          const PathPoint &nextPathPoint,
+                          const unsigned int iterationPeriodMS) {
+  MCSF_SCOPED_TIMER(generationNS);
+
   // *******************************************************************
   // Set up the parameters for the trajectory generation algorithm
   // *******************************************************************
   // The maximum velocity and acceleration information for the trajectory
   // between two points is determined by the settings for the first point
-  PathPoint firstPathPoint;
-  MotorPosition startPosition, endPosition;
-  // Get the first path point
-  if (path.getFirstPathPoint(firstPathPoint)) {
-    // Set the starting position at the position of the first path point
-    startPosition = firstPathPoint.getPosition();
-    // Set the max velocity and acceleration for the trajectory
-    maxVelocity = firstPathPoint.getMaxVelocity();
-    maxAcceleration = firstPathPoint.getMaxAcceleration();
-    // Get the next path point
-    PathPoint nextPathPoint;
-    if (path.getNextPathPoint(nextPathPoint))
-      // Set the ending position at the position of the next path point
-      endPosition = nextPathPoint.getPosition();
-  }
+  // Set the starting position at the position of the first path point
+  MotorPosition startPosition = firstPathPoint.getPosition();
+  // Set the max velocity and acceleration for the trajectory
+  maxVelocity = firstPathPoint.getMaxVelocity();
+  maxAcceleration = firstPathPoint.getMaxAcceleration();
+  // Set the ending position at the position of the next path point
+  MotorPosition endPosition = nextPathPoint.getPosition();
   // The distance to be traveled is the difference between the two positions
   distance = endPosition - startPosition;
   // Algorithm distance is measured in motor rotations
@@ -190,34 +258,33 @@ void Trajectory::generate(Path &path,
   // Algorithm maximum acceleration is in rotations per second per second
   double algoMaxAccelRPSpS = maxAcceleration.getRotationsPerMinutePerSecond()
       / 60;
-  // Algorithm time factor T1 in milliseconds
-  // - time to reach max vel at max accel
-  algoT1MS = (algoMaxVelRPS / algoMaxAccelRPSpS) * 1000;
-  // Algorithm time factor T2 in milliseconds - used to calculate lookback time
-  // for the Filter 2 sum (manually adjustable in the Talon SRX model)
-  // This implementation currently fixes it at half of T1; may need tuning later
-  algoT2MS = algoT1MS / 2;
   // Algorithm Iteration Period in milliseconds
   // - the granularity of the trajectory points
   algoItPMS = iterationPeriodMS;
-  // Algorithm time factor T4  in milliseconds
-  // - the time to traverse the distance at max velocity
-  algoT4MS = (algoDistRot / algoMaxVelRPS) * 1000;
-  // Algorithm FL1 count - number of iteration periods in time T1
-  algoFL1count = ceil(
-      static_cast<double>(algoT1MS) / static_cast<double>(algoItPMS));
+  // Algorithm time factors and counts (shared with duration estimates)
+  const AlgorithmParameters parameters = deriveParameters(algoDistRot,
+                                                          algoMaxVelRPS,
+                                                          algoMaxAccelRPSpS,
+                                                          algoItPMS);
+  algoT1MS = parameters.t1MS;
+  algoT2MS = parameters.t2MS;
+  algoT4MS = parameters.t4MS;
+  algoFL1count = parameters.fl1Count;
   double algoFL1recip = 1 / static_cast<double>(algoFL1count);
-  // Algorithm FL2 count - number of iteration periods in time T2
-  algoFL2count = ceil(
-      static_cast<double>(algoT2MS) / static_cast<double>(algoItPMS));
-  // Algorithm N count - number of iteration periods in time T4
-  algoNcount = static_cast<double>(algoT4MS) / static_cast<double>(algoItPMS);
-
-  // A vector to hold the history of Filter 1 sum values
-  std::vector<double> algoFilter1SumHistory;
-
-  // Ensure the trajectory is clear (in case this is a repeat invocation)
+  algoFL2count = parameters.fl2Count;
+  algoNcount = parameters.nCount;
+
+  // A vector to hold the history of Filter 1 sum values (this trajectory's
+  // own, so a repeat invocation re-uses its storage)
+  std::vector<double> &algoFilter1SumHistory = filter1SumHistory;
+  algoFilter1SumHistory.clear();
+
+  // Ensure the trajectory is clear (in case this is a repeat invocation), and
+  // make room for every point up front: the filters ramp up over FL1 + FL2
+  // steps, hold for about N steps, and ramp down over FL1 + FL2 steps, so
+  // the trajectory is never reallocated (copying every point) as it grows
   trajectory.clear();
+  trajectory.reserve(algoNcount + 2 * (algoFL1count + algoFL2count) + 2);
 
   // *******************************************************************
   // Generate the first trajectory point with manually-set zeroed values
@@ -241,35 +308,33 @@ void Trajectory::generate(Path &path,
 
   // Add first trajectory point to the trajectory
 
-  // Get a variable for the trajectory point (we will re-use this in the
-  // algorithm loop
-  TrajectoryPoint tPoint;
+  // Construct the trajectory point in place at the end of the trajectory
+  // (each trajectory point is constructed this way in the algorithm loop)
+  trajectory.emplace_back();
+  TrajectoryPoint *tPoint = &trajectory.back();
 
   // Add a MotorPosition object with the current trajectory point rotations
   MotorPosition tpMotorPosition;
   tpMotorPosition.setRotations(tpPositionRot);
-  tPoint.setPosition(tpMotorPosition);
+  tPoint->setPosition(tpMotorPosition);
 
   // Add a MotorVelocity object with the current trajectory point velocity
   MotorVelocity tpMotorVelocity;
   tpMotorVelocity.setRotationsPerMinute(tpVelocityRPS * 60);
-  tPoint.setVelocity(tpMotorVelocity);
+  tPoint->setVelocity(tpMotorVelocity);
 
   // Add a MotorAcceleration object with the current
   // trajectory point acceleration
   MotorAcceleration tpMotorAcceleration;
   tpMotorAcceleration.setRotationsPerMinutePerSecond(tpAccelerationRPSpS * 60);
-  tPoint.setAcceleration(tpMotorAcceleration);
+  tPoint->setAcceleration(tpMotorAcceleration);
 
   // Add in algorithmic details
-  tPoint.setDurationMS(algoItPMS);
-  tPoint.setStep(algoStep);
-  tPoint.setTimeS(tpTimeS);
-  tPoint.setFilter1Sum(algoFilter1Sum);
-  tPoint.setFilter2Sum(algoFilter2Sum);
-
-  // Stick the completed trajectory point onto the trajectory
-  trajectory.push_back(tPoint);
+  tPoint->setDurationMS(algoItPMS);
+  tPoint->setStep(algoStep);
+  tPoint->setTimeS(tpTimeS);
+  tPoint->setFilter1Sum(algoFilter1Sum);
+  tPoint->setFilter2Sum(algoFilter2Sum);
 
   // *******************************************************************
   // Generate the rest of the trajectory points with algorithmically
@@ -319,54 +384,406 @@ void Trajectory::generate(Path &path,
     tpTimeS = ((static_cast<double>(algoStep) - 1.0)
         * static_cast<double>(algoItPMS)) / 1000.0;
 
-    // Add this trajectory point to the trajectory
+    // Add this trajectory point to the trajectory, constructing it in place
+    trajectory.emplace_back();
+    tPoint = &trajectory.back();
 
     // Add a MotorPosition object with the current trajectory point rotations
     tpMotorPosition.setRotations(tpPositionRot);
-    tPoint.setPosition(tpMotorPosition);
+    tPoint->setPosition(tpMotorPosition);
 
     // Add a MotorVelocity object with the current trajectory point velocity
     tpMotorVelocity.setRotationsPerMinute(tpVelocityRPS * 60);
-    tPoint.setVelocity(tpMotorVelocity);
+    tPoint->setVelocity(tpMotorVelocity);
 
     // Add a MotorAcceleration object with the current
     // trajectory point acceleration
     tpMotorAcceleration.setRotationsPerMinutePerSecond(
         tpAccelerationRPSpS * 60);
-    tPoint.setAcceleration(tpMotorAcceleration);
+    tPoint->setAcceleration(tpMotorAcceleration);
 
     // Add the trajectory point duration (ms)
-    tPoint.setDurationMS(algoItPMS);
+    tPoint->setDurationMS(algoItPMS);
 
     // Add in algorithmic details to the trajectory point
-    tPoint.setStep(algoStep);
-    tPoint.setTimeS(tpTimeS);
-    tPoint.setFilter1Sum(algoFilter1Sum);
-    tPoint.setFilter2Sum(algoFilter2Sum);
-
-    // Stick the completed trajectory point onto the trajectory
-    trajectory.push_back(tPoint);
+    tPoint->setStep(algoStep);
+    tPoint->setTimeS(tpTimeS);
+    tPoint->setFilter1Sum(algoFilter1Sum);
+    tPoint->setFilter2Sum(algoFilter2Sum);
 
     // Save current velocity for the next loop through the algorithm
     tpVelocityRPSlastStep = tpVelocityRPS;
 
     // Keep on keeping on until Filter1 sum and Filter2 sum are both zero
   } while (algoFilter1Sum != 0 || algoFilter2Sum != 0);
+  MCSF_COUNT(pointsGenerated, trajectory.size());
 
   // We have generated our trajectory; return to caller
   return;
 }
 
 /**
- * @brief Stub Execution of this trajectory's motion profile trajectory points
+ * @brief Generate a trajectory by scaling the motion of another trajectory
+ *
+ * Scaling a two-point path's distance, maximum velocity, and maximum
+ * acceleration by the same factor leaves the algorithm's timing (T1, T2,
+ * T4, FL1, FL2, and N) unchanged and scales every trajectory point's
+ * position, velocity, and acceleration by that factor, so the scaled
+ * trajectory can be derived without re-running the generation algorithm.
+ *
+ * @param [in] Trajectory source trajectory to be scaled
+ * @param [in] double scaleFactor to apply to the source trajectory's motion
  */
-void Trajectory::execute() {
-  std::cout << "Executing motion profile trajectory: (one dot per point)"
-            << std::endl;
-  for (auto trajectoryPoint : trajectory)
-    std::cout << ".";
-  std::cout << std::endl;
-  std::cout << "End of motion profile trajectory execution." << std::endl;
+void Trajectory::generateScaled(const Trajectory &source,
+                                const double scaleFactor) {
+  MCSF_SCOPED_TIMER(generationNS);
+
+  // Copy the algorithm parameters and trajectory points from the source
+  // (re-using this trajectory's storage in case this is a repeat invocation)
+  maxVelocity = source.maxVelocity;
+  maxAcceleration = source.maxAcceleration;
+  distance = source.distance;
+  algoItPMS = source.algoItPMS;
+  algoT1MS = source.algoT1MS;
+  algoT2MS = source.algoT2MS;
+  algoT4MS = source.algoT4MS;
+  algoFL1count = source.algoFL1count;
+  algoFL2count = source.algoFL2count;
+  algoNcount = source.algoNcount;
+  trajectory = source.trajectory;
+  MCSF_COUNT(pointsScaled, trajectory.size());
+
+  // An unscaled trajectory is an exact copy; nothing more to do
+  if (scaleFactor == 1.0)
+    return;
+
+  // Scale the trajectory's motion constraints and distance
+  maxVelocity.setRotationsPerMinute(
+      maxVelocity.getRotationsPerMinute() * scaleFactor);
+  maxAcceleration.setRotationsPerMinutePerSecond(
+      maxAcceleration.getRotationsPerMinutePerSecond() * scaleFactor);
+  distance.setRotations(distance.getRotations() * scaleFactor);
+
+  // Scale the motion of each trajectory point in a single pass
+  for (auto &tPoint : trajectory)
+    tPoint.scaleMotion(scaleFactor);
+
+  return;
+}
+
+/**
+ * @brief Build this trajectory from motion sampled once per iteration period
+ *
+ * Used for motion that does not come from the trajectory generation algorithm (such as one
+ * side of a drive following a curved path): each sample becomes a trajectory point, with the
+ * acceleration taken from the change in velocity since the previous sample.  The algorithm
+ * parameters other than the iteration period and point count are left at 0.
+ *
+ * @param [in] vector of double positionRotations - motor position at each sample
+ * @param [in] vector of double velocityRPS - motor velocity at each sample
+ * @param [in] unsigned int iterationPeriodMS - time between samples
+ * @return bool indication of whether the trajectory was built (false if there are no samples,
+ * the position and velocity sample counts differ, or the period is 0)
+ */
+bool Trajectory::generateFromSamples(
+    const std::vector<double> &positionRotations,
+    const std::vector<double> &velocityRPS,
+    const unsigned int iterationPeriodMS) {
+  MCSF_SCOPED_TIMER(generationNS);
+  trajectory.clear();
+  if (positionRotations.empty()
+      || positionRotations.size() != velocityRPS.size()
+      || iterationPeriodMS == 0)
+    return false;
+
+  algoItPMS = iterationPeriodMS;
+  algoT1MS = 0;
+  algoT2MS = 0;
+  algoT4MS = 0;
+  algoFL1count = 0;
+  algoFL2count = 0;
+  algoNcount = positionRotations.size();
+  const double periodS = iterationPeriodMS / 1000.0;
+
+  // Construct each trajectory point in place, tracking the largest velocity
+  // and acceleration reached
+  trajectory.reserve(positionRotations.size());
+  double maxVelocityRPS = 0.0, maxAccelerationRPSpS = 0.0;
+  for (std::vector<double>::size_type i = 0; i < positionRotations.size();
+      i++) {
+    const double accelerationRPSpS =
+        (i == 0) ? 0.0 : (velocityRPS[i] - velocityRPS[i - 1]) / periodS;
+    maxVelocityRPS = std::max(maxVelocityRPS, std::fabs(velocityRPS[i]));
+    maxAccelerationRPSpS = std::max(maxAccelerationRPSpS,
+                                    std::fabs(accelerationRPSpS));
+    trajectory.emplace_back();
+    TrajectoryPoint *tPoint = &trajectory.back();
+    tPoint->setPosition(MotorPosition::fromRotations(positionRotations[i]));
+    tPoint->setVelocity(MotorVelocity::fromRotationsPerSecond(velocityRPS[i]));
+    tPoint->setAcceleration(
+        MotorAcceleration::fromRotationsPerSecondPerSecond(accelerationRPSpS));
+    tPoint->setDurationMS(algoItPMS);
+    tPoint->setStep(i + 1);
+    tPoint->setTimeS(i * periodS);
+    tPoint->setFilter1Sum(0.0);
+    tPoint->setFilter2Sum(0.0);
+  }
+  maxVelocity.setRotationsPerSecond(maxVelocityRPS);
+  maxAcceleration.setRotationsPerSecondPerSecond(maxAccelerationRPSpS);
+  distance.setRotations(positionRotations.back());
+  MCSF_COUNT(pointsGenerated, trajectory.size());
+  return true;
+}
+
+/**
+ * @brief Count the points a 2-point path's trajectory would have, without generating it
+ *
+ * The generator's Filter 1 sum rises by 1 / FL1 per step (to at most 1) for N steps, then falls
+ * by 1 / FL1 per step to 0, and the Filter 2 sum (of the last FL2 Filter 1 sums) reaches 0 FL2
+ * steps after the last non-zero Filter 1 sum; so the point count follows directly from N, FL1
+ * and FL2.  Only the Filter 1 ramps are replayed (at most FL1 + 1 steps each, however long the
+ * move), so the count matches the generator's exactly, rounding included.
+ *
+ * @param [in] Path path consisting of two path points, as given to "generate"
+ * @param [in] unsigned int iterationPeriodMS - time slice for each trajectory point
+ * @param [out] unsigned int pointCount - number of trajectory points "generate" would make
+ * @param [out] double durationS - time from the first trajectory point to the last, in seconds
+ * @return bool indication of whether the path can be generated (false unless the path has two
+ * points, a distance that is not negative, a positive maximum velocity and acceleration, and a
+ * positive iteration period)
+ */
+bool Trajectory::estimateDuration(const Path &path,
+                                  const unsigned int iterationPeriodMS,
+                                  unsigned int &pointCount,
+                                  double &durationS) {
+  if (path.size() != 2) {
+    pointCount = 0;
+    durationS = 0.0;
+    return false;
+  }
+  return estimateDuration(path[0], path[1], iterationPeriodMS, pointCount,
+                          durationS);
+}
+
+/**
+ * @brief Count the points the trajectory between two path points would have, without generating it
+ * @param [in] PathPoint firstPathPoint - where the motion starts, with its maximum velocity and acceleration
+ * @param [in] PathPoint nextPathPoint - where the motion ends
+ * @param [in] unsigned int iterationPeriodMS - time slice for each trajectory point
+ * @param [out] unsigned int pointCount - number of trajectory points "generate" would make
+ * @param [out] double durationS - time from the first trajectory point to the last, in seconds
+ * @return bool indication of whether the trajectory can be generated (false unless the distance
+ * is not negative, the maximum velocity and acceleration are positive, and the iteration period
+ * is positive)
+ */
+bool Trajectory::estimateDuration(const PathPoint &firstPathPoint,
+                                  const PathPoint &nextPathPoint,
+                                  const unsigned int iterationPeriodMS,
+                                  unsigned int &pointCount,
+                                  double &durationS) {
+  pointCount = 0;
+  durationS = 0.0;
+  if (iterationPeriodMS == 0)
+    return false;
+  const double distanceRotations = (nextPathPoint.getPosition()
+      - firstPathPoint.getPosition()).getRotations();
+  const double maxVelocityRPS =
+      firstPathPoint.getMaxVelocity().getRotationsPerMinute() / 60;
+  const double maxAccelerationRPSpS =
+      firstPathPoint.getMaxAcceleration().getRotationsPerMinutePerSecond() / 60;
+  if (distanceRotations < 0 || maxVelocityRPS <= 0 || maxAccelerationRPSpS <= 0)
+    return false;
+  const AlgorithmParameters parameters = deriveParameters(distanceRotations,
+                                                          maxVelocityRPS,
+                                                          maxAccelerationRPSpS,
+                                                          iterationPeriodMS);
+
+  // With no Filter 2 lookback limit, the Filter 2 sum of a move never
+  // returns to 0, so the generator would not finish
+  if (parameters.nCount > 0 && parameters.fl2Count == 0)
+    return false;
+
+  // Replay Filter 1's rise (it holds at 1 once it gets there) and fall
+  const double filter1Recip = 1 / static_cast<double>(parameters.fl1Count);
+  double filter1Sum = 0.0;
+  const unsigned int riseSteps = std::min(parameters.nCount,
+                                          parameters.fl1Count + 1);
+  for (unsigned int step = 0; step < riseSteps; step++)
+    filter1Sum = std::min((filter1Sum + filter1Recip), 1.0);
+  unsigned int fallSteps = 0;
+  while (filter1Sum != 0) {
+    filter1Sum = std::max((filter1Sum - filter1Recip), 0.0);
+    fallSteps++;
+  }
+
+  // Steps 2 to N + 1 rise and the next fallSteps fall; the last non-zero
+  // Filter 1 sum is at step N + fallSteps, and the last step is FL2 later
+  // (a move of no distance stops after its second step)
+  pointCount = (fallSteps == 0) ?
+      2 : parameters.nCount + fallSteps + parameters.fl2Count;
+  durationS = (pointCount - 1) * (iterationPeriodMS / 1000.0);
+  return true;
+}
+
+/**
+ * @brief Find the trajectory point at or before a time, and how far it is to the next point
+ * @param [in] double timeS - time since the first trajectory point, in seconds
+ * @param [out] unsigned int index of the trajectory point at or before the time (clamped to
+ * the trajectory)
+ * @param [out] double fraction of the iteration period from that point to the time (0 at or
+ * outside either end)
+ * @return bool indication of whether the time is on the trajectory
+ */
+bool Trajectory::locateTime(const double timeS, unsigned int &index,
+                            double &fraction) const {
+  index = 0;
+  fraction = 0.0;
+  if (trajectory.empty() || algoItPMS == 0)
+    return false;
+
+  // Points are one iteration period apart, so the time in periods gives the
+  // point directly
+  const unsigned int lastIndex = trajectory.size() - 1;
+  const double periods = timeS * 1000.0 / algoItPMS;
+  if (periods < -timeTolerancePeriods)
+    return false;
+  if (periods >= lastIndex - timeTolerancePeriods) {
+    index = lastIndex;
+    return periods <= lastIndex + timeTolerancePeriods;
+  }
+  const double wholePeriods = std::floor(periods + timeTolerancePeriods);
+  index = static_cast<unsigned int>(std::max(wholePeriods, 0.0));
+  fraction = std::max(periods - wholePeriods, 0.0);
+  return true;
+}
+
+/**
+ * @brief Get a trajectory point from this motion profile trajectory
+ * @param [in] unsigned int index of the trajectory point (0 is the first point)
+ * @param [out] TrajectoryPoint set equal to the value of the indexed trajectory point
+ * @return bool indication of whether the requested point was on the trajectory
+ */
+bool Trajectory::getTrajectoryPoint(const unsigned int index,
+                                    TrajectoryPoint &trajectoryPoint) const {
+  // Make sure the index is on the trajectory before accessing it
+  if (index < trajectory.size()) {
+    trajectoryPoint = trajectory[index];
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Gives read-only access to the points of this trajectory, without copying them
+ * @return vector of TrajectoryPoint - the trajectory points, in order
+ */
+const std::vector<TrajectoryPoint> &Trajectory::getTrajectoryPoints() const {
+  return trajectory;
+}
+
+/**
+ * @brief Get the time from this trajectory's first point to its last
+ * @return double duration in seconds (0 if the trajectory has fewer than two points)
+ */
+double Trajectory::getDurationS() const {
+  if (trajectory.empty())
+    return 0.0;
+  return (trajectory.size() - 1) * (algoItPMS / 1000.0);
+}
+
+/**
+ * @brief Find the trajectory point at or before a time, in constant time
+ * @param [in] double timeS - time since the first trajectory point, in seconds
+ * @return unsigned int index of the trajectory point (0 before the start, and the last point's
+ * index after the end)
+ */
+unsigned int Trajectory::getIndexAtTime(const double timeS) const {
+  unsigned int index;
+  double fraction;
+  locateTime(timeS, index, fraction);
+  return index;
+}
+
+/**
+ * @brief Interpolate linearly between the trajectory points either side of a time
+ * @param [in] double timeS - time since the first trajectory point, in seconds
+ * @param [out] MotorPosition position at that time
+ * @param [out] MotorVelocity velocity at that time
+ * @return bool indication of whether the time is on the trajectory (before the start or after
+ * the end, the first or last point's position and velocity are given)
+ */
+bool Trajectory::interpolateLinear(const double timeS, MotorPosition &position,
+                                   MotorVelocity &velocity) const {
+  unsigned int index;
+  double fraction;
+  const bool onTrajectory = locateTime(timeS, index, fraction);
+  if (trajectory.empty())
+    return false;
+  const TrajectoryPoint &from = trajectory[index];
+  if (fraction == 0) {
+    position = from.getPosition();
+    velocity = from.getVelocity();
+    return onTrajectory;
+  }
+  const TrajectoryPoint &to = trajectory[index + 1];
+  const double fromRotations = from.getPosition().getRotations();
+  const double fromRPS = from.getVelocity().getRotationsPerSecond();
+  position.setRotations(fromRotations
+      + fraction * (to.getPosition().getRotations() - fromRotations));
+  velocity.setRotationsPerSecond(fromRPS
+      + fraction * (to.getVelocity().getRotationsPerSecond() - fromRPS));
+  return onTrajectory;
+}
+
+/**
+ * @brief Interpolate with a cubic Hermite spline through the trajectory points either side of
+ * a time, matching both points' positions and velocities
+ * @param [in] double timeS - time since the first trajectory point, in seconds
+ * @param [out] MotorPosition position at that time
+ * @param [out] MotorVelocity velocity at that time (the spline's slope)
+ * @return bool indication of whether the time is on the trajectory (before the start or after
+ * the end, the first or last point's position and velocity are given)
+ */
+bool Trajectory::interpolateHermite(const double timeS,
+                                    MotorPosition &position,
+                                    MotorVelocity &velocity) const {
+  unsigned int index;
+  double s;
+  const bool onTrajectory = locateTime(timeS, index, s);
+  if (trajectory.empty())
+    return false;
+  const TrajectoryPoint &from = trajectory[index];
+  if (s == 0) {
+    position = from.getPosition();
+    velocity = from.getVelocity();
+    return onTrajectory;
+  }
+  const TrajectoryPoint &to = trajectory[index + 1];
+
+  // The Hermite basis over one period, with the velocities scaled to
+  // rotations per period
+  const double periodS = algoItPMS / 1000.0;
+  const double p0 = from.getPosition().getRotations();
+  const double p1 = to.getPosition().getRotations();
+  const double m0 = from.getVelocity().getRotationsPerSecond() * periodS;
+  const double m1 = to.getVelocity().getRotationsPerSecond() * periodS;
+  const double s2 = s * s, s3 = s2 * s;
+  position.setRotations((2 * s3 - 3 * s2 + 1) * p0 + (s3 - 2 * s2 + s) * m0
+      + (-2 * s3 + 3 * s2) * p1 + (s3 - s2) * m1);
+  velocity.setRotationsPerSecond(((6 * s2 - 6 * s) * p0
+      + (3 * s2 - 4 * s + 1) * m0 + (-6 * s2 + 6 * s) * p1
+      + (3 * s2 - 2 * s) * m1) / periodS);
+  return onTrajectory;
+}
+
+/**
+ * @brief Execute this trajectory's motion profile trajectory points in real time
+ * @param [in] MotorOutput motorOutput that receives one trajectory point per iteration period
+ */
+void Trajectory::execute(MotorOutput &motorOutput) const {
+  TrajectoryExecutor executor;
+  executor.addTrajectory(*this, motorOutput);
+  executor.execute();
   return;
 }
 
@@ -374,16 +791,16 @@ void Trajectory::execute() {
  * @brief Returns the number of points in the motion profile trajectory
  * @return int motion profile trajectory size
  */
-unsigned int Trajectory::size() {
+unsigned int Trajectory::size() const {
 return trajectory.size();
 }
 
 /**
  * @brief Show this motion profile trajectory as individual points
  */
-void Trajectory::show() {
+void Trajectory::show() const {
   std::cout << "Motion Profile trajectory:" << std::endl;
-  for (auto trajectoryPoint : trajectory) {
+  for (const auto &trajectoryPoint : trajectory) {
     trajectoryPoint.show();
     std::cout << std::endl;
   }
@@ -394,7 +811,9 @@ void Trajectory::show() {
 /**
  * @brief Output this motion profile trajectory as data to a CSV file
  */
-void Trajectory::outputCSV(const std::string &trajectoryFileName) {
+void Trajectory::outputCSV(const std::string &trajectoryFileName) const {
+  MCSF_SCOPED_TIMER(exportNS);
+
   // Open the trajectory file for output, wiping any current content
   std::ofstream tFile(trajectoryFileName,
                                  std::ios::out | std::ios::trunc);
@@ -417,13 +836,14 @@ void Trajectory::outputCSV(const std::string &trajectoryFileName) {
 
   // Write out the trajectory points as tabular data
   bool headerNeeded = true;
-  for (auto tp : trajectory) {
+  for (const auto &tp : trajectory) {
     if (headerNeeded) {
       tp.outputCSVheader(tFile);
       headerNeeded = false;
     }
     tp.outputCSV(tFile);
   }
+  MCSF_COUNT(bytesWritten, std::max<std::streamoff>(tFile.tellp(), 0));
   // Close out the trajectory file, and return from whence we were called
   tFile.close();
   return;
@@ -6,6 +6,14 @@
  * @date Mar 6, 2017 - Creation
  * @date Mar 8, 2017 - Updates to attributes to support trajectory generation
  * @date Mar 9, 2017 - added "generate" method using Path input
+ * @date Oct 19, 2026 - added "generateScaled" to derive a scaled trajectory
+ * @date Oct 19, 2026 - "execute" releases points to a motor output in real time
+ * @date Oct 19, 2026 - Const-correct; generated in place from a const path; points readable without copies
+ * @date Oct 19, 2026 - added "generateFromSamples" to build a trajectory from sampled motion
+ * @date Oct 19, 2026 - added lookup and interpolation of points by time
+ * @date Oct 19, 2026 - added "estimateDuration" to count points without generating them
+ * @date Oct 19, 2026 - Filter 1 sum history re-used between generations
+ * @date Oct 19, 2026 - "generate" and "estimateDuration" also take the two path points directly
  *
  * @brief A trajectory is a vector of motion profile trajectory points
  *
@@ -16,6 +24,13 @@
  * process are stored with the trajectory for information and/or
  * debugging purposes.
  *
+ * The trajectory points are evenly spaced in time, one iteration period
+ * apart, so the point at or before any time is found directly from the
+ * time, without searching.  A consumer running at a faster rate than the
+ * iteration period can interpolate between that point and the next, either
+ * linearly or with a cubic Hermite spline through both points' positions and
+ * velocities (which keeps the velocity continuous across points).
+ *
  */
 #ifndef TRAJECTORY_HPP_
 #define TRAJECTORY_HPP_
@@ -30,6 +45,7 @@
 #include "MotorPosition.hpp"
 #include "MotorVelocity.hpp"
 #include "MotorAcceleration.hpp"
+#include "MotorOutput.hpp"
 #include "TrajectoryPoint.hpp"
 #include "Path.hpp"
 #include "PathPoint.hpp"
@@ -41,25 +57,63 @@ class Trajectory {
  public:
   Trajectory();
   virtual ~Trajectory();
-  MotorVelocity getMaxVelocity();
-  MotorAcceleration getMaxAcceleration();
-  MotorPosition getDistance();
-  unsigned int getAlgoItPMS();
-  unsigned int getAlgoT1MS();
-  unsigned int getAlgoT2MS();
-  unsigned int getAlgoT4MS();
-  unsigned int getAlgoFL1count();
-  unsigned int getAlgoFL2count();
-  unsigned int getAlgoNcount();
-  void generate(Path &path, const unsigned int iterationPeriodMS);
-  void execute();
-  unsigned int size();
-  void show();
-  void outputCSV(const std::string &trajectoryFileName);
+  MotorVelocity getMaxVelocity() const;
+  MotorAcceleration getMaxAcceleration() const;
+  MotorPosition getDistance() const;
+  unsigned int getAlgoItPMS() const;
+  unsigned int getAlgoT1MS() const;
+  unsigned int getAlgoT2MS() const;
+  unsigned int getAlgoT4MS() const;
+  unsigned int getAlgoFL1count() const;
+  unsigned int getAlgoFL2count() const;
+  unsigned int getAlgoNcount() const;
+  void generate(const Path &path, const unsigned int iterationPeriodMS);
+  void generate(const PathPoint &firstPathPoint,
+                const PathPoint &nextPathPoint,
+                const unsigned int iterationPeriodMS);
+  void generateScaled(const Trajectory &source, const double scaleFactor);
+  bool generateFromSamples(const std::vector<double> &positionRotations,
+                           const std::vector<double> &velocityRPS,
+                           const unsigned int iterationPeriodMS);
+  static bool estimateDuration(const Path &path,
+                               const unsigned int iterationPeriodMS,
+                               unsigned int &pointCount, double &durationS);
+  static bool estimateDuration(const PathPoint &firstPathPoint,
+                               const PathPoint &nextPathPoint,
+                               const unsigned int iterationPeriodMS,
+                               unsigned int &pointCount, double &durationS);
+  bool getTrajectoryPoint(const unsigned int index,
+                          TrajectoryPoint &trajectoryPoint) const;
+  const std::vector<TrajectoryPoint> &getTrajectoryPoints() const;
+  double getDurationS() const;
+  unsigned int getIndexAtTime(const double timeS) const;
+  bool interpolateLinear(const double timeS, MotorPosition &position,
+                         MotorVelocity &velocity) const;
+  bool interpolateHermite(const double timeS, MotorPosition &position,
+                          MotorVelocity &velocity) const;
+  void execute(MotorOutput &motorOutput) const;
+  unsigned int size() const;
+  void show() const;
+  void outputCSV(const std::string &trajectoryFileName) const;
 
  private:
+  // The generation algorithm's time factors and counts, from a path's
+  // distance, maximum velocity and maximum acceleration
+  struct AlgorithmParameters {
+    unsigned int t1MS;      // time to reach max velocity at max acceleration
+    unsigned int t2MS;      // Filter 2 lookback time
+    unsigned int t4MS;      // time to traverse the distance at max velocity
+    unsigned int fl1Count;  // iteration periods in T1
+    unsigned int fl2Count;  // iteration periods in T2
+    unsigned int nCount;    // iteration periods in T4
+  };
+  static AlgorithmParameters deriveParameters(
+      const double distanceRotations, const double maxVelocityRPS,
+      const double maxAccelerationRPSpS, const unsigned int iterationPeriodMS);
   void addToHistory(std::vector<double> &history, const unsigned int max,
                     const double value);
+  bool locateTime(const double timeS, unsigned int &index,
+                  double &fraction) const;
   MotorVelocity maxVelocity;          // max velocity for this trajectory
   MotorAcceleration maxAcceleration;  // max acceleration for this trajectory
   MotorPosition distance;             // total distance for this trajectory
@@ -71,6 +125,7 @@ class Trajectory {
   unsigned int algoFL2count;          // algorithm FL2 count
   unsigned int algoNcount;            // algorithm N count
   std::vector<TrajectoryPoint> trajectory;  // the series of trajectory points
+  std::vector<double> filter1SumHistory;    // generation scratch, re-used
 };
 
 #endif /* TRAJECTORY_HPP_ */
@@ -0,0 +1,285 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file TrajectoryExecutor.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Added trajectory point queues as execution inputs
+ * @date Oct 19, 2026 - Executes const trajectories, reading their points in place
+ * @date Oct 19, 2026 - Without a period, waits for queued points instead of spinning through empty ticks
+ *
+ * @brief A real-time executor that releases trajectory points to motor outputs on a periodic timer
+ *
+ * A motion profile trajectory is executed by releasing one trajectory point per iteration
+ * period to the motor output that drives the motion mechanism.  The executor can run several
+ * trajectories at once (for instance, the left and right sides of a TankDrive), releasing the
+ * points with the same step from each trajectory on the same tick.  Ticks are scheduled at
+ * absolute times (a multiple of the iteration period after the start of execution) so that
+ * lateness on one tick does not accumulate into the following ticks.  The wakeup latency of
+ * every tick is recorded, along with counts of the ticks that missed their deadline or overran
+ * their iteration period, so that the timing quality of an execution can be checked.
+ *
+ * Besides whole trajectories, the executor can take its input from trajectory point queues
+ * filled by a producer on another thread (for instance, a trajectory generator).  A queue
+ * that is empty when its point is due is an underrun; nothing is released for that queue on
+ * that tick, and execution continues until every queue has been closed and drained.
+ *
+ */
+#include <thread>
+#include "TrajectoryExecutor.hpp"
+
+TrajectoryExecutor::TrajectoryExecutor()
+    : trajectories(),
+      motorOutputs(),
+      queues(),
+      queueMotorOutputs(),
+      iterationPeriodMS(0),
+      wakeupLatenciesNS(),
+      missedDeadlineCount(0),
+      overrunCount(0) {
+}
+
+TrajectoryExecutor::~TrajectoryExecutor() {
+}
+
+/**
+ * @brief Add a trajectory to be executed, and the motor output to release its points to
+ * @param [in] Trajectory trajectory to execute (must outlive the execution)
+ * @param [in] MotorOutput motorOutput that receives the trajectory's points
+ */
+void TrajectoryExecutor::addTrajectory(const Trajectory &trajectory,
+                                       MotorOutput &motorOutput) {
+  trajectories.push_back(&trajectory);
+  motorOutputs.push_back(&motorOutput);
+  return;
+}
+
+/**
+ * @brief Add a trajectory point queue to be executed, and the motor output to release its points to
+ * @param [in] TrajectoryPointQueue queue to execute (this thread becomes its consumer)
+ * @param [in] MotorOutput motorOutput that receives the queue's points
+ */
+void TrajectoryExecutor::addQueue(TrajectoryPointQueue &queue,
+                                  MotorOutput &motorOutput) {
+  queues.push_back(&queue);
+  queueMotorOutputs.push_back(&motorOutput);
+  return;
+}
+
+/**
+ * @brief Remove all trajectories and queues (and their motor outputs) from the executor
+ */
+void TrajectoryExecutor::clearTrajectories() {
+  trajectories.clear();
+  motorOutputs.clear();
+  queues.clear();
+  queueMotorOutputs.clear();
+  return;
+}
+
+/**
+ * @brief Set the iteration period; if not set, the first trajectory's iteration period is used
+ * @param [in] unsigned int period between ticks in milliseconds
+ */
+void TrajectoryExecutor::setIterationPeriodMS(const unsigned int period) {
+  iterationPeriodMS = period;
+  return;
+}
+
+/**
+ * @brief Get the iteration period set for the executor
+ * @return unsigned int period between ticks in milliseconds (0 if not set)
+ */
+unsigned int TrajectoryExecutor::getIterationPeriodMS() const {
+  return iterationPeriodMS;
+}
+
+/**
+ * @brief Execute the trajectories and queues, releasing one point from each per iteration period
+ *
+ * The iteration period is the one set for the executor, or else is taken
+ * from the first trajectory; all inputs are expected to share it.
+ * Execution lasts as long as the longest trajectory, and until every queue
+ * is closed and drained; an input that has no point for a tick releases
+ * nothing on that tick.  With no iteration period (queues only, and none
+ * set), each tick waits until a queue has a point, and releases it at once.
+ */
+void TrajectoryExecutor::execute() {
+  // Reset the timing statistics from any previous execution
+  wakeupLatenciesNS.clear();
+  missedDeadlineCount = 0;
+  overrunCount = 0;
+  if (trajectories.empty() && queues.empty())
+    return;
+
+  // Determine the iteration period and the number of trajectory ticks
+  unsigned int periodMS = iterationPeriodMS;
+  if (periodMS == 0 && !trajectories.empty())
+    periodMS = trajectories.front()->getAlgoItPMS();
+  const long periodNS = static_cast<long>(periodMS) * 1000000L;
+  unsigned int trajectoryTickCount = 0;
+  for (auto trajectory : trajectories)
+    trajectoryTickCount = std::max(trajectoryTickCount, trajectory->size());
+
+  // Make sure nothing needs to be allocated once execution is under way
+  // (queue inputs of unknown length may still grow the latency record)
+  wakeupLatenciesNS.reserve(trajectoryTickCount);
+  TrajectoryPoint tPoint;
+
+  // Release each tick's points at an absolute time, measured from the start
+  timespec release, wakeup, done;
+  clock_gettime(CLOCK_MONOTONIC, &release);
+  for (unsigned int tick = 0; tick < trajectoryTickCount || !queuesDrained();
+      tick++) {
+    // With no period, ticks run back to back; once the trajectories are done,
+    // each tick waits for a queued point rather than spinning through ticks
+    // that have nothing to release
+    if (periodNS == 0 && tick >= trajectoryTickCount && !waitForQueuedPoint())
+      break;
+
+    // Sleep until this tick's release time (restarting if interrupted)
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &release, nullptr)
+        == EINTR) {
+    }
+    clock_gettime(CLOCK_MONOTONIC, &wakeup);
+    wakeupLatenciesNS.push_back(differenceNS(wakeup, release));
+
+    // Release this tick's point from each trajectory to its motor output
+    for (std::vector<const Trajectory *>::size_type channel = 0;
+        channel < trajectories.size(); channel++) {
+      const std::vector<TrajectoryPoint> &points =
+          trajectories[channel]->getTrajectoryPoints();
+      if (tick < points.size())
+        motorOutputs[channel]->outputTrajectoryPoint(points[tick]);
+    }
+    // and the next point from each queue to its motor output
+    for (std::vector<TrajectoryPointQueue *>::size_type channel = 0;
+        channel < queues.size(); channel++) {
+      if (queues[channel]->pop(tPoint))
+        queueMotorOutputs[channel]->outputTrajectoryPoint(tPoint);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &done);
+
+    // An overrun is a tick whose output took longer than the period; a
+    // missed deadline is a tick delivered after the next tick's release time
+    if (differenceNS(done, wakeup) > periodNS)
+      overrunCount++;
+    addNS(release, periodNS);
+    if (differenceNS(done, release) > 0)
+      missedDeadlineCount++;
+  }
+  return;
+}
+
+/**
+ * @brief Get the number of ticks in the last execution
+ * @return unsigned int count of ticks executed
+ */
+unsigned int TrajectoryExecutor::getTickCount() const {
+  return wakeupLatenciesNS.size();
+}
+
+/**
+ * @brief Get the number of ticks in the last execution delivered after their deadline
+ * @return unsigned int count of missed deadlines
+ */
+unsigned int TrajectoryExecutor::getMissedDeadlineCount() const {
+  return missedDeadlineCount;
+}
+
+/**
+ * @brief Get the number of ticks in the last execution whose output took longer than a period
+ * @return unsigned int count of overruns
+ */
+unsigned int TrajectoryExecutor::getOverrunCount() const {
+  return overrunCount;
+}
+
+/**
+ * @brief Get the largest wakeup latency (time after the release time) in the last execution
+ * @return long maximum wakeup latency in nanoseconds
+ */
+long TrajectoryExecutor::getMaxWakeupLatencyNS() const {
+  if (wakeupLatenciesNS.empty())
+    return 0;
+  return *std::max_element(wakeupLatenciesNS.begin(), wakeupLatenciesNS.end());
+}
+
+/**
+ * @brief Get the mean wakeup latency (time after the release time) in the last execution
+ * @return double mean wakeup latency in nanoseconds
+ */
+double TrajectoryExecutor::getMeanWakeupLatencyNS() const {
+  if (wakeupLatenciesNS.empty())
+    return 0.0;
+  double sum = 0.0;
+  for (auto latency : wakeupLatenciesNS)
+    sum += latency;
+  return sum / wakeupLatenciesNS.size();
+}
+
+/**
+ * @brief Get the wakeup latency of one tick of the last execution
+ * @param [in] unsigned int tick (0 is the first tick)
+ * @param [out] long latencyNS wakeup latency of the tick in nanoseconds
+ * @return bool indication of whether the tick was part of the last execution
+ */
+bool TrajectoryExecutor::getWakeupLatencyNS(const unsigned int tick,
+                                            long &latencyNS) const {
+  if (tick < wakeupLatenciesNS.size()) {
+    latencyNS = wakeupLatenciesNS[tick];
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Private function reporting whether every queue is closed and drained
+ * @return bool indication of whether all queue inputs are finished
+ */
+bool TrajectoryExecutor::queuesDrained() const {
+  for (auto queue : queues)
+    if (!queue->isDrained())
+      return false;
+  return true;
+}
+
+/**
+ * @brief Private function waiting (yielding the processor) until a queue has a point to release
+ * @return bool indication of whether a point is waiting (false if every queue is finished)
+ */
+bool TrajectoryExecutor::waitForQueuedPoint() const {
+  while (!queuesDrained()) {
+    for (auto queue : queues)
+      if (queue->size() > 0)
+        return true;
+    std::this_thread::yield();
+  }
+  return false;
+}
+
+/**
+ * @brief Private function giving the difference between two times in nanoseconds
+ * @param [in] timespec later time
+ * @param [in] timespec earlier time
+ * @return long nanoseconds from the earlier time to the later time
+ */
+long TrajectoryExecutor::differenceNS(const timespec &later,
+                                      const timespec &earlier) {
+  return (later.tv_sec - earlier.tv_sec) * 1000000000L
+      + (later.tv_nsec - earlier.tv_nsec);
+}
+
+/**
+ * @brief Private function advancing a time by a number of nanoseconds
+ * @param [in/out] timespec time to advance
+ * @param [in] long ns nanoseconds to advance the time by
+ */
+void TrajectoryExecutor::addNS(timespec &time, const long ns) {
+  time.tv_nsec += ns;
+  while (time.tv_nsec >= 1000000000L) {
+    time.tv_nsec -= 1000000000L;
+    time.tv_sec++;
+  }
+  return;
+}
@@ -0,0 +1,75 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file TrajectoryExecutor.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Added trajectory point queues as execution inputs
+ * @date Oct 19, 2026 - Executes const trajectories, reading their points in place
+ * @date Oct 19, 2026 - Without a period, waits for queued points instead of spinning through empty ticks
+ *
+ * @brief A real-time executor that releases trajectory points to motor outputs on a periodic timer
+ *
+ * A motion profile trajectory is executed by releasing one trajectory point per iteration
+ * period to the motor output that drives the motion mechanism.  The executor can run several
+ * trajectories at once (for instance, the left and right sides of a TankDrive), releasing the
+ * points with the same step from each trajectory on the same tick.  Ticks are scheduled at
+ * absolute times (a multiple of the iteration period after the start of execution) so that
+ * lateness on one tick does not accumulate into the following ticks.  The wakeup latency of
+ * every tick is recorded, along with counts of the ticks that missed their deadline or overran
+ * their iteration period, so that the timing quality of an execution can be checked.
+ *
+ * Besides whole trajectories, the executor can take its input from trajectory point queues
+ * filled by a producer on another thread (for instance, a trajectory generator).  A queue
+ * that is empty when its point is due is an underrun; nothing is released for that queue on
+ * that tick, and execution continues until every queue has been closed and drained.
+ *
+ */
+#ifndef TRAJECTORYEXECUTOR_HPP_
+#define TRAJECTORYEXECUTOR_HPP_
+
+#include <time.h>
+#include <algorithm>
+#include <cerrno>
+#include <vector>
+#include "MotorOutput.hpp"
+#include "Trajectory.hpp"
+#include "TrajectoryPointQueue.hpp"
+#include "TrajectoryPoint.hpp"
+
+/** @brief Releases trajectory points to motor outputs on an absolute-deadline periodic timer
+ */
+
+class TrajectoryExecutor {
+ public:
+  TrajectoryExecutor();
+  virtual ~TrajectoryExecutor();
+  void addTrajectory(const Trajectory &trajectory, MotorOutput &motorOutput);
+  void addQueue(TrajectoryPointQueue &queue, MotorOutput &motorOutput);
+  void clearTrajectories();
+  void setIterationPeriodMS(const unsigned int period);
+  unsigned int getIterationPeriodMS() const;
+  void execute();
+  unsigned int getTickCount() const;
+  unsigned int getMissedDeadlineCount() const;
+  unsigned int getOverrunCount() const;
+  long getMaxWakeupLatencyNS() const;
+  double getMeanWakeupLatencyNS() const;
+  bool getWakeupLatencyNS(const unsigned int tick, long &latencyNS) const;
+
+ private:
+  bool queuesDrained() const;
+  bool waitForQueuedPoint() const;
+  static long differenceNS(const timespec &later, const timespec &earlier);
+  static void addNS(timespec &time, const long ns);
+  std::vector<const Trajectory *> trajectories;  // trajectories being executed
+  std::vector<MotorOutput *> motorOutputs;       // output for each trajectory
+  std::vector<TrajectoryPointQueue *> queues;    // queues being executed
+  std::vector<MotorOutput *> queueMotorOutputs;  // output for each queue
+  unsigned int iterationPeriodMS;    // period between ticks
+  std::vector<long> wakeupLatenciesNS;       // wakeup latency of each tick
+  unsigned int missedDeadlineCount;  // ticks delivered after the next tick
+  unsigned int overrunCount;         // ticks whose output took over a period
+};
+
+#endif /* TRAJECTORYEXECUTOR_HPP_ */
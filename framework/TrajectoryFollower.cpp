@@ -0,0 +1,247 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file TrajectoryFollower.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Tick costs can be timed by a substitute clock
+ *
+ * @brief A feedforward plus PID control law for following a trajectory
+ *
+ * Each iteration period, the follower turns the trajectory point due on that tick and the
+ * measured motor position into a motor command.  The command is velocity and acceleration
+ * feedforward from the trajectory point, plus PID feedback on the position error.  The
+ * command's units are set by the gains (for instance, RPM for a velocity controlled motor, or
+ * a fraction of full voltage).  The integral and derivative gains are scaled by the iteration
+ * period once, when the gains or period are set, so each tick is a handful of multiplies and
+ * adds with no allocation.
+ *
+ * A per-tick cost budget can be set; when it is, every tick times itself, and the worst tick
+ * cost and the number of ticks that exceeded the budget are recorded.  Ticks are timed with
+ * the monotonic clock, unless another clock is substituted (for instance, a simulated clock
+ * in a test).
+ *
+ */
+#include <algorithm>
+#include "TrajectoryFollower.hpp"
+
+TrajectoryFollower::TrajectoryFollower()
+    : feedforwardVelocityGain(0.0),
+      feedforwardAccelerationGain(0.0),
+      proportionalGain(0.0),
+      integralGain(0.0),
+      derivativeGain(0.0),
+      iterationPeriodMS(10),
+      integralGainPerTick(0.0),
+      derivativeGainPerTick(0.0),
+      outputLimit(0.0),
+      integralLimit(0.0),
+      tickBudgetNS(0),
+      clockNS(monotonicNS),
+      errorSum(0.0),
+      lastError(0.0),
+      firstTick(true),
+      tickCount(0),
+      worstTickNS(0),
+      budgetOverrunCount(0) {
+}
+
+TrajectoryFollower::~TrajectoryFollower() {
+}
+
+/**
+ * @brief Set the feedforward gains applied to the trajectory point's velocity and acceleration
+ * @param [in] double kV command per RPM of trajectory velocity
+ * @param [in] double kA command per RPM/s of trajectory acceleration
+ */
+void TrajectoryFollower::setFeedforwardGains(const double kV,
+                                             const double kA) {
+  feedforwardVelocityGain = kV;
+  feedforwardAccelerationGain = kA;
+  return;
+}
+
+/**
+ * @brief Set the PID gains applied to the position error (trajectory less measured position)
+ * @param [in] double kP command per rotation of error
+ * @param [in] double kI command per rotation-second of accumulated error
+ * @param [in] double kD command per rotation per second of error change
+ */
+void TrajectoryFollower::setPIDGains(const double kP, const double kI,
+                                     const double kD) {
+  proportionalGain = kP;
+  integralGain = kI;
+  derivativeGain = kD;
+  precomputeGains();
+  return;
+}
+
+/**
+ * @brief Set the period between calculations, which scales the integral and derivative gains
+ * @param [in] unsigned int period in milliseconds
+ */
+void TrajectoryFollower::setIterationPeriodMS(const unsigned int period) {
+  iterationPeriodMS = period;
+  precomputeGains();
+  return;
+}
+
+/**
+ * @brief Get the period between calculations
+ * @return unsigned int period in milliseconds
+ */
+unsigned int TrajectoryFollower::getIterationPeriodMS() const {
+  return iterationPeriodMS;
+}
+
+/**
+ * @brief Limit the magnitude of the command
+ * @param [in] double limit on the command magnitude (0 for no limit)
+ */
+void TrajectoryFollower::setOutputLimit(const double limit) {
+  outputLimit = limit;
+  return;
+}
+
+/**
+ * @brief Limit the magnitude of the accumulated error, to prevent integral windup
+ * @param [in] double limit in rotation-ticks of accumulated error (0 for no limit)
+ */
+void TrajectoryFollower::setIntegralLimit(const double limit) {
+  integralLimit = limit;
+  return;
+}
+
+/**
+ * @brief Set the per-tick cost budget; ticks are timed only while a budget is set
+ * @param [in] unsigned int budget in microseconds (0 to stop timing ticks)
+ */
+void TrajectoryFollower::setTickBudgetUS(const unsigned int budget) {
+  tickBudgetNS = static_cast<long>(budget) * 1000;
+  return;
+}
+
+/**
+ * @brief Get the per-tick cost budget
+ * @return unsigned int budget in microseconds (0 when ticks are not timed)
+ */
+unsigned int TrajectoryFollower::getTickBudgetUS() const {
+  return tickBudgetNS / 1000;
+}
+
+/**
+ * @brief Set the clock that ticks are timed with
+ * @param [in] ClockNS clock giving the current time in nanoseconds (nullptr for the monotonic clock)
+ */
+void TrajectoryFollower::setClock(const ClockNS clock) {
+  clockNS = clock ? clock : monotonicNS;
+  return;
+}
+
+/**
+ * @brief Clear the accumulated error and tick statistics, ready to follow a new trajectory
+ */
+void TrajectoryFollower::reset() {
+  errorSum = 0.0;
+  lastError = 0.0;
+  firstTick = true;
+  tickCount = 0;
+  worstTickNS = 0;
+  budgetOverrunCount = 0;
+  return;
+}
+
+/**
+ * @brief Calculate the motor command for one tick
+ * @param [in] TrajectoryPoint setpoint due on this tick
+ * @param [in] MotorPosition measuredPosition of the motor
+ * @return double motor command
+ */
+double TrajectoryFollower::calculate(const TrajectoryPoint &setpoint,
+                                     const MotorPosition &measuredPosition) {
+  const long startNS = (tickBudgetNS > 0) ? clockNS() : 0;
+
+  // Feedforward from the trajectory point's velocity and acceleration
+  double command = feedforwardVelocityGain
+      * setpoint.getVelocity().getRotationsPerMinute()
+      + feedforwardAccelerationGain
+          * setpoint.getAcceleration().getRotationsPerMinutePerSecond();
+
+  // PID feedback on the position error; the derivative starts at zero
+  // rather than kicking on the first tick
+  double error = setpoint.getPosition().getRotations()
+      - measuredPosition.getRotations();
+  errorSum += error;
+  if (integralLimit > 0)
+    errorSum = std::max(-integralLimit, std::min(errorSum, integralLimit));
+  double errorChange = firstTick ? 0.0 : error - lastError;
+  command += proportionalGain * error + integralGainPerTick * errorSum
+      + derivativeGainPerTick * errorChange;
+  if (outputLimit > 0)
+    command = std::max(-outputLimit, std::min(command, outputLimit));
+  lastError = error;
+  firstTick = false;
+  tickCount++;
+
+  // Check the cost of this tick against the budget
+  if (tickBudgetNS > 0) {
+    const long tickNS = clockNS() - startNS;
+    worstTickNS = std::max(worstTickNS, tickNS);
+    if (tickNS > tickBudgetNS)
+      budgetOverrunCount++;
+  }
+  return command;
+}
+
+/**
+ * @brief Get the position error of the last tick
+ * @return double error in rotations (trajectory less measured position)
+ */
+double TrajectoryFollower::getLastError() const {
+  return lastError;
+}
+
+/**
+ * @brief Get the number of ticks calculated since the last reset
+ * @return unsigned long tick count
+ */
+unsigned long TrajectoryFollower::getTickCount() const {
+  return tickCount;
+}
+
+/**
+ * @brief Get the cost of the most expensive timed tick since the last reset
+ * @return long worst tick cost in nanoseconds
+ */
+long TrajectoryFollower::getWorstTickNS() const {
+  return worstTickNS;
+}
+
+/**
+ * @brief Get the number of timed ticks that exceeded the budget since the last reset
+ * @return unsigned long budget overrun count
+ */
+unsigned long TrajectoryFollower::getBudgetOverrunCount() const {
+  return budgetOverrunCount;
+}
+
+/**
+ * @brief Scale the integral and derivative gains by the iteration period
+ */
+void TrajectoryFollower::precomputeGains() {
+  const double periodS = iterationPeriodMS / 1000.0;
+  integralGainPerTick = integralGain * periodS;
+  derivativeGainPerTick = periodS > 0 ? derivativeGain / periodS : 0.0;
+  return;
+}
+
+/**
+ * @brief Private function giving the time of the monotonic clock
+ * @return long current time in nanoseconds
+ */
+long TrajectoryFollower::monotonicNS() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1000000000L + now.tv_nsec;
+}
@@ -0,0 +1,83 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file TrajectoryFollower.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ * @date Oct 19, 2026 - Tick costs can be timed by a substitute clock
+ *
+ * @brief A feedforward plus PID control law for following a trajectory
+ *
+ * Each iteration period, the follower turns the trajectory point due on that tick and the
+ * measured motor position into a motor command.  The command is velocity and acceleration
+ * feedforward from the trajectory point, plus PID feedback on the position error.  The
+ * command's units are set by the gains (for instance, RPM for a velocity controlled motor, or
+ * a fraction of full voltage).  The integral and derivative gains are scaled by the iteration
+ * period once, when the gains or period are set, so each tick is a handful of multiplies and
+ * adds with no allocation.
+ *
+ * A per-tick cost budget can be set; when it is, every tick times itself, and the worst tick
+ * cost and the number of ticks that exceeded the budget are recorded.  Ticks are timed with
+ * the monotonic clock, unless another clock is substituted (for instance, a simulated clock
+ * in a test).
+ *
+ */
+#ifndef TRAJECTORYFOLLOWER_HPP_
+#define TRAJECTORYFOLLOWER_HPP_
+
+#include <time.h>
+#include "MotorPosition.hpp"
+#include "TrajectoryPoint.hpp"
+
+/** @brief Combines trajectory feedforward with PID feedback on position error
+ */
+
+class TrajectoryFollower {
+ public:
+  // A clock giving the current time in nanoseconds
+  typedef long (*ClockNS)();
+
+  TrajectoryFollower();
+  virtual ~TrajectoryFollower();
+  void setFeedforwardGains(const double kV, const double kA);
+  void setPIDGains(const double kP, const double kI, const double kD);
+  void setIterationPeriodMS(const unsigned int period);
+  unsigned int getIterationPeriodMS() const;
+  void setOutputLimit(const double limit);
+  void setIntegralLimit(const double limit);
+  void setTickBudgetUS(const unsigned int budget);
+  unsigned int getTickBudgetUS() const;
+  void setClock(const ClockNS clock);
+  void reset();
+  double calculate(const TrajectoryPoint &setpoint,
+                   const MotorPosition &measuredPosition);
+  double getLastError() const;
+  unsigned long getTickCount() const;
+  long getWorstTickNS() const;
+  unsigned long getBudgetOverrunCount() const;
+
+ private:
+  void precomputeGains();
+  static long monotonicNS();
+  double feedforwardVelocityGain;      // command per RPM
+  double feedforwardAccelerationGain;  // command per RPM/s
+  double proportionalGain;             // command per rotation of error
+  double integralGain;                 // command per rotation-second
+  double derivativeGain;               // command per rotation per second
+  unsigned int iterationPeriodMS;
+  double integralGainPerTick;          // integral gain times the period
+  double derivativeGainPerTick;        // derivative gain over the period
+  double outputLimit;                  // command magnitude limit (0 for none)
+  double integralLimit;                // error sum magnitude limit (0 for none)
+  long tickBudgetNS;                   // tick cost budget (0 for untimed)
+  ClockNS clockNS;                     // clock the ticks are timed with
+  double errorSum;
+  double lastError;
+  bool firstTick;
+  unsigned long tickCount;
+  long worstTickNS;
+  unsigned long budgetOverrunCount;
+};
+
+#endif /* TRAJECTORYFOLLOWER_HPP_ */
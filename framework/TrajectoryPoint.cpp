@@ -6,6 +6,8 @@
  * @date Mar 5, 2017 - Creation
  * @date Mar 9, 2017 - Updates to support trajectory generation changes in Trajectory class
  * @date Mar 11, 2017 - Updates to track algorithm details for model comparison
+ * @date Oct 19, 2026 - Added scaleMotion to support derived trajectories
+ * @date Oct 19, 2026 - Made const-correct
  *
  * @brief A motion profile trajectory point - position, velocity, duration
  *
@@ -47,7 +49,7 @@ void TrajectoryPoint::setPosition(const MotorPosition &pos) {
  * @brief Get the position for this trajectory point
  * @return a MotorPosition representing this trajectory points position
  */
-MotorPosition TrajectoryPoint::getPosition() {
+MotorPosition TrajectoryPoint::getPosition() const {
   return position;
 }
 
@@ -64,7 +66,7 @@ void TrajectoryPoint::setVelocity(const MotorVelocity &vel) {
  * @brief Get the velocity for this trajectory point
  * @return a MotorVelocity representing this trajectory points velocity
  */
-MotorVelocity TrajectoryPoint::getVelocity() {
+MotorVelocity TrajectoryPoint::getVelocity() const {
   return velocity;
 }
 
@@ -81,7 +83,7 @@ void TrajectoryPoint::setAcceleration(const MotorAcceleration &accel) {
  * @brief Get the acceleration for this trajectory point
  * @return a MotorAcceleration representing this trajectory points acceleration
  */
-MotorAcceleration TrajectoryPoint::getAcceleration() {
+MotorAcceleration TrajectoryPoint::getAcceleration() const {
   return acceleration;
 }
 
@@ -98,7 +100,7 @@ void TrajectoryPoint::setDurationMS(const unsigned int duration) {
  * @brief Get the duration for this trajectory point in milliseconds
  * @return int duration in milliseconds
  */
-unsigned int TrajectoryPoint::getDurationMS() {
+unsigned int TrajectoryPoint::getDurationMS() const {
   return durationMS;
 }
 
@@ -115,7 +117,7 @@ void TrajectoryPoint::setStep(const unsigned int stepCount) {
  * @brief Get the step count for this trajectory point
  * @return unsigned int step count
  */
-unsigned int TrajectoryPoint::getStep() {
+unsigned int TrajectoryPoint::getStep() const {
   return step;
 }
 
@@ -132,7 +134,7 @@ void TrajectoryPoint::setTimeS(const double time) {
  * @brief Get the relative time for this trajectory point in seconds
  * @return double relative time in seconds
  */
-double TrajectoryPoint::getTimeS() {
+double TrajectoryPoint::getTimeS() const {
   return timeS;
 }
 
@@ -149,7 +151,7 @@ void TrajectoryPoint::setFilter1Sum(const double sum) {
  * @brief Get the Filter 1 sum for this trajectory point
  * @return double sum value for the Filter 1 sum
  */
-double TrajectoryPoint::getFilter1Sum() {
+double TrajectoryPoint::getFilter1Sum() const {
   return filter1Sum;
 }
 
@@ -166,15 +168,27 @@ void TrajectoryPoint::setFilter2Sum(const double sum) {
  * @brief Get the Filter 2 sum for this trajectory point
  * @return double sum value for the Filter 2 sum
  */
-double TrajectoryPoint::getFilter2Sum() {
+double TrajectoryPoint::getFilter2Sum() const {
   return filter2Sum;
 }
 
+/**
+ * @brief Scale the position, velocity, and acceleration of this trajectory point
+ * @param [in] double scaleFactor to apply to the trajectory point's motion
+ */
+void TrajectoryPoint::scaleMotion(const double scaleFactor) {
+  position.setRotations(position.getRotations() * scaleFactor);
+  velocity.setRotationsPerMinute(velocity.getRotationsPerMinute() * scaleFactor);
+  acceleration.setRotationsPerMinutePerSecond(
+      acceleration.getRotationsPerMinutePerSecond() * scaleFactor);
+  return;
+}
+
 /**
  * @brief Show the trajectory point on standard output
  */
 
-void TrajectoryPoint::show() {
+void TrajectoryPoint::show() const {
   std::cout << "Position: " << position.getRotations()
             << " rotations; " << "Velocity: "
             << velocity.getRotationsPerMinute() << " RPM; "
@@ -185,7 +199,7 @@ void TrajectoryPoint::show() {
 /**
  * @brief Output the trajectory point header to a comma-separated value file
  */
-void TrajectoryPoint::outputCSVheader(std::ofstream& fileCSV) {
+void TrajectoryPoint::outputCSVheader(std::ofstream& fileCSV) const {
   fileCSV << "Step" "," << "Time(s)" << "," << "Filter1 sum" << ","
           << "Filter2 sum" << "," << "Vel(RPS)" << "," << "Pos(R)" << ","
           << "Accel(RPS/S)" << "," << "Dur(ms)" << std::endl;
@@ -194,7 +208,7 @@ void TrajectoryPoint::outputCSVheader(std::ofstream& fileCSV) {
 /**
  * @brief Output the trajectory point to a comma-separated value file
  */
-void TrajectoryPoint::outputCSV(std::ofstream& fileCSV) {
+void TrajectoryPoint::outputCSV(std::ofstream& fileCSV) const {
   fileCSV << step << "," << timeS << "," << filter1Sum << "," << filter2Sum
           << "," << velocity.getRotationsPerMinute() / 60 << ","
           << position.getRotations() << ","
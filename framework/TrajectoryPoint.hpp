@@ -6,6 +6,8 @@
  * @date Mar 5, 2017 - Creation
  * @date Mar 9, 2017 - Updates to support trajectory generation changes in Trajectory class
  * @date Mar 11, 2017 - Updates to track algorithm details for model comparison
+ * @date Oct 19, 2026 - Added scaleMotion to support derived trajectories
+ * @date Oct 19, 2026 - Made const-correct
  *
  * @brief A motion profile trajectory point - position, velocity, duration
  *
@@ -36,24 +38,25 @@ class TrajectoryPoint : public Point {
   TrajectoryPoint();
   virtual ~TrajectoryPoint();
   void setPosition(const MotorPosition &pos);
-  MotorPosition getPosition();
+  MotorPosition getPosition() const;
   void setVelocity(const MotorVelocity &vel);
-  MotorVelocity getVelocity();
+  MotorVelocity getVelocity() const;
   void setAcceleration(const MotorAcceleration &accel);
-  MotorAcceleration getAcceleration();
+  MotorAcceleration getAcceleration() const;
   void setDurationMS(const unsigned int duration);
-  unsigned int getDurationMS();
+  unsigned int getDurationMS() const;
   void setStep(const unsigned int stepCount);
-  unsigned int getStep();
+  unsigned int getStep() const;
   void setTimeS(const double time);
-  double getTimeS();
+  double getTimeS() const;
   void setFilter1Sum(const double sum);
-  double getFilter1Sum();
+  double getFilter1Sum() const;
   void setFilter2Sum(const double sum);
-  double getFilter2Sum();
-  void show();
-  void outputCSV(std::ofstream& fileCSV);
-  void outputCSVheader(std::ofstream& fileCSV);
+  double getFilter2Sum() const;
+  void scaleMotion(const double scaleFactor);
+  void show() const;
+  void outputCSV(std::ofstream& fileCSV) const;
+  void outputCSVheader(std::ofstream& fileCSV) const;
 
  private:
   MotorPosition position;
@@ -0,0 +1,141 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file TrajectoryPointQueue.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief A wait-free single-producer/single-consumer queue of trajectory points
+ *
+ * When trajectory points are generated on one thread and executed on another, they are
+ * handed across through this fixed-capacity ring buffer.  Exactly one thread may push
+ * points and exactly one thread may pop them; neither ever blocks or waits for the other,
+ * a push into a full queue or a pop from an empty queue simply fails.  The producer and
+ * consumer indices are kept on separate cache lines so the two threads do not contend for
+ * the same cache line.  The queue keeps an underrun count (pops that found the queue empty
+ * before the producer closed it) and a high-water mark (the most points ever waiting) so
+ * that the sizing of the queue can be checked.
+ *
+ */
+#include "TrajectoryPointQueue.hpp"
+
+/**
+ * @brief Private function rounding a capacity up to the next power of two
+ * @param [in] std::size_t minimumCapacity requested
+ * @return std::size_t the smallest power of two not less than the requested capacity
+ */
+static std::size_t roundUpToPowerOfTwo(const std::size_t minimumCapacity) {
+  std::size_t capacity = 1;
+  while (capacity < minimumCapacity)
+    capacity <<= 1;
+  return capacity;
+}
+
+TrajectoryPointQueue::TrajectoryPointQueue(const std::size_t minimumCapacity)
+    : slots(roundUpToPowerOfTwo(minimumCapacity)),
+      indexMask(slots.size() - 1),
+      tailIndex(0),
+      closed(false),
+      highWaterMark(0),
+      headIndex(0),
+      underrunCount(0) {
+}
+
+TrajectoryPointQueue::~TrajectoryPointQueue() {
+}
+
+/**
+ * @brief Get the number of trajectory points the queue can hold
+ * @return std::size_t queue capacity
+ */
+std::size_t TrajectoryPointQueue::capacity() const {
+  return slots.size();
+}
+
+/**
+ * @brief Get the number of trajectory points waiting in the queue
+ * @return std::size_t number of points waiting (a snapshot if the other thread is active)
+ */
+std::size_t TrajectoryPointQueue::size() const {
+  return tailIndex.load(std::memory_order_acquire)
+      - headIndex.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Push a trajectory point onto the queue (producer thread only)
+ * @param [in] TrajectoryPoint trajectoryPoint to push
+ * @return bool indication of whether there was room for the point
+ */
+bool TrajectoryPointQueue::push(const TrajectoryPoint &trajectoryPoint) {
+  const std::size_t tail = tailIndex.load(std::memory_order_relaxed);
+  const std::size_t head = headIndex.load(std::memory_order_acquire);
+  if (tail - head == slots.size())
+    return false;
+  slots[tail & indexMask] = trajectoryPoint;
+  tailIndex.store(tail + 1, std::memory_order_release);
+  if (tail + 1 - head > highWaterMark)
+    highWaterMark = tail + 1 - head;
+  return true;
+}
+
+/**
+ * @brief Mark the queue closed; the producer will push no more points (producer thread only)
+ */
+void TrajectoryPointQueue::close() {
+  closed.store(true, std::memory_order_release);
+  return;
+}
+
+/**
+ * @brief Pop the oldest trajectory point from the queue (consumer thread only)
+ * @param [out] TrajectoryPoint trajectoryPoint set equal to the oldest point on the queue
+ * @return bool indication of whether a point was available
+ */
+bool TrajectoryPointQueue::pop(TrajectoryPoint &trajectoryPoint) {
+  const std::size_t head = headIndex.load(std::memory_order_relaxed);
+  if (head == tailIndex.load(std::memory_order_acquire)) {
+    // An empty queue is only an underrun if more points are still to come
+    if (!closed.load(std::memory_order_acquire))
+      underrunCount++;
+    return false;
+  }
+  trajectoryPoint = slots[head & indexMask];
+  headIndex.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+/**
+ * @brief Report whether the producer has closed the queue
+ * @return bool indication of whether the queue is closed
+ */
+bool TrajectoryPointQueue::isClosed() const {
+  return closed.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Report whether the queue is closed and every point has been popped (consumer thread)
+ * @return bool indication of whether the queue is closed and empty
+ */
+bool TrajectoryPointQueue::isDrained() const {
+  // Check closed first, so a point pushed just before closing is not missed
+  return closed.load(std::memory_order_acquire)
+      && headIndex.load(std::memory_order_relaxed)
+          == tailIndex.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Get the number of pops that found the queue empty before it was closed
+ * @return std::size_t count of underruns (read from the consumer thread, or once both are done)
+ */
+std::size_t TrajectoryPointQueue::getUnderrunCount() const {
+  return underrunCount;
+}
+
+/**
+ * @brief Get the largest number of points that have been waiting in the queue
+ * @return std::size_t high-water mark (read from the producer thread, or once both are done)
+ */
+std::size_t TrajectoryPointQueue::getHighWaterMark() const {
+  return highWaterMark;
+}
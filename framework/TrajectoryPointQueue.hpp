@@ -0,0 +1,62 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file TrajectoryPointQueue.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Made const-correct
+ *
+ * @brief A wait-free single-producer/single-consumer queue of trajectory points
+ *
+ * When trajectory points are generated on one thread and executed on another, they are
+ * handed across through this fixed-capacity ring buffer.  Exactly one thread may push
+ * points and exactly one thread may pop them; neither ever blocks or waits for the other,
+ * a push into a full queue or a pop from an empty queue simply fails.  The producer and
+ * consumer indices are kept on separate cache lines so the two threads do not contend for
+ * the same cache line.  The queue keeps an underrun count (pops that found the queue empty
+ * before the producer closed it) and a high-water mark (the most points ever waiting) so
+ * that the sizing of the queue can be checked.
+ *
+ */
+#ifndef TRAJECTORYPOINTQUEUE_HPP_
+#define TRAJECTORYPOINTQUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include "TrajectoryPoint.hpp"
+
+/** @brief A wait-free single-producer/single-consumer ring buffer of trajectory points
+ */
+
+class TrajectoryPointQueue {
+ public:
+  explicit TrajectoryPointQueue(const std::size_t minimumCapacity);
+  virtual ~TrajectoryPointQueue();
+  TrajectoryPointQueue(const TrajectoryPointQueue &) = delete;
+  TrajectoryPointQueue &operator=(const TrajectoryPointQueue &) = delete;
+  std::size_t capacity() const;
+  std::size_t size() const;
+  bool push(const TrajectoryPoint &trajectoryPoint);
+  void close();
+  bool pop(TrajectoryPoint &trajectoryPoint);
+  bool isClosed() const;
+  bool isDrained() const;
+  std::size_t getUnderrunCount() const;
+  std::size_t getHighWaterMark() const;
+
+ private:
+  static const std::size_t cacheLineSize = 64;
+
+  std::vector<TrajectoryPoint> slots;  // ring storage, a power of two in size
+  const std::size_t indexMask;         // wraps an index onto the ring storage
+  // Producer-owned: the next slot to push into, and the producer's metrics
+  alignas(cacheLineSize) std::atomic<std::size_t> tailIndex;
+  std::atomic<bool> closed;
+  std::size_t highWaterMark;
+  // Consumer-owned: the next slot to pop from, and the consumer's metrics
+  alignas(cacheLineSize) std::atomic<std::size_t> headIndex;
+  std::size_t underrunCount;
+};
+
+#endif /* TRAJECTORYPOINTQUEUE_HPP_ */
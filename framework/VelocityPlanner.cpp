@@ -0,0 +1,219 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file VelocityPlanner.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief Plans the fastest feasible velocity at each point of a dense path
+ *
+ * The velocity planner replaces the single maximum velocity given to every point of a path
+ * with the fastest velocity the chassis can have at that point.  Each point is first limited
+ * by its own maximum velocity, by the curvature of the path there (turning at a velocity v on
+ * a curve of curvature k takes a lateral acceleration of v * v * k, which may not exceed the
+ * chassis's maximum lateral acceleration), and by any speed zones covering it.  Then a forward
+ * pass from the start (at rest) lowers each limit to what the chassis can accelerate to from
+ * the point before it, and a backward pass from the end (at rest) lowers it to what the
+ * chassis can still stop from, each at the points' maximum acceleration.  The result is the
+ * time-optimal velocity profile within those limits, found in time linear in the number of
+ * points, and is stored back into the path points' maximum velocities.
+ *
+ * The limits are applied at the path points only, so the path should be dense enough that
+ * its curvature and speed zones are well sampled.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "VelocityPlanner.hpp"
+
+VelocityPlanner::VelocityPlanner()
+    : maxLateralAcceleration(),
+      speedZones() {
+}
+
+VelocityPlanner::~VelocityPlanner() {
+}
+
+/**
+ * @brief Set the largest lateral (turning) acceleration the chassis may have
+ * @param [in] ChassisAcceleration lateralAcceleration limit (0 for no curvature limit)
+ */
+void VelocityPlanner::setMaxLateralAcceleration(
+    const ChassisAcceleration &lateralAcceleration) {
+  maxLateralAcceleration = lateralAcceleration;
+  return;
+}
+
+/**
+ * @brief Get the largest lateral (turning) acceleration the chassis may have
+ * @return ChassisAcceleration lateral acceleration limit (0 for no curvature limit)
+ */
+ChassisAcceleration VelocityPlanner::getMaxLateralAcceleration() const {
+  return maxLateralAcceleration;
+}
+
+/**
+ * @brief Cap the velocity over a stretch of the path
+ * @param [in] double startFeet - distance along the path where the zone starts
+ * @param [in] double endFeet - distance along the path where the zone ends
+ * @param [in] ChassisVelocity maxVelocity within the zone
+ */
+void VelocityPlanner::addSpeedZone(const double startFeet,
+                                   const double endFeet,
+                                   const ChassisVelocity &maxVelocity) {
+  speedZones.push_back(
+      SpeedZone { std::min(startFeet, endFeet), std::max(startFeet, endFeet),
+          maxVelocity });
+  return;
+}
+
+/**
+ * @brief Get the number of speed zones
+ * @return unsigned int count of speed zones
+ */
+unsigned int VelocityPlanner::getSpeedZoneCount() const {
+  return speedZones.size();
+}
+
+/**
+ * @brief Remove all speed zones
+ */
+void VelocityPlanner::clearSpeedZones() {
+  speedZones.clear();
+  return;
+}
+
+/**
+ * @brief Plan the fastest feasible velocity at each point of a path, starting and ending at rest
+ * @param [in/out] Path path whose points' maximum velocities are limited (their maximum
+ * velocities and accelerations on entry are the limits the profile stays within)
+ * @param [in] vector of double curvaturePerFoot of the path at each point (1 / turn radius in
+ * feet, of either sign), or empty for a straight path
+ * @param [in] double motorRotPerMovementFoot for converting distances and velocities in feet
+ * @return bool indication of whether the velocities were planned (false if the curvatures do
+ * not match the path points, or the conversion factor is not positive)
+ */
+bool VelocityPlanner::plan(Path &path,
+                           const std::vector<double> &curvaturePerFoot,
+                           const double motorRotPerMovementFoot) const {
+  if (motorRotPerMovementFoot <= 0
+      || (!curvaturePerFoot.empty() && curvaturePerFoot.size() != path.size()))
+    return false;
+  if (path.size() == 0)
+    return true;
+
+  // The profile is planned in motor units (rotations, rotations per second),
+  // so the limits given in feet are converted to them
+  const double lateralFPSS = maxLateralAcceleration.getFeetPerSecondPerSecond();
+  double previousRPS = 0.0;
+  for (unsigned int i = 0; i < path.size(); i++) {
+    PathPoint &pathPoint = path[i];
+    double limitRPS = pathPoint.getMaxVelocity().getRotationsPerSecond();
+
+    // Curvature and speed zone limits
+    if (!curvaturePerFoot.empty() && lateralFPSS > 0
+        && curvaturePerFoot[i] != 0)
+      limitRPS = std::min(limitRPS, std::sqrt(lateralFPSS
+          / std::fabs(curvaturePerFoot[i])) * motorRotPerMovementFoot);
+    const double distanceFeet = pathPoint.getPosition().getRotations()
+        / motorRotPerMovementFoot;
+    for (const auto &speedZone : speedZones)
+      if (distanceFeet >= speedZone.startFeet
+          && distanceFeet <= speedZone.endFeet)
+        limitRPS = std::min(limitRPS, speedZone.maxVelocity.getFeetPerSecond()
+            * motorRotPerMovementFoot);
+
+    // Forward pass: no faster than the chassis can accelerate to from the
+    // previous point (v * v = u * u + 2 * a * s)
+    if (i == 0) {
+      limitRPS = 0.0;
+    } else {
+      const PathPoint &previousPoint = path[i - 1];
+      const double distanceRotations = std::fabs(
+          pathPoint.getPosition().getRotations()
+              - previousPoint.getPosition().getRotations());
+      limitRPS = std::min(limitRPS, std::sqrt(previousRPS * previousRPS
+          + 2 * previousPoint.getMaxAcceleration()
+              .getRotationsPerSecondPerSecond() * distanceRotations));
+    }
+    limitRPS = std::max(limitRPS, 0.0);
+    pathPoint.setMaxVelocity(MotorVelocity::fromRotationsPerSecond(limitRPS));
+    previousRPS = limitRPS;
+  }
+
+  // Backward pass: no faster than the chassis can still slow down from
+  // before the next point
+  double nextRPS = 0.0;
+  for (unsigned int i = path.size(); i-- > 0;) {
+    PathPoint &pathPoint = path[i];
+    double limitRPS = pathPoint.getMaxVelocity().getRotationsPerSecond();
+    if (i == path.size() - 1) {
+      limitRPS = 0.0;
+    } else {
+      const double distanceRotations = std::fabs(
+          path[i + 1].getPosition().getRotations()
+              - pathPoint.getPosition().getRotations());
+      limitRPS = std::min(limitRPS, std::sqrt(nextRPS * nextRPS
+          + 2 * pathPoint.getMaxAcceleration().getRotationsPerSecondPerSecond()
+              * distanceRotations));
+    }
+    pathPoint.setMaxVelocity(MotorVelocity::fromRotationsPerSecond(limitRPS));
+    nextRPS = limitRPS;
+  }
+  return true;
+}
+
+/**
+ * @brief Estimate the curvature of a path at each of its points from their positions
+ * @param [in] vector of double xFeet - forward position of each point
+ * @param [in] vector of double yFeet - rightward position of each point
+ * @param [out] vector of double curvaturePerFoot at each point (1 / radius in feet of the
+ * circle through it and its neighbors; positive turning right, 0 where straight)
+ */
+void VelocityPlanner::estimateCurvature(const std::vector<double> &xFeet,
+                                        const std::vector<double> &yFeet,
+                                        std::vector<double> &curvaturePerFoot) {
+  const std::vector<double>::size_type count = std::min(xFeet.size(),
+                                                        yFeet.size());
+  curvaturePerFoot.assign(count, 0.0);
+  if (count < 3)
+    return;
+  for (std::vector<double>::size_type i = 1; i + 1 < count; i++) {
+    const double ax = xFeet[i] - xFeet[i - 1], ay = yFeet[i] - yFeet[i - 1];
+    const double bx = xFeet[i + 1] - xFeet[i], by = yFeet[i + 1] - yFeet[i];
+    const double cx = xFeet[i + 1] - xFeet[i - 1];
+    const double cy = yFeet[i + 1] - yFeet[i - 1];
+    const double sides = std::sqrt((ax * ax + ay * ay) * (bx * bx + by * by)
+        * (cx * cx + cy * cy));
+    // The circle through three points has curvature 4 * area / (a * b * c)
+    if (sides > 0)
+      curvaturePerFoot[i] = 2 * (ax * by - ay * bx) / sides;
+  }
+  curvaturePerFoot.front() = curvaturePerFoot[1];
+  curvaturePerFoot.back() = curvaturePerFoot[count - 2];
+  return;
+}
+
+/**
+ * @brief Time to travel a path at its points' maximum velocities, accelerating evenly between
+ * @param [in] Path path to travel
+ * @return double time in seconds (infinite if the path moves between two points at rest)
+ */
+double VelocityPlanner::profileTimeSeconds(const Path &path) {
+  double timeSeconds = 0.0;
+  for (unsigned int i = 1; i < path.size(); i++) {
+    const double distanceRotations = std::fabs(
+        path[i].getPosition().getRotations()
+            - path[i - 1].getPosition().getRotations());
+    const double velocitySumRPS =
+        path[i].getMaxVelocity().getRotationsPerSecond()
+            + path[i - 1].getMaxVelocity().getRotationsPerSecond();
+    if (distanceRotations == 0)
+      continue;
+    if (velocitySumRPS <= 0)
+      return std::numeric_limits<double>::infinity();
+    timeSeconds += 2 * distanceRotations / velocitySumRPS;
+  }
+  return timeSeconds;
+}
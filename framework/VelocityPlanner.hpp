@@ -0,0 +1,65 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file VelocityPlanner.hpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ *
+ * @brief Plans the fastest feasible velocity at each point of a dense path
+ *
+ * The velocity planner replaces the single maximum velocity given to every point of a path
+ * with the fastest velocity the chassis can have at that point.  Each point is first limited
+ * by its own maximum velocity, by the curvature of the path there (turning at a velocity v on
+ * a curve of curvature k takes a lateral acceleration of v * v * k, which may not exceed the
+ * chassis's maximum lateral acceleration), and by any speed zones covering it.  Then a forward
+ * pass from the start (at rest) lowers each limit to what the chassis can accelerate to from
+ * the point before it, and a backward pass from the end (at rest) lowers it to what the
+ * chassis can still stop from, each at the points' maximum acceleration.  The result is the
+ * time-optimal velocity profile within those limits, found in time linear in the number of
+ * points, and is stored back into the path points' maximum velocities.
+ *
+ * The limits are applied at the path points only, so the path should be dense enough that
+ * its curvature and speed zones are well sampled.
+ *
+ */
+#ifndef VELOCITYPLANNER_HPP_
+#define VELOCITYPLANNER_HPP_
+
+#include <vector>
+#include "ChassisAcceleration.hpp"
+#include "ChassisVelocity.hpp"
+#include "Path.hpp"
+
+/** @brief Plans time-optimal velocity limits along a path from curvature and speed zones
+ */
+
+class VelocityPlanner {
+ public:
+  VelocityPlanner();
+  virtual ~VelocityPlanner();
+  void setMaxLateralAcceleration(
+      const ChassisAcceleration &lateralAcceleration);
+  ChassisAcceleration getMaxLateralAcceleration() const;
+  void addSpeedZone(const double startFeet, const double endFeet,
+                    const ChassisVelocity &maxVelocity);
+  unsigned int getSpeedZoneCount() const;
+  void clearSpeedZones();
+  bool plan(Path &path, const std::vector<double> &curvaturePerFoot,
+            const double motorRotPerMovementFoot) const;
+  static void estimateCurvature(const std::vector<double> &xFeet,
+                                const std::vector<double> &yFeet,
+                                std::vector<double> &curvaturePerFoot);
+  static double profileTimeSeconds(const Path &path);
+
+ private:
+  // A stretch of the path, by distance along it, with a velocity cap
+  struct SpeedZone {
+    double startFeet;
+    double endFeet;
+    ChassisVelocity maxVelocity;
+  };
+  ChassisAcceleration maxLateralAcceleration;  // 0 for no curvature limit
+  std::vector<SpeedZone> speedZones;
+};
+
+#endif /* VELOCITYPLANNER_HPP_ */
@@ -0,0 +1,250 @@
+/**
+ * @copyright (c) 2017 Mark R. Jenkins.  All rights reserved.
+ * @file MCSFalloctest.cpp
+ *
+ * @author MJenkins, ENPM 808X Spring 2017
+ * @date Oct 19, 2026 - Creation
+ * @date Oct 19, 2026 - Output moves compared with each other, into caller-owned trajectories
+ * @date Oct 19, 2026 - Output moves allocate only for their file streams
+ *
+ * @brief Heap allocation tests for the Motion Control System Framework
+ *
+ * This Google Test-based test application replaces the global operator new and operator
+ * delete with versions that count every heap allocation and the bytes requested, so tests can
+ * measure the allocations made by a call.  The tests are regression tests for the steady
+ * state of the motion pipeline: once a move's trajectory buffers have been used, generating
+ * further moves into them must not allocate at all, and a move that writes its trajectories
+ * out must allocate only for its two file streams, however long the move is.
+ * They are kept in their own test application so the counting operators do not affect the
+ * main test suite.
+ *
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <new>
+#include <string>
+#include "../framework/Chassis.hpp"
+#include "../framework/ChassisAcceleration.hpp"
+#include "../framework/ChassisTurnRate.hpp"
+#include "../framework/ChassisVelocity.hpp"
+#include "../framework/MotorAcceleration.hpp"
+#include "../framework/MotorPosition.hpp"
+#include "../framework/MotorVelocity.hpp"
+#include "../framework/Path.hpp"
+#include "../framework/TankDrive.hpp"
+#include "../framework/Trajectory.hpp"
+
+namespace {
+std::atomic<unsigned long> allocationCount(0);  // allocations made
+std::atomic<unsigned long> allocationBytes(0);  // bytes requested
+
+// The heap allocations made by a call
+struct Allocations {
+  unsigned long count;
+  unsigned long bytes;
+};
+
+/**
+ * @brief Count the heap allocations made while running a function
+ * @param [in] function run to measure
+ * @return Allocations count and bytes of the allocations made
+ */
+template<typename Function>
+Allocations countAllocations(const Function &run) {
+  const unsigned long countBefore = allocationCount;
+  const unsigned long bytesBefore = allocationBytes;
+  run();
+  return Allocations { allocationCount - countBefore, allocationBytes
+      - bytesBefore };
+}
+
+/**
+ * @brief Make a two point path for trajectory generation
+ * @param [in] double distanceRotations between the points
+ * @return Path from 0 to the distance, at 600 rpm and 1200 rpm/s
+ */
+Path makeTwoPointPath(const double distanceRotations) {
+  Path path;
+  path.emplacePathPoint(MotorPosition(),
+                        MotorVelocity::fromRotationsPerMinute(600),
+                        MotorAcceleration::fromRotationsPerMinutePerSecond(
+                            1200));
+  path.emplacePathPoint(MotorPosition::fromRotations(distanceRotations),
+                        MotorVelocity(), MotorAcceleration());
+  return path;
+}
+
+/**
+ * @brief Make a tank drive configured like the demonstration robot
+ * @return TankDrive with its limits, gearing, period and width set
+ */
+TankDrive makeTankDrive() {
+  TankDrive tankDrive;
+  tankDrive.setMaxVelocity(MotorVelocity::fromRotationsPerMinute(4250));
+  tankDrive.setMaxAcceleration(
+      MotorAcceleration::fromRotationsPerMinutePerSecond(51000));
+  tankDrive.setMotorRotPerMovementFoot(850);
+  tankDrive.setTrajectoryIterationPeriodMS(10);
+  tankDrive.setWidthInFeet(2.75);
+  return tankDrive;
+}
+
+const ChassisTurnRate straight = ChassisTurnRate::fromDegreesPerFoot(0);
+const ChassisTurnRate turning = ChassisTurnRate::fromDegreesPerFoot(7.5);
+const ChassisVelocity velocity = ChassisVelocity::fromFeetPerSecond(5);
+const ChassisAcceleration acceleration =
+    ChassisAcceleration::fromFeetPerSecondPerSecond(3);
+}  // namespace
+
+/**
+ * @brief Allocate heap memory, counting the allocation
+ * @param [in] size_t size in bytes
+ * @return pointer to the memory
+ */
+void *operator new(std::size_t size) {
+  allocationCount++;
+  allocationBytes += size;
+  void *memory = std::malloc(size ? size : 1);
+  if (!memory)
+    throw std::bad_alloc();
+  return memory;
+}
+
+void *operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+//*********************************************************
+// Test that the counting operators see allocations
+//*********************************************************
+TEST(AllocationTest, testCounting) {
+  const Allocations allocations = countAllocations([]() {
+    std::string *text = new std::string(100, 'x');
+    delete text;
+  });
+  EXPECT_EQ(2u, allocations.count);
+  EXPECT_GE(allocations.bytes, sizeof(std::string) + 100);
+}
+
+//*********************************************************
+// Test that regenerating a trajectory in place does not allocate
+//*********************************************************
+TEST(AllocationTest, testTrajectoryGenerateSteadyState) {
+  const Path longPath = makeTwoPointPath(100);
+  const Path shortPath = makeTwoPointPath(10);
+  Trajectory aTrajectory;
+  const Allocations first = countAllocations([&]() {
+    aTrajectory.generate(longPath, 10);
+  });
+  EXPECT_GT(first.count, 0u);
+
+  // Once the trajectory's storage is big enough, no more is needed
+  for (const Path *path : { &longPath, &shortPath, &longPath }) {
+    const Allocations again = countAllocations([&]() {
+      aTrajectory.generate(*path, 10);
+    });
+    EXPECT_EQ(0u, again.count);
+    EXPECT_EQ(0u, again.bytes);
+  }
+
+  Trajectory scaledTrajectory;
+  scaledTrajectory.generateScaled(aTrajectory, 0.5);
+  EXPECT_EQ(0u, countAllocations([&]() {
+    scaledTrajectory.generateScaled(aTrajectory, 0.75);
+  }).count);
+}
+
+//*********************************************************
+// Test that repeated tank drive and chassis moves into re-used
+// trajectory buffers do not allocate after warmup
+//*********************************************************
+TEST(AllocationTest, testMoveGenerationSteadyState) {
+  // Warm up with the longest moves, so the buffers are big enough for all
+  const TankDrive aTankDrive = makeTankDrive();
+  Trajectory leftTrajectory, rightTrajectory;
+  aTankDrive.generateTrajectories(14, straight, velocity, acceleration,
+                                  leftTrajectory, rightTrajectory);
+  aTankDrive.generateTrajectories(14, turning, velocity, acceleration,
+                                  leftTrajectory, rightTrajectory);
+  for (unsigned int move = 0; move < 10; move++) {
+    const Allocations allocations = countAllocations([&]() {
+      aTankDrive.generateTrajectories(4 + move, (move % 2) ? turning : straight,
+                                      velocity, acceleration, leftTrajectory,
+                                      rightTrajectory);
+    });
+    EXPECT_EQ(0u, allocations.count) << "move " << move;
+  }
+
+  // Estimating a move's time does not allocate either
+  unsigned int pointCount;
+  double durationS;
+  EXPECT_EQ(0u, countAllocations([&]() {
+    aTankDrive.estimateMoveTime(12, turning, velocity, acceleration,
+                                pointCount, durationS);
+  }).count);
+
+  Chassis aChassis;
+  aChassis.setName("MCSFalloctest");
+  aChassis.setDriveSystem(aTankDrive);
+  aChassis.generateMove(12, turning, velocity, acceleration, leftTrajectory,
+                        rightTrajectory);
+  EXPECT_EQ(0u, countAllocations([&]() {
+    aChassis.generateMove(6, straight, velocity, acceleration, leftTrajectory,
+                          rightTrajectory);
+  }).count);
+}
+
+//*********************************************************
+// Test that a move writing its trajectories out into re-used
+// trajectory buffers allocates only for its two file streams,
+// however long the move
+//*********************************************************
+TEST(AllocationTest, testMoveOutputSteadyState) {
+  TankDrive aTankDrive = makeTankDrive();
+  aTankDrive.setChassisName("MCSFalloctest");
+  Trajectory leftTrajectory, rightTrajectory;
+  aTankDrive.move(12, turning, velocity, acceleration, leftTrajectory,
+                  rightTrajectory);
+
+  // The allocations of opening, writing and closing the same two files
+  const std::string fileNames[2] = { "MCSFalloctest-left.CSV",
+      "MCSFalloctest-right.CSV" };
+  const Allocations fileStreams = countAllocations([&]() {
+    for (const std::string &fileName : fileNames) {
+      std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+      file << "\"Motion Profile Trajectory generated by MCSF\"" << std::endl;
+      file.close();
+    }
+  });
+  EXPECT_GT(fileStreams.count, 0u);
+
+  for (const double distanceFeet : { 2.0, 12.0 }) {
+    const Allocations allocations = countAllocations([&]() {
+      aTankDrive.move(distanceFeet, turning, velocity, acceleration,
+                      leftTrajectory, rightTrajectory);
+    });
+    EXPECT_EQ(fileStreams.count, allocations.count) << distanceFeet << " ft";
+    EXPECT_EQ(fileStreams.bytes, allocations.bytes) << distanceFeet << " ft";
+  }
+  for (const std::string &fileName : fileNames)
+    std::remove(fileName.c_str());
+}
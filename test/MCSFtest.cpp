@@ -6,6 +6,29 @@
  * @date Mar 6, 2017 - Creation
  * @date Mar 10, 2017 - Added/expanded tests
  * @date Mar 13, 2017 - Added tests for Chassis movement classes
+ * @date Oct 19, 2026 - Added tests for TankDrive trajectory derivation
+ * @date Oct 19, 2026 - Added tests for the Chassis move queue
+ * @date Oct 19, 2026 - Added tests for real-time trajectory execution
+ * @date Oct 19, 2026 - Added tests for the trajectory point queue
+ * @date Oct 19, 2026 - Added tests for the motor and drive simulator
+ * @date Oct 19, 2026 - Added tests for odometry
+ * @date Oct 19, 2026 - Added tests for parameter sweeps
+ * @date Oct 19, 2026 - Added tests for the trajectory follower
+ * @date Oct 19, 2026 - Added tests for fleet planning
+ * @date Oct 19, 2026 - Added tests for compile-time unit types
+ * @date Oct 19, 2026 - Added tests for copy-free chassis moves
+ * @date Oct 19, 2026 - Added tests for copy-free path iteration
+ * @date Oct 19, 2026 - Added tests for grid path planning
+ * @date Oct 19, 2026 - Added tests for incremental grid re-planning
+ * @date Oct 19, 2026 - Added tests for velocity planning
+ * @date Oct 19, 2026 - Added tests for spline paths through pose way points
+ * @date Oct 19, 2026 - Added tests for tank drive trajectories along spline paths
+ * @date Oct 19, 2026 - Added tests for path indexing and pure pursuit following
+ * @date Oct 19, 2026 - Added tests for route order optimization
+ * @date Oct 19, 2026 - Added tests for trajectory lookup and interpolation by time
+ * @date Oct 19, 2026 - Added tests for move duration estimates
+ * @date Oct 19, 2026 - Added tests for move instrumentation
+ * @date Oct 19, 2026 - Added golden profile regression tests
  *
  * @brief Test application for the Motion Control System Framework
  *
@@ -21,22 +44,52 @@
  *
  */
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cmath>
+#include <fstream>
+#include <limits>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #include "../framework/Chassis.hpp"
 #include "../framework/ChassisAcceleration.hpp"
 #include "../framework/ChassisTurnRate.hpp"
 #include "../framework/ChassisVelocity.hpp"
+#include "../framework/DCMotorModel.hpp"
+#include "../framework/DriveSimulator.hpp"
 #include "../framework/DriveSystem.hpp"
+#include "../framework/FleetPlanner.hpp"
+#include "../framework/GridPlanner.hpp"
+#include "../framework/IncrementalGridPlanner.hpp"
+#include "../framework/Instrumentation.hpp"
 #include "../framework/MotorAcceleration.hpp"
 #include "../framework/MotorPosition.hpp"
 #include "../framework/MotorVelocity.hpp"
+#include "../framework/OccupancyGrid.hpp"
+#include "../framework/Odometry.hpp"
+#include "../framework/ParameterSweep.hpp"
 #include "../framework/Path.hpp"
+#include "../framework/PathIndex.hpp"
 #include "../framework/PathPoint.hpp"
 #include "../framework/Point.hpp"
+#include "../framework/PoseWayPoint.hpp"
+#include "../framework/PurePursuitFollower.hpp"
 #include "../framework/Trajectory.hpp"
+#include "../framework/TrajectoryExecutor.hpp"
+#include "../framework/TrajectoryFollower.hpp"
 #include "../framework/TrajectoryPoint.hpp"
+#include "../framework/TrajectoryPointQueue.hpp"
 #include "../framework/Route.hpp"
+#include "../framework/RouteOptimizer.hpp"
+#include "../framework/SplinePath.hpp"
+#include "../framework/VelocityPlanner.hpp"
+#include "../framework/SimulatedMotor.hpp"
 #include "../framework/TankDrive.hpp"
 #include "../framework/WayPoint.hpp"
 
@@ -501,6 +554,58 @@ TEST(PathTest, testAccessorFunctions) {
   EXPECT_FALSE(aPath.getNextPathPoint(secondReturnPathPoint));
 }
 
+//*********************************************************
+// Test copy-free iteration and construction for the Path class
+//*********************************************************
+TEST(PathTest, testIteration) {
+  // Build a long path with its points constructed in place
+  const unsigned int pointCount = 5000;
+  Path aPath;
+  aPath.reserve(pointCount);
+  Point::resetCopyCount();
+  MotorPosition position;
+  MotorVelocity maxVelocity;
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(600);
+  for (unsigned int i = 0; i < pointCount; i++) {
+    position.setRotations(i * 0.5);
+    maxVelocity.setRotationsPerMinute(100 + i % 7);
+    aPath.emplacePathPoint(position, maxVelocity, maxAcceleration);
+  }
+  EXPECT_EQ(pointCount, aPath.size());
+  EXPECT_EQ(0u, Point::getCopyCount());
+
+  // Points can be read by index and scanned with standard algorithms
+  // without copying any of them
+  EXPECT_DOUBLE_EQ(0.5, aPath[1].getPosition().getRotations());
+  EXPECT_DOUBLE_EQ(600, aPath[pointCount - 1].getMaxAcceleration()
+                       .getRotationsPerMinutePerSecond());
+  Path::const_iterator fastest = std::max_element(
+      aPath.begin(), aPath.end(),
+      [](const PathPoint &a, const PathPoint &b) {
+        return a.getMaxVelocity().getRotationsPerMinute()
+            < b.getMaxVelocity().getRotationsPerMinute();
+      });
+  EXPECT_EQ(6, fastest - aPath.begin());
+  EXPECT_EQ(0u, Point::getCopyCount());
+
+  // Several threads can scan the same (const) path at once
+  const Path &constPath = aPath;
+  std::vector<double> sums(4, 0.0);
+  std::vector<std::thread> readers;
+  for (unsigned int r = 0; r < sums.size(); r++) {
+    readers.push_back(std::thread([&constPath, &sums, r]() {
+      for (const auto &pathPoint : constPath)
+        sums[r] += pathPoint.getPosition().getRotations();
+    }));
+  }
+  for (auto &reader : readers)
+    reader.join();
+  for (auto sum : sums)
+    EXPECT_DOUBLE_EQ(0.5 * pointCount * (pointCount - 1) / 2, sum);
+  EXPECT_EQ(0u, Point::getCopyCount());
+}
+
 //*********************************************************
 // Test initialization for the Trajectory class
 //*********************************************************
@@ -763,6 +868,70 @@ TEST(ChassisAccelerationTest, testAccessorFunctions) {
                    aChassisAcceleration.getFeetPerSecondPerSecond());
 }
 
+//*********************************************************
+// Test that the unit types are trivially copyable, carry
+// no overhead, and convert at compile time
+//*********************************************************
+TEST(UnitTypesTest, testCompileTimeUnits) {
+  static_assert(std::is_trivially_copyable<MotorPosition>::value
+      && std::is_trivially_copyable<MotorVelocity>::value
+      && std::is_trivially_copyable<MotorAcceleration>::value
+      && std::is_trivially_copyable<ChassisVelocity>::value
+      && std::is_trivially_copyable<ChassisAcceleration>::value
+      && std::is_trivially_copyable<ChassisTurnRate>::value,
+                "unit types must be trivially copyable");
+  static_assert(sizeof(MotorVelocity) == sizeof(double)
+      && sizeof(ChassisTurnRate) == sizeof(double),
+                "unit types must be the size of their value");
+
+  // Conversions (RPM, RPS, and feet per second by rotations per foot)
+  // are evaluated by the compiler
+  constexpr ChassisVelocity chassisVelocity =
+      ChassisVelocity::fromFeetPerSecond(3);
+  constexpr MotorVelocity motorVelocity =
+      MotorVelocity::fromChassisVelocityByRotPerMovementFoot(chassisVelocity,
+                                                             850);
+  static_assert(motorVelocity.getRotationsPerMinute() == 3 * 60 * 850,
+                "compile-time ft/s to RPM conversion");
+  static_assert(motorVelocity.getRotationsPerSecond() == 3 * 850,
+                "compile-time RPM to RPS conversion");
+  static_assert(
+      motorVelocity.getChassisVelocityByRotPerMovementFoot(850)
+          .getFeetPerSecond() == 3,
+      "compile-time RPM to ft/s conversion");
+  constexpr MotorAcceleration motorAcceleration =
+      MotorAcceleration::fromChassisAccelerationByRotPerMovementFoot(
+          ChassisAcceleration::fromFeetPerSecondPerSecond(2), 850);
+  static_assert(motorAcceleration.getRotationsPerSecondPerSecond() == 1700,
+                "compile-time ft/s/s to RPS/s conversion");
+  constexpr MotorPosition motorPosition =
+      MotorPosition::fromDistanceFeetByRotPerMovementFoot(45, 850)
+          - MotorPosition::fromRotations(250);
+  static_assert(motorPosition.getRotations() == 38000,
+                "compile-time position arithmetic");
+  static_assert(ChassisTurnRate::fromDegreesPerFoot(-5).getDegreesPerFoot()
+                    == -5,
+                "compile-time turn rate");
+
+  // and work the same at run time
+  MotorVelocity aVelocity;
+  aVelocity.setRotationsPerSecond(10);
+  EXPECT_DOUBLE_EQ(600, aVelocity.getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(1200, (aVelocity + aVelocity).getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(300, (aVelocity * 0.5).getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(0, (aVelocity - aVelocity).getRotationsPerMinute());
+  MotorAcceleration anAcceleration;
+  anAcceleration.setRotationsPerSecondPerSecond(2);
+  EXPECT_DOUBLE_EQ(120, anAcceleration.getRotationsPerMinutePerSecond());
+  EXPECT_DOUBLE_EQ(
+      2.0 / 850,
+      anAcceleration.getChassisAccelerationByRotPerMovementFoot(850)
+          .getFeetPerSecondPerSecond());
+  MotorPosition aPosition = MotorPosition::fromRotations(1700);
+  EXPECT_DOUBLE_EQ(2, aPosition.getDistanceFeetByRotPerMovementFoot(850));
+  EXPECT_DOUBLE_EQ(3400, (aPosition + aPosition).getRotations());
+}
+
 //*********************************************************
 // Test initialization for the DriveSystem class
 //*********************************************************
@@ -912,6 +1081,112 @@ TEST(TankDriveTest, testAccessorFunctions) {
   EXPECT_DOUBLE_EQ(driveWidthFeet, aTankDrive.getWidthInFeet());
 }
 
+//*********************************************************
+// Test that a TankDrive turning move's derived (inner) side
+// matches an independently generated trajectory
+//*********************************************************
+TEST(TankDriveTest, testDerivedSideMatchesGenerated) {
+  TankDrive aTankDrive;
+
+  // This drive can move at 5 feet per second, accelerate at 6 fps/s
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(4250);
+  aTankDrive.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(5100);
+  aTankDrive.setMaxAcceleration(maxAcceleration);
+  double rotPerFoot = 850;
+  aTankDrive.setMotorRotPerMovementFoot(rotPerFoot);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  double driveWidthFeet = 2.75;
+  aTankDrive.setWidthInFeet(driveWidthFeet);
+
+  // Turn to the right, so the left side is the outer (governing) side
+  ChassisTurnRate turnRate;
+  turnRate.setDegreesPerFoot(5);
+  ChassisVelocity velocity;
+  velocity.setFeetPerSecond(3);
+  ChassisAcceleration acceleration;
+  acceleration.setFeetPerSecondPerSecond(2);
+  double distanceFeet = 45;
+  Trajectory leftTrajectory, rightTrajectory;
+  aTankDrive.generateTrajectories(distanceFeet, turnRate, velocity,
+                                  acceleration, leftTrajectory,
+                                  rightTrajectory);
+
+  // Independently build and generate the inner (right) side path from the
+  // outer (left) side's path parameters scaled by the inner/outer ratio
+  const double pi = 4 * atan(1.0);
+  double centerRadiusFeet = 360 / turnRate.getDegreesPerFoot() / (2 * pi);
+  double outerToInnerScale = (centerRadiusFeet - 0.5 * driveWidthFeet)
+      / (centerRadiusFeet + 0.5 * driveWidthFeet);
+  Path innerPath;
+  PathPoint beginPathPoint, endPathPoint;
+  MotorPosition endPosition;
+  endPosition.setRotations(
+      leftTrajectory.getDistance().getRotations() * outerToInnerScale);
+  MotorVelocity innerVelocity;
+  innerVelocity.setRotationsPerMinute(
+      leftTrajectory.getMaxVelocity().getRotationsPerMinute()
+          * outerToInnerScale);
+  MotorAcceleration innerAcceleration;
+  innerAcceleration.setRotationsPerMinutePerSecond(
+      leftTrajectory.getMaxAcceleration().getRotationsPerMinutePerSecond()
+          * outerToInnerScale);
+  beginPathPoint.setMaxVelocity(innerVelocity);
+  beginPathPoint.setMaxAcceleration(innerAcceleration);
+  innerPath.addPathPoint(beginPathPoint);
+  endPathPoint.setPosition(endPosition);
+  innerPath.addPathPoint(endPathPoint);
+  Trajectory innerTrajectory;
+  innerTrajectory.generate(innerPath, 10);
+
+  // The derived side should have the same algorithm counts (the millisecond
+  // times may round differently, but not by a whole iteration period)
+  EXPECT_EQ(innerTrajectory.size(), rightTrajectory.size());
+  EXPECT_EQ(leftTrajectory.size(), rightTrajectory.size());
+  EXPECT_EQ(innerTrajectory.getAlgoFL1count(),
+            rightTrajectory.getAlgoFL1count());
+  EXPECT_EQ(innerTrajectory.getAlgoFL2count(),
+            rightTrajectory.getAlgoFL2count());
+  EXPECT_EQ(innerTrajectory.getAlgoNcount(), rightTrajectory.getAlgoNcount());
+  EXPECT_NEAR(innerTrajectory.getDistance().getRotations(),
+              rightTrajectory.getDistance().getRotations(), 1e-6);
+
+  // and every point should match the independently generated trajectory
+  TrajectoryPoint innerPoint, derivedPoint;
+  for (unsigned int i = 0; i < innerTrajectory.size(); i++) {
+    ASSERT_TRUE(innerTrajectory.getTrajectoryPoint(i, innerPoint));
+    ASSERT_TRUE(rightTrajectory.getTrajectoryPoint(i, derivedPoint));
+    EXPECT_EQ(innerPoint.getStep(), derivedPoint.getStep());
+    EXPECT_DOUBLE_EQ(innerPoint.getTimeS(), derivedPoint.getTimeS());
+    EXPECT_NEAR(innerPoint.getPosition().getRotations(),
+                derivedPoint.getPosition().getRotations(), 1e-6);
+    EXPECT_NEAR(innerPoint.getVelocity().getRotationsPerMinute(),
+                derivedPoint.getVelocity().getRotationsPerMinute(), 1e-6);
+    EXPECT_NEAR(
+        innerPoint.getAcceleration().getRotationsPerMinutePerSecond(),
+        derivedPoint.getAcceleration().getRotationsPerMinutePerSecond(), 1e-4);
+  }
+  EXPECT_FALSE(
+      rightTrajectory.getTrajectoryPoint(rightTrajectory.size(), derivedPoint));
+
+  // A straight move has identical left and right trajectories
+  turnRate.setDegreesPerFoot(0);
+  aTankDrive.generateTrajectories(10, turnRate, velocity, acceleration,
+                                  leftTrajectory, rightTrajectory);
+  ASSERT_EQ(leftTrajectory.size(), rightTrajectory.size());
+  TrajectoryPoint leftPoint, rightPoint;
+  for (unsigned int i = 0; i < leftTrajectory.size(); i++) {
+    ASSERT_TRUE(leftTrajectory.getTrajectoryPoint(i, leftPoint));
+    ASSERT_TRUE(rightTrajectory.getTrajectoryPoint(i, rightPoint));
+    EXPECT_DOUBLE_EQ(leftPoint.getPosition().getRotations(),
+                     rightPoint.getPosition().getRotations());
+    EXPECT_DOUBLE_EQ(leftPoint.getVelocity().getRotationsPerMinute(),
+                     rightPoint.getVelocity().getRotationsPerMinute());
+  }
+}
+
 //*********************************************************
 // Test initialization for the Chassis class
 //*********************************************************
@@ -995,3 +1270,2291 @@ TEST(ChassisTest, testAccessorFunctions) {
   EXPECT_DOUBLE_EQ(driveWidthFeet, returnedTankDrive.getWidthInFeet());
 }
 
+//*********************************************************
+// Test that a Chassis move copies no more points than it must
+//*********************************************************
+TEST(ChassisTest, testMoveCopies) {
+  Chassis aChassis;
+  aChassis.setName("CopyCounter");
+  TankDrive aTankDrive;
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(4250);
+  aTankDrive.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(5100);
+  aTankDrive.setMaxAcceleration(maxAcceleration);
+  aTankDrive.setMotorRotPerMovementFoot(850);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  aTankDrive.setWidthInFeet(2.75);
+  aChassis.setDriveSystem(aTankDrive);
+
+  // The drive system is reachable for inspection through a const chassis
+  const Chassis &constChassis = aChassis;
+  EXPECT_EQ("CopyCounter", constChassis.getDriveSystem().getChassisName());
+
+  // A right turn, so the right side is derived from the left side
+  ChassisTurnRate turnRate;
+  turnRate.setDegreesPerFoot(5);
+  ChassisVelocity velocity;
+  velocity.setFeetPerSecond(3);
+  ChassisAcceleration acceleration;
+  acceleration.setFeetPerSecondPerSecond(2);
+  Trajectory leftTrajectory, rightTrajectory;
+  aChassis.generateMove(45, turnRate, velocity, acceleration, leftTrajectory,
+                        rightTrajectory);
+  ASSERT_GT(rightTrajectory.size(), 0u);
+
+  // Reading a trajectory's points in place copies none of them
+  Point::resetCopyCount();
+  unsigned int pointsRead = 0;
+  double lastPositionRot = 0.0;
+  for (const auto &tPoint : leftTrajectory.getTrajectoryPoints()) {
+    lastPositionRot = tPoint.getPosition().getRotations();
+    pointsRead++;
+  }
+  EXPECT_EQ(leftTrajectory.size(), pointsRead);
+  EXPECT_GT(lastPositionRot, 0.0);
+  EXPECT_EQ(0u, Point::getCopyCount());
+
+  // The path and generated side's points are constructed in place, so the
+  // only point copies in a full move are the derived side's trajectory points
+  Point::resetCopyCount();
+  aChassis.move(45, turnRate, velocity, acceleration);
+  EXPECT_EQ(rightTrajectory.size(), Point::getCopyCount());
+  std::remove("CopyCounter-left.CSV");
+  std::remove("CopyCounter-right.CSV");
+}
+
+
+//*********************************************************
+// A Chassis that records the moves it executes, taking a
+// fixed amount of time to execute each one, and failing
+// once it has executed failAfterMoves moves (if set)
+//*********************************************************
+class RecordingChassis : public Chassis {
+ public:
+  std::vector<double> executedDistances;
+  unsigned int failAfterMoves = 0;
+
+ protected:
+  void executeMove(const Trajectory &leftTrajectory,
+                   const Trajectory &rightTrajectory) {
+    if (failAfterMoves > 0 && executedDistances.size() == failAfterMoves)
+      throw std::runtime_error("move execution failed");
+    EXPECT_EQ(leftTrajectory.size(), rightTrajectory.size());
+    executedDistances.push_back(leftTrajectory.getDistance().getRotations());
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+};
+
+//*********************************************************
+// Test the move queue for the Chassis class
+//*********************************************************
+TEST(ChassisTest, testMoveQueue) {
+  RecordingChassis aChassis;
+  aChassis.setName("Johnny5");
+
+  TankDrive aTankDrive;
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(4250);
+  aTankDrive.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(5100);
+  aTankDrive.setMaxAcceleration(maxAcceleration);
+  aTankDrive.setMotorRotPerMovementFoot(850);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  aTankDrive.setWidthInFeet(2.75);
+  aChassis.setDriveSystem(aTankDrive);
+
+  // Queue a series of straight moves of increasing length
+  ChassisTurnRate turnRate;
+  ChassisVelocity velocity;
+  velocity.setFeetPerSecond(3);
+  ChassisAcceleration acceleration;
+  acceleration.setFeetPerSecondPerSecond(2);
+  unsigned int moveCount = 6;
+  for (unsigned int move = 1; move <= moveCount; move++)
+    aChassis.queueMove(move, turnRate, velocity, acceleration);
+  EXPECT_EQ(moveCount, aChassis.getQueuedMoveCount());
+
+  // Run the queue; every move should execute, in order (how often
+  // execution had to wait for generation depends on timing)
+  aChassis.runMoveQueue();
+  ASSERT_EQ(moveCount, aChassis.executedDistances.size());
+  for (unsigned int move = 1; move <= moveCount; move++)
+    EXPECT_DOUBLE_EQ(move * 850.0, aChassis.executedDistances[move - 1]);
+  EXPECT_EQ(0u, aChassis.getQueuedMoveCount());
+
+  // A failing move stops the queue, passing the failure on, with the
+  // generation thread stopped rather than left running
+  aChassis.executedDistances.clear();
+  aChassis.failAfterMoves = 2;
+  for (unsigned int move = 1; move <= moveCount; move++)
+    aChassis.queueMove(move, turnRate, velocity, acceleration);
+  EXPECT_THROW(aChassis.runMoveQueue(), std::runtime_error);
+  ASSERT_EQ(2u, aChassis.executedDistances.size());
+  EXPECT_DOUBLE_EQ(850.0, aChassis.executedDistances[0]);
+  EXPECT_DOUBLE_EQ(2 * 850.0, aChassis.executedDistances[1]);
+  EXPECT_EQ(moveCount, aChassis.getQueuedMoveCount());
+  aChassis.failAfterMoves = 0;
+
+  // Clearing the queue discards queued moves
+  aChassis.queueMove(1, turnRate, velocity, acceleration);
+  aChassis.clearMoveQueue();
+  EXPECT_EQ(0u, aChassis.getQueuedMoveCount());
+}
+
+//*********************************************************
+// Create a short two-point path (1 rotation at 10 RPS,
+// accelerating at 100 RPS/S) for execution tests
+//*********************************************************
+static Path shortExecutionPath(double scale) {
+  Path aPath;
+  PathPoint firstPathPoint, secondPathPoint;
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(600 * scale);
+  firstPathPoint.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(6000 * scale);
+  firstPathPoint.setMaxAcceleration(maxAcceleration);
+  aPath.addPathPoint(firstPathPoint);
+  MotorPosition endPosition;
+  endPosition.setRotations(1.0 * scale);
+  secondPathPoint.setPosition(endPosition);
+  aPath.addPathPoint(secondPathPoint);
+  return aPath;
+}
+
+//*********************************************************
+// Test real-time execution of a single trajectory
+//*********************************************************
+TEST(TrajectoryExecutorTest, testSingleTrajectory) {
+  Path aPath = shortExecutionPath(1.0);
+  Trajectory aTrajectory;
+  aTrajectory.generate(aPath, 5);
+  TrajectoryPoint lastPoint;
+  ASSERT_TRUE(aTrajectory.getTrajectoryPoint(aTrajectory.size() - 1,
+                                             lastPoint));
+
+  // Every point should reach the motor, ending at the trajectory's end
+  SimulatedMotor aMotor;
+  aTrajectory.execute(aMotor);
+  EXPECT_EQ(aTrajectory.size(), aMotor.getPointCount());
+  EXPECT_DOUBLE_EQ(lastPoint.getPosition().getRotations(),
+                   aMotor.getCommandedPosition().getRotations());
+  EXPECT_DOUBLE_EQ(0.0, aMotor.getCommandedVelocity().getRotationsPerMinute());
+  EXPECT_NEAR(1.0, aMotor.getSimulatedPosition().getRotations(), 1e-9);
+}
+
+//*********************************************************
+// Test real-time execution of simultaneous trajectories
+//*********************************************************
+TEST(TrajectoryExecutorTest, testSimultaneousTrajectories) {
+  Path leftPath = shortExecutionPath(1.0);
+  Path rightPath = shortExecutionPath(0.5);
+  Trajectory leftTrajectory, rightTrajectory;
+  leftTrajectory.generate(leftPath, 5);
+  rightTrajectory.generate(rightPath, 5);
+
+  SimulatedMotor leftMotor, rightMotor;
+  TrajectoryExecutor anExecutor;
+  anExecutor.addTrajectory(leftTrajectory, leftMotor);
+  anExecutor.addTrajectory(rightTrajectory, rightMotor);
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  anExecutor.execute();
+  std::chrono::steady_clock::duration elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  // Both trajectories should be fully executed, one tick per period
+  EXPECT_EQ(leftTrajectory.size(), anExecutor.getTickCount());
+  EXPECT_EQ(leftTrajectory.size(), leftMotor.getPointCount());
+  EXPECT_EQ(rightTrajectory.size(), rightMotor.getPointCount());
+  EXPECT_NEAR(1.0, leftMotor.getSimulatedPosition().getRotations(), 1e-9);
+  EXPECT_NEAR(0.5, rightMotor.getSimulatedPosition().getRotations(), 1e-9);
+  EXPECT_GE(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                .count(),
+            (anExecutor.getTickCount() - 1) * 5);
+
+  // Ticks are never released before their release time
+  long latencyNS;
+  for (unsigned int tick = 0; tick < anExecutor.getTickCount(); tick++) {
+    ASSERT_TRUE(anExecutor.getWakeupLatencyNS(tick, latencyNS));
+    EXPECT_GE(latencyNS, 0);
+  }
+  EXPECT_FALSE(anExecutor.getWakeupLatencyNS(anExecutor.getTickCount(),
+                                             latencyNS));
+  EXPECT_GE(anExecutor.getMaxWakeupLatencyNS(),
+            anExecutor.getMeanWakeupLatencyNS());
+  EXPECT_LE(anExecutor.getMissedDeadlineCount(), anExecutor.getTickCount());
+  EXPECT_LE(anExecutor.getOverrunCount(),
+            anExecutor.getMissedDeadlineCount());
+
+  // With no trajectories there is nothing to execute
+  anExecutor.clearTrajectories();
+  anExecutor.execute();
+  EXPECT_EQ(0u, anExecutor.getTickCount());
+}
+
+//*********************************************************
+// Test basic operations of the TrajectoryPointQueue class
+//*********************************************************
+TEST(TrajectoryPointQueueTest, testQueueOperations) {
+  // Capacity is rounded up to a power of two
+  TrajectoryPointQueue aQueue(5);
+  EXPECT_EQ(8u, aQueue.capacity());
+  EXPECT_EQ(0u, aQueue.size());
+
+  // Popping an empty, open queue is an underrun
+  TrajectoryPoint tPoint;
+  EXPECT_FALSE(aQueue.pop(tPoint));
+  EXPECT_EQ(1u, aQueue.getUnderrunCount());
+
+  // Fill the queue; a push into a full queue fails
+  for (unsigned int step = 1; step <= 8; step++) {
+    tPoint.setStep(step);
+    EXPECT_TRUE(aQueue.push(tPoint));
+  }
+  EXPECT_FALSE(aQueue.push(tPoint));
+  EXPECT_EQ(8u, aQueue.size());
+  EXPECT_EQ(8u, aQueue.getHighWaterMark());
+
+  // Points come back out in the order they went in, wrapping around
+  for (unsigned int step = 1; step <= 4; step++) {
+    ASSERT_TRUE(aQueue.pop(tPoint));
+    EXPECT_EQ(step, tPoint.getStep());
+  }
+  for (unsigned int step = 9; step <= 12; step++) {
+    tPoint.setStep(step);
+    EXPECT_TRUE(aQueue.push(tPoint));
+  }
+  aQueue.close();
+  EXPECT_TRUE(aQueue.isClosed());
+  EXPECT_FALSE(aQueue.isDrained());
+  for (unsigned int step = 5; step <= 12; step++) {
+    ASSERT_TRUE(aQueue.pop(tPoint));
+    EXPECT_EQ(step, tPoint.getStep());
+  }
+
+  // Popping a closed, empty queue is not an underrun
+  EXPECT_FALSE(aQueue.pop(tPoint));
+  EXPECT_TRUE(aQueue.isDrained());
+  EXPECT_EQ(1u, aQueue.getUnderrunCount());
+}
+
+//*********************************************************
+// Stress test the TrajectoryPointQueue class with a producer
+// and a consumer thread passing millions of points
+//*********************************************************
+TEST(TrajectoryPointQueueTest, testProducerConsumerStress) {
+  TrajectoryPointQueue aQueue(1024);
+  const unsigned int pointCount = 4000000;
+
+  std::thread producer([&]() {
+    TrajectoryPoint tPoint;
+    for (unsigned int step = 1; step <= pointCount; step++) {
+      tPoint.setStep(step);
+      while (!aQueue.push(tPoint))
+        std::this_thread::yield();
+    }
+    aQueue.close();
+  });
+
+  // Every point should arrive exactly once, in order
+  TrajectoryPoint tPoint;
+  unsigned int expectedStep = 1;
+  bool inOrder = true;
+  while (!aQueue.isDrained()) {
+    if (aQueue.pop(tPoint)) {
+      inOrder = inOrder && (tPoint.getStep() == expectedStep);
+      expectedStep++;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  EXPECT_TRUE(inOrder);
+  EXPECT_EQ(pointCount + 1, expectedStep);
+  EXPECT_LE(aQueue.getHighWaterMark(), aQueue.capacity());
+}
+
+//*********************************************************
+// Test real-time execution from a queue filled by another
+// thread
+//*********************************************************
+TEST(TrajectoryExecutorTest, testQueueExecution) {
+  Path aPath = shortExecutionPath(1.0);
+  Trajectory aTrajectory;
+  aTrajectory.generate(aPath, 5);
+
+  // Produce the trajectory's points into the queue on another thread
+  TrajectoryPointQueue aQueue(16);
+  std::thread producer([&]() {
+    TrajectoryPoint tPoint;
+    for (unsigned int index = 0; index < aTrajectory.size(); index++) {
+      aTrajectory.getTrajectoryPoint(index, tPoint);
+      while (!aQueue.push(tPoint))
+        std::this_thread::yield();
+    }
+    aQueue.close();
+  });
+
+  SimulatedMotor aMotor;
+  TrajectoryExecutor anExecutor;
+  anExecutor.setIterationPeriodMS(5);
+  EXPECT_EQ(5u, anExecutor.getIterationPeriodMS());
+  anExecutor.addQueue(aQueue, aMotor);
+  anExecutor.execute();
+  producer.join();
+
+  // Every point should reach the motor through the queue
+  EXPECT_EQ(aTrajectory.size(), aMotor.getPointCount());
+  EXPECT_NEAR(1.0, aMotor.getSimulatedPosition().getRotations(), 1e-9);
+  EXPECT_GE(anExecutor.getTickCount(), aTrajectory.size());
+  EXPECT_TRUE(aQueue.isDrained());
+
+  // With no iteration period, the executor releases points as they arrive,
+  // one per tick, waiting for a slow producer rather than ticking without one
+  TrajectoryPointQueue aSlowQueue(16);
+  std::thread slowProducer([&]() {
+    TrajectoryPoint tPoint;
+    for (unsigned int index = 0; index < aTrajectory.size(); index++) {
+      if (index % 20 == 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      aTrajectory.getTrajectoryPoint(index, tPoint);
+      while (!aSlowQueue.push(tPoint))
+        std::this_thread::yield();
+    }
+    aSlowQueue.close();
+  });
+  SimulatedMotor aFreeRunningMotor;
+  TrajectoryExecutor aFreeRunningExecutor;
+  aFreeRunningExecutor.addQueue(aSlowQueue, aFreeRunningMotor);
+  aFreeRunningExecutor.execute();
+  slowProducer.join();
+  EXPECT_EQ(aTrajectory.size(), aFreeRunningMotor.getPointCount());
+  EXPECT_EQ(aTrajectory.size(), aFreeRunningExecutor.getTickCount());
+  EXPECT_TRUE(aSlowQueue.isDrained());
+}
+
+//*********************************************************
+// Test the DC motor model's first order, speed limited and
+// acceleration limited response
+//*********************************************************
+TEST(DCMotorModelTest, testResponse) {
+  DCMotorModel aMotor;
+  EXPECT_DOUBLE_EQ(0.0, aMotor.getTimeConstantS());
+  EXPECT_DOUBLE_EQ(0.0, aMotor.getFreeSpeed().getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(0.0, aMotor.getVelocity().getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(0.0, aMotor.getPosition().getRotations());
+
+  // After one time constant, the motor is ~63.2% of the way to the command
+  aMotor.setTimeConstantS(0.1);
+  EXPECT_DOUBLE_EQ(0.1, aMotor.getTimeConstantS());
+  MotorVelocity commandedVelocity;
+  commandedVelocity.setRotationsPerMinute(600);
+  aMotor.setCommandedVelocity(commandedVelocity);
+  for (int step = 0; step < 100; step++)
+    aMotor.step(0.001);
+  EXPECT_NEAR(600 * (1 - exp(-1.0)),
+              aMotor.getVelocity().getRotationsPerMinute(), 1e-6);
+  EXPECT_GT(aMotor.getPosition().getRotations(), 0.0);
+
+  // The motor never exceeds its free speed
+  MotorVelocity freeSpeed;
+  freeSpeed.setRotationsPerMinute(300);
+  aMotor.setFreeSpeed(freeSpeed);
+  EXPECT_DOUBLE_EQ(300, aMotor.getFreeSpeed().getRotationsPerMinute());
+  for (int step = 0; step < 2000; step++)
+    aMotor.step(0.001);
+  EXPECT_NEAR(300, aMotor.getVelocity().getRotationsPerMinute(), 1e-6);
+
+  // The motor's acceleration is limited by its torque
+  aMotor.reset();
+  EXPECT_DOUBLE_EQ(0.0, aMotor.getVelocity().getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(0.0, aMotor.getPosition().getRotations());
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(600);
+  aMotor.setMaxAcceleration(maxAcceleration);
+  EXPECT_DOUBLE_EQ(600,
+                   aMotor.getMaxAcceleration().getRotationsPerMinutePerSecond());
+  aMotor.setCommandedVelocity(commandedVelocity);
+  for (int step = 0; step < 100; step++)
+    aMotor.step(0.001);
+  EXPECT_NEAR(60, aMotor.getVelocity().getRotationsPerMinute(), 1e-6);
+}
+
+//*********************************************************
+// Test that a simulated turning move ends on the commanded
+// arc
+//*********************************************************
+TEST(DriveSimulatorTest, testTurningMove) {
+  TankDrive aTankDrive;
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(4250);
+  aTankDrive.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(5100);
+  aTankDrive.setMaxAcceleration(maxAcceleration);
+  aTankDrive.setMotorRotPerMovementFoot(850);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  aTankDrive.setWidthInFeet(2.75);
+
+  // 45 feet at 5 degrees per foot is a 225 degree turn to the right
+  ChassisTurnRate turnRate;
+  turnRate.setDegreesPerFoot(5);
+  ChassisVelocity velocity;
+  velocity.setFeetPerSecond(3);
+  ChassisAcceleration acceleration;
+  acceleration.setFeetPerSecondPerSecond(2);
+  Trajectory leftTrajectory, rightTrajectory;
+  aTankDrive.generateTrajectories(45, turnRate, velocity, acceleration,
+                                  leftTrajectory, rightTrajectory);
+
+  DCMotorModel aMotor;
+  aMotor.setTimeConstantS(0.05);
+  DriveSimulator aSimulator;
+  EXPECT_EQ(1000u, aSimulator.getSimulationRateHz());
+  EXPECT_FALSE(aSimulator.getRealTimePacing());
+  aSimulator.configureFromTankDrive(aTankDrive);
+  EXPECT_DOUBLE_EQ(850, aSimulator.getMotorRotPerMovementFoot());
+  EXPECT_DOUBLE_EQ(2.75, aSimulator.getWidthInFeet());
+  aSimulator.setMotorModel(aMotor);
+  aSimulator.setSettleTimeS(1.0);
+  EXPECT_DOUBLE_EQ(1.0, aSimulator.getSettleTimeS());
+
+  aSimulator.simulate(leftTrajectory, rightTrajectory);
+
+  // The whole move plus settle time was simulated
+  double moveS = (leftTrajectory.size() - 1) * 0.010;
+  EXPECT_NEAR(moveS + 1.0, aSimulator.getSimulatedTimeS(), 0.001);
+  EXPECT_EQ(static_cast<unsigned long>(
+                std::lround(aSimulator.getSimulatedTimeS() * 1000)),
+            aSimulator.getStepCount());
+
+  // Once settled, the motors reach the end of their trajectories, and the
+  // chassis ends on the arc those end positions describe
+  TrajectoryPoint leftEnd, rightEnd;
+  leftTrajectory.getTrajectoryPoint(leftTrajectory.size() - 1, leftEnd);
+  rightTrajectory.getTrajectoryPoint(rightTrajectory.size() - 1, rightEnd);
+  double leftEndRot = leftEnd.getPosition().getRotations();
+  double rightEndRot = rightEnd.getPosition().getRotations();
+  EXPECT_NEAR(leftEndRot, aSimulator.getLeftPosition().getRotations(), 0.01);
+  EXPECT_NEAR(rightEndRot, aSimulator.getRightPosition().getRotations(),
+              0.01);
+  double headingRadians = (leftEndRot - rightEndRot) / 850 / 2.75;
+  double radiusFeet = (leftEndRot + rightEndRot) / 2 / 850 / headingRadians;
+  const double pi = 4 * atan(1.0);
+  EXPECT_NEAR(headingRadians * 180 / pi, aSimulator.getHeadingDegrees(),
+              1e-3);
+  EXPECT_NEAR(radiusFeet * sin(headingRadians), aSimulator.getXFeet(), 1e-3);
+  EXPECT_NEAR(radiusFeet * (1 - cos(headingRadians)), aSimulator.getYFeet(),
+              1e-3);
+
+  // which is within a fraction of a percent of the requested 225 degree
+  // turn on a radius of 360 / 5 / 2pi feet
+  EXPECT_NEAR(225, aSimulator.getHeadingDegrees(), 0.2);
+  EXPECT_NEAR(360 / 5.0 / (2 * pi) * sin(225 * pi / 180),
+              aSimulator.getXFeet(), 0.05);
+  EXPECT_NEAR(360 / 5.0 / (2 * pi) * (1 - cos(225 * pi / 180)),
+              aSimulator.getYFeet(), 0.05);
+
+  // Motor lag shows up as a bounded tracking error, larger on the outer side
+  EXPECT_GT(aSimulator.getMaxLeftTrackingError().getRotations(), 0.0);
+  EXPECT_GT(aSimulator.getMaxLeftTrackingError().getRotations(),
+            aSimulator.getMaxRightTrackingError().getRotations());
+  EXPECT_LT(aSimulator.getMaxLeftTrackingError().getRotations(),
+            leftTrajectory.getMaxVelocity().getRotationsPerMinute() / 60
+                * 0.05);
+}
+
+//*********************************************************
+// Test that real-time pacing runs the simulation on the
+// wall clock
+//*********************************************************
+TEST(DriveSimulatorTest, testRealTimePacing) {
+  Path aPath = shortExecutionPath(1.0);
+  Trajectory aTrajectory;
+  aTrajectory.generate(aPath, 10);
+
+  DriveSimulator aSimulator;
+  aSimulator.setMotorRotPerMovementFoot(1);
+  aSimulator.setWidthInFeet(2);
+  aSimulator.setSettleTimeS(0);
+  aSimulator.setRealTimePacing(true);
+  EXPECT_TRUE(aSimulator.getRealTimePacing());
+
+  auto start = std::chrono::steady_clock::now();
+  aSimulator.simulate(aTrajectory, aTrajectory);
+  double elapsedS = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  // A straight move with an ideal motor follows the trajectory exactly
+  EXPECT_GE(elapsedS, aSimulator.getSimulatedTimeS());
+  EXPECT_NEAR(1.0, aSimulator.getXFeet(), 1e-9);
+  EXPECT_NEAR(0.0, aSimulator.getYFeet(), 1e-9);
+  EXPECT_NEAR(0.0, aSimulator.getHeadingDegrees(), 1e-9);
+  EXPECT_NEAR(0.0, aSimulator.getMaxLeftTrackingError().getRotations(), 1e-9);
+}
+
+//*********************************************************
+// Test that odometry places every pose of the 45 foot, +5
+// degree per foot demo move on its turning circle
+//*********************************************************
+TEST(OdometryTest, testArcMove) {
+  TankDrive aTankDrive;
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(4250);
+  aTankDrive.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(5100);
+  aTankDrive.setMaxAcceleration(maxAcceleration);
+  aTankDrive.setMotorRotPerMovementFoot(850);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  aTankDrive.setWidthInFeet(2.75);
+  ChassisTurnRate turnRate;
+  turnRate.setDegreesPerFoot(5);
+  ChassisVelocity velocity;
+  velocity.setFeetPerSecond(3);
+  ChassisAcceleration acceleration;
+  acceleration.setFeetPerSecondPerSecond(2);
+  Trajectory leftTrajectory, rightTrajectory;
+  aTankDrive.generateTrajectories(45, turnRate, velocity, acceleration,
+                                  leftTrajectory, rightTrajectory);
+
+  Odometry anOdometry;
+  EXPECT_EQ(0u, anOdometry.size());
+  anOdometry.configureFromTankDrive(aTankDrive);
+  EXPECT_DOUBLE_EQ(850, anOdometry.getMotorRotPerMovementFoot());
+  EXPECT_DOUBLE_EQ(2.75, anOdometry.getWidthInFeet());
+  anOdometry.integrate(leftTrajectory, rightTrajectory);
+  ASSERT_EQ(leftTrajectory.size(), anOdometry.size());
+  EXPECT_DOUBLE_EQ(0.0, anOdometry.getTimeS()[0]);
+  EXPECT_NEAR(0.01, anOdometry.getTimeS()[1], 1e-12);
+
+  // Turning right, the turning circle is centered to the right of the start
+  const double pi = 4 * atan(1.0);
+  double radiusFeet = 360 / 5.0 / (2 * pi);
+  for (unsigned int i = 0; i < anOdometry.size(); i++) {
+    double x = anOdometry.getXFeet()[i];
+    double y = anOdometry.getYFeet()[i] - radiusFeet;
+    ASSERT_NEAR(radiusFeet, sqrt(x * x + y * y), 1e-6);
+    ASSERT_NEAR(anOdometry.getDistanceFeet()[i] / radiusFeet,
+                anOdometry.getHeadingRadians()[i], 1e-9);
+  }
+
+  // The move ends close to 225 degrees around the circle, and at the same
+  // pose an ideal motor simulation reaches
+  double x, y, headingDegrees;
+  ASSERT_TRUE(anOdometry.getPose(anOdometry.size() - 1, x, y, headingDegrees));
+  EXPECT_FALSE(anOdometry.getPose(anOdometry.size(), x, y, headingDegrees));
+  EXPECT_NEAR(225, headingDegrees, 0.2);
+  EXPECT_NEAR(radiusFeet * sin(225 * pi / 180), x, 0.05);
+  EXPECT_NEAR(radiusFeet * (1 - cos(225 * pi / 180)), y, 0.05);
+  DriveSimulator aSimulator;
+  aSimulator.configureFromTankDrive(aTankDrive);
+  aSimulator.setSettleTimeS(0);
+  aSimulator.simulate(leftTrajectory, rightTrajectory);
+  EXPECT_NEAR(aSimulator.getXFeet(), x, 1e-6);
+  EXPECT_NEAR(aSimulator.getYFeet(), y, 1e-6);
+  EXPECT_NEAR(aSimulator.getHeadingDegrees(), headingDegrees, 1e-6);
+
+  // A straight move stays on the x axis
+  turnRate.setDegreesPerFoot(0);
+  aTankDrive.generateTrajectories(10, turnRate, velocity, acceleration,
+                                  leftTrajectory, rightTrajectory);
+  EXPECT_TRUE(anOdometry.integrate(leftTrajectory, rightTrajectory));
+  ASSERT_TRUE(anOdometry.getPose(anOdometry.size() - 1, x, y, headingDegrees));
+  EXPECT_NEAR(anOdometry.getDistanceFeet()[anOdometry.size() - 1], x, 1e-9);
+  EXPECT_DOUBLE_EQ(0.0, y);
+  EXPECT_DOUBLE_EQ(0.0, headingDegrees);
+
+  // Without the gearing, no poses can be computed, and none of the
+  // previous ones are left behind
+  anOdometry.setMotorRotPerMovementFoot(0);
+  EXPECT_FALSE(anOdometry.integrate(leftTrajectory, rightTrajectory));
+  EXPECT_EQ(0u, anOdometry.size());
+  EXPECT_TRUE(anOdometry.getXFeet().empty());
+  EXPECT_FALSE(anOdometry.getPose(0, x, y, headingDegrees));
+}
+
+//*********************************************************
+// Test a grid sweep of drive configurations, and that its
+// results do not depend on the number of threads
+//*********************************************************
+TEST(ParameterSweepTest, testGridSweep) {
+  ParameterSweep aSweep;
+  ChassisTurnRate turnRate;
+  turnRate.setDegreesPerFoot(5);
+  ChassisVelocity velocity;
+  velocity.setFeetPerSecond(10);
+  ChassisAcceleration acceleration;
+  acceleration.setFeetPerSecondPerSecond(10);
+  aSweep.setMove(10, turnRate, velocity, acceleration);
+  DCMotorModel aMotor;
+  aMotor.setTimeConstantS(0.05);
+  aSweep.setMotorModel(aMotor);
+
+  // With one rotation per foot, 60 RPM is 1 foot per second
+  aSweep.setMaxVelocityRange(120, 360, 3);
+  aSweep.setMaxAccelerationRange(120, 240, 2);
+  aSweep.setMotorRotPerMovementFootRange(1, 1, 1);
+  aSweep.setIterationPeriodRange(10, 20, 2);
+  aSweep.setWidthRange(2, 2, 1);
+  aSweep.generateGrid();
+  ASSERT_EQ(12u, aSweep.size());
+  EXPECT_DOUBLE_EQ(120, aSweep.getMaxVelocityRPM()[0]);
+  EXPECT_DOUBLE_EQ(240, aSweep.getMaxVelocityRPM()[4]);
+  EXPECT_DOUBLE_EQ(360, aSweep.getMaxVelocityRPM()[11]);
+  EXPECT_DOUBLE_EQ(240, aSweep.getMaxAccelerationRPMpS()[2]);
+  EXPECT_EQ(10u, aSweep.getIterationPeriodMS()[0]);
+  EXPECT_EQ(20u, aSweep.getIterationPeriodMS()[1]);
+  EXPECT_DOUBLE_EQ(2, aSweep.getWidthFeet()[5]);
+
+  // A configuration's move is short if it is too short to reach its maximum
+  // velocity (fewer steps at speed, N, than the first filter's length, FL1),
+  // a profile the trajectory generator does not handle
+  std::vector<bool> shortMove(aSweep.size());
+  unsigned int shortMoveCount = 0;
+  for (unsigned int i = 0; i < aSweep.size(); i++) {
+    TankDrive aTankDrive;
+    aTankDrive.setMaxVelocity(MotorVelocity::fromRotationsPerMinute(
+        aSweep.getMaxVelocityRPM()[i]));
+    aTankDrive.setMaxAcceleration(
+        MotorAcceleration::fromRotationsPerMinutePerSecond(
+            aSweep.getMaxAccelerationRPMpS()[i]));
+    aTankDrive.setMotorRotPerMovementFoot(
+        aSweep.getMotorRotPerMovementFoot()[i]);
+    aTankDrive.setTrajectoryIterationPeriodMS(aSweep.getIterationPeriodMS()[i]);
+    aTankDrive.setWidthInFeet(aSweep.getWidthFeet()[i]);
+    Trajectory leftTrajectory, rightTrajectory;
+    aTankDrive.generateTrajectories(10, turnRate, velocity, acceleration,
+                                    leftTrajectory, rightTrajectory);
+    shortMove[i] = leftTrajectory.getAlgoNcount()
+        < leftTrajectory.getAlgoFL1count();
+    if (shortMove[i])
+      shortMoveCount++;
+  }
+  EXPECT_GT(shortMoveCount, 0u);
+  EXPECT_LT(shortMoveCount, aSweep.size());
+
+  aSweep.run(1);
+  std::vector<double> moveTimeS = aSweep.getMoveTimeS();
+  std::vector<double> endpointErrorFeet = aSweep.getEndpointErrorFeet();
+  for (unsigned int i = 0; i < aSweep.size(); i++) {
+    // Every move takes time and stays within the configuration's
+    // acceleration limit
+    EXPECT_GT(moveTimeS[i], 0.0);
+    EXPECT_LE(aSweep.getPeakAccelerationFPSS()[i],
+              aSweep.getMaxAccelerationRPMpS()[i] / 60 * 1.01);
+    // and ends near the end of the requested arc, except for short moves
+    if (shortMove[i]) {
+      EXPECT_GT(endpointErrorFeet[i], 1.0) << "configuration " << i;
+    } else {
+      EXPECT_LT(endpointErrorFeet[i], 0.1) << "configuration " << i;
+    }
+    EXPECT_GT(aSweep.getMaxTrackingErrorFeet()[i], 0.0);
+    // A drive that differs only by being faster makes the same move sooner
+    for (unsigned int j = 0; j < aSweep.size(); j++) {
+      if (aSweep.getMaxVelocityRPM()[j] < aSweep.getMaxVelocityRPM()[i]
+          && aSweep.getMaxAccelerationRPMpS()[j]
+              == aSweep.getMaxAccelerationRPMpS()[i]
+          && aSweep.getMotorRotPerMovementFoot()[j]
+              == aSweep.getMotorRotPerMovementFoot()[i]
+          && aSweep.getIterationPeriodMS()[j]
+              == aSweep.getIterationPeriodMS()[i]
+          && aSweep.getWidthFeet()[j] == aSweep.getWidthFeet()[i]) {
+        EXPECT_LT(moveTimeS[i], moveTimeS[j]) << "configurations " << i
+                                              << ", " << j;
+      }
+    }
+  }
+
+  // The fastest configuration has the highest velocity and acceleration
+  unsigned int fastest;
+  ASSERT_TRUE(aSweep.getFastest(0.1, fastest));
+  EXPECT_DOUBLE_EQ(360, aSweep.getMaxVelocityRPM()[fastest]);
+  EXPECT_DOUBLE_EQ(240, aSweep.getMaxAccelerationRPMpS()[fastest]);
+  EXPECT_FALSE(aSweep.getFastest(-1, fastest));
+
+  // Running on several threads gives identical results
+  aSweep.run(3);
+  for (unsigned int i = 0; i < aSweep.size(); i++) {
+    EXPECT_DOUBLE_EQ(moveTimeS[i], aSweep.getMoveTimeS()[i]);
+    EXPECT_DOUBLE_EQ(endpointErrorFeet[i], aSweep.getEndpointErrorFeet()[i]);
+  }
+}
+
+//*********************************************************
+// Test that random sweeps are reproducible and in range
+//*********************************************************
+TEST(ParameterSweepTest, testRandomSweep) {
+  ParameterSweep aSweep;
+  aSweep.setMaxVelocityRange(120, 360, 1);
+  aSweep.setMaxAccelerationRange(120, 240, 1);
+  aSweep.setMotorRotPerMovementFootRange(1, 2, 1);
+  aSweep.setIterationPeriodRange(5, 20, 1);
+  aSweep.setWidthRange(1.5, 3, 1);
+  aSweep.generateRandom(50, 808);
+  ASSERT_EQ(50u, aSweep.size());
+  std::vector<double> maxVelocityRPM = aSweep.getMaxVelocityRPM();
+  for (unsigned int i = 0; i < aSweep.size(); i++) {
+    EXPECT_GE(maxVelocityRPM[i], 120);
+    EXPECT_LE(maxVelocityRPM[i], 360);
+    EXPECT_GE(aSweep.getIterationPeriodMS()[i], 5u);
+    EXPECT_LE(aSweep.getIterationPeriodMS()[i], 20u);
+    EXPECT_GE(aSweep.getWidthFeet()[i], 1.5);
+    EXPECT_LE(aSweep.getWidthFeet()[i], 3);
+  }
+  EXPECT_NE(maxVelocityRPM[0], maxVelocityRPM[1]);
+
+  // The same seed lays out the same configurations
+  aSweep.generateRandom(50, 808);
+  for (unsigned int i = 0; i < aSweep.size(); i++)
+    EXPECT_DOUBLE_EQ(maxVelocityRPM[i], aSweep.getMaxVelocityRPM()[i]);
+}
+
+//*********************************************************
+// Helper: a clock that advances 2 microseconds each time it
+// is read, for timing follower ticks deterministically
+//*********************************************************
+static long steppingClockNS() {
+  static long nowNS = 0;
+  nowNS += 2000;
+  return nowNS;
+}
+
+//*********************************************************
+// Helper: follow a trajectory with a simulated motor in a
+// closed loop at 1 kHz, returning the worst position error
+//*********************************************************
+static double followTrajectory(Trajectory &trajectory,
+                               TrajectoryFollower &follower) {
+  DCMotorModel aMotor;
+  aMotor.setTimeConstantS(0.1);
+  follower.reset();
+  double worstErrorRot = 0.0;
+  TrajectoryPoint setpoint;
+  MotorVelocity command;
+  for (unsigned int i = 0; i < trajectory.size(); i++) {
+    trajectory.getTrajectoryPoint(i, setpoint);
+    MotorPosition measuredPosition = aMotor.getPosition();
+    command.setRotationsPerMinute(
+        follower.calculate(setpoint, measuredPosition));
+    worstErrorRot = std::max(worstErrorRot,
+                             std::fabs(follower.getLastError()));
+    aMotor.setCommandedVelocity(command);
+    aMotor.step(0.001);
+  }
+  return worstErrorRot;
+}
+
+//*********************************************************
+// Test that feedforward plus PID follows a trajectory more
+// closely than velocity feedforward alone, and that ticks
+// over their cost budget are counted
+//*********************************************************
+TEST(TrajectoryFollowerTest, testFollowingWithinBudget) {
+  // 20 rotations at up to 600 RPM, accelerating at up to 1200 RPM/s
+  Path aPath;
+  PathPoint firstPathPoint, secondPathPoint;
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(600);
+  firstPathPoint.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(1200);
+  firstPathPoint.setMaxAcceleration(maxAcceleration);
+  aPath.addPathPoint(firstPathPoint);
+  MotorPosition endPosition;
+  endPosition.setRotations(20);
+  secondPathPoint.setPosition(endPosition);
+  aPath.addPathPoint(secondPathPoint);
+  Trajectory aTrajectory;
+  aTrajectory.generate(aPath, 1);
+
+  // The motor is velocity commanded in RPM, so velocity feedforward is 1
+  TrajectoryFollower aFollower;
+  aFollower.setIterationPeriodMS(1);
+  EXPECT_EQ(1u, aFollower.getIterationPeriodMS());
+  aFollower.setFeedforwardGains(1, 0);
+  double velocityOnlyErrorRot = followTrajectory(aTrajectory, aFollower);
+  EXPECT_EQ(aTrajectory.size(), aFollower.getTickCount());
+  EXPECT_EQ(0, aFollower.getWorstTickNS());
+
+  // Acceleration feedforward of the motor's time constant cancels its lag,
+  // and PID feedback cleans up what is left
+  aFollower.setFeedforwardGains(1, 0.1);
+  aFollower.setPIDGains(600, 60, 1);
+  aFollower.setIntegralLimit(1000);
+  aFollower.setOutputLimit(1200);
+  aFollower.setTickBudgetUS(1000);
+  EXPECT_EQ(1000u, aFollower.getTickBudgetUS());
+  double fullErrorRot = followTrajectory(aTrajectory, aFollower);
+  EXPECT_GT(velocityOnlyErrorRot, 0.5);
+  EXPECT_LT(fullErrorRot, velocityOnlyErrorRot / 10);
+  EXPECT_EQ(aTrajectory.size(), aFollower.getTickCount());
+
+  // With a clock that advances 2 us each time it is read, every tick costs
+  // 2 us: within a 3 us budget, and over a 1 us budget
+  aFollower.setClock(steppingClockNS);
+  aFollower.setTickBudgetUS(3);
+  followTrajectory(aTrajectory, aFollower);
+  EXPECT_EQ(2000, aFollower.getWorstTickNS());
+  EXPECT_EQ(0u, aFollower.getBudgetOverrunCount());
+  aFollower.setTickBudgetUS(1);
+  followTrajectory(aTrajectory, aFollower);
+  EXPECT_EQ(2000, aFollower.getWorstTickNS());
+  EXPECT_EQ(aTrajectory.size(), aFollower.getBudgetOverrunCount());
+
+  // Without a budget, ticks are not timed
+  aFollower.setTickBudgetUS(0);
+  followTrajectory(aTrajectory, aFollower);
+  EXPECT_EQ(0, aFollower.getWorstTickNS());
+  EXPECT_EQ(0u, aFollower.getBudgetOverrunCount());
+  aFollower.setClock(nullptr);
+}
+
+//*********************************************************
+// Helper: configure a chassis with the demo tank drive
+//*********************************************************
+static void configureFleetChassis(Chassis &chassis, const std::string &name,
+                                  const double widthFeet) {
+  TankDrive aTankDrive;
+  MotorVelocity maxVelocity;
+  maxVelocity.setRotationsPerMinute(4250);
+  aTankDrive.setMaxVelocity(maxVelocity);
+  MotorAcceleration maxAcceleration;
+  maxAcceleration.setRotationsPerMinutePerSecond(5100);
+  aTankDrive.setMaxAcceleration(maxAcceleration);
+  aTankDrive.setMotorRotPerMovementFoot(850);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  aTankDrive.setWidthInFeet(widthFeet);
+  chassis.setName(name);
+  chassis.setDriveSystem(aTankDrive);
+  return;
+}
+
+//*********************************************************
+// Test that a fleet is planned concurrently into isolated
+// buffers and uniquely named output files
+//*********************************************************
+TEST(FleetPlannerTest, testPlanning) {
+  // Two of the three chassis have the same name
+  std::vector<Chassis> chassis(3);
+  configureFleetChassis(chassis[0], "Twin", 2.0);
+  configureFleetChassis(chassis[1], "Twin", 2.5);
+  configureFleetChassis(chassis[2], "Solo", 3.0);
+
+  FleetPlanner aPlanner;
+  EXPECT_EQ(0u, aPlanner.getChassisCount());
+  for (auto &aChassis : chassis)
+    aPlanner.addChassis(aChassis);
+  ASSERT_EQ(3u, aPlanner.getChassisCount());
+
+  ChassisTurnRate turnRate;
+  ChassisVelocity velocity;
+  velocity.setFeetPerSecond(3);
+  ChassisAcceleration acceleration;
+  acceleration.setFeetPerSecondPerSecond(2);
+  for (unsigned int c = 0; c < 3; c++) {
+    turnRate.setDegreesPerFoot(5);
+    EXPECT_TRUE(aPlanner.addMove(c, 6, turnRate, velocity, acceleration));
+    turnRate.setDegreesPerFoot(-10.0 * c);
+    EXPECT_TRUE(aPlanner.addMove(c, 4, turnRate, velocity, acceleration));
+  }
+  EXPECT_FALSE(aPlanner.addMove(3, 4, turnRate, velocity, acceleration));
+  EXPECT_EQ(2u, aPlanner.getMoveCount(1));
+  EXPECT_EQ(0u, aPlanner.getMoveCount(3));
+  EXPECT_EQ(nullptr, aPlanner.getLeftTrajectory(0, 2));
+  EXPECT_EQ(nullptr, aPlanner.getRightTrajectory(3, 0));
+
+  aPlanner.setOutputDirectory(".");
+  EXPECT_EQ(".", aPlanner.getOutputDirectory());
+  aPlanner.plan(2);
+
+  // Every move matches the same move generated by its own chassis
+  Trajectory leftTrajectory, rightTrajectory;
+  TrajectoryPoint plannedPoint, expectedPoint;
+  for (unsigned int c = 0; c < 3; c++) {
+    for (unsigned int m = 0; m < 2; m++) {
+      turnRate.setDegreesPerFoot(m == 0 ? 5 : -10.0 * c);
+      chassis[c].generateMove(m == 0 ? 6 : 4, turnRate, velocity,
+                              acceleration, leftTrajectory, rightTrajectory);
+      const Trajectory *plannedLeft = aPlanner.getLeftTrajectory(c, m);
+      const Trajectory *plannedRight = aPlanner.getRightTrajectory(c, m);
+      ASSERT_NE(nullptr, plannedLeft);
+      ASSERT_NE(nullptr, plannedRight);
+      ASSERT_EQ(leftTrajectory.size(), plannedLeft->size());
+      ASSERT_EQ(rightTrajectory.size(), plannedRight->size());
+      plannedRight->getTrajectoryPoint(plannedRight->size() - 1,
+                                       plannedPoint);
+      rightTrajectory.getTrajectoryPoint(rightTrajectory.size() - 1,
+                                         expectedPoint);
+      EXPECT_DOUBLE_EQ(expectedPoint.getPosition().getRotations(),
+                       plannedPoint.getPosition().getRotations());
+    }
+  }
+
+  // Each chassis's output has its own file, even with the same name
+  std::string twinZero = aPlanner.getOutputFileName(0, 1, "left");
+  std::string twinOne = aPlanner.getOutputFileName(1, 1, "left");
+  EXPECT_NE(twinZero, twinOne);
+  for (unsigned int c = 0; c < 3; c++)
+    for (unsigned int m = 0; m < 2; m++)
+      for (const std::string side : { "left", "right" }) {
+        std::string fileName = aPlanner.getOutputFileName(c, m, side);
+        std::ifstream outputFile(fileName);
+        EXPECT_TRUE(outputFile.good()) << fileName;
+        outputFile.close();
+        std::remove(fileName.c_str());
+      }
+}
+
+//*********************************************************
+// Test that fleets of 1, 10, 100, and 1000 chassis are
+// planned completely (their timing is in mcsf-bench)
+//*********************************************************
+TEST(FleetPlannerTest, testScaling) {
+  ChassisTurnRate turnRate;
+  turnRate.setDegreesPerFoot(5);
+  ChassisVelocity velocity;
+  velocity.setFeetPerSecond(3);
+  ChassisAcceleration acceleration;
+  acceleration.setFeetPerSecondPerSecond(2);
+
+  unsigned int fleetSize = 1;
+  for (unsigned int run = 0; run < 4; run++, fleetSize *= 10) {
+    std::vector<Chassis> chassis(fleetSize);
+    FleetPlanner aPlanner;
+    for (unsigned int c = 0; c < fleetSize; c++) {
+      configureFleetChassis(chassis[c], "Robot", 2.0 + 0.001 * c);
+      aPlanner.addChassis(chassis[c]);
+      aPlanner.addMove(c, 10, turnRate, velocity, acceleration);
+    }
+    aPlanner.plan();
+    for (unsigned int c = 0; c < fleetSize; c++) {
+      ASSERT_GT(aPlanner.getLeftTrajectory(c, 0)->size(), 0u);
+      ASSERT_GT(aPlanner.getRightTrajectory(c, 0)->size(), 0u);
+    }
+  }
+}
+
+//*********************************************************
+// Test generating a long, finely sampled trajectory (its
+// generation time is in mcsf-bench)
+//*********************************************************
+TEST(TrajectoryTest, testLongGeneration) {
+  Path aPath;
+  PathPoint firstPathPoint, secondPathPoint;
+  firstPathPoint.setMaxVelocity(MotorVelocity::fromRotationsPerMinute(600));
+  firstPathPoint.setMaxAcceleration(
+      MotorAcceleration::fromRotationsPerMinutePerSecond(1200));
+  aPath.addPathPoint(firstPathPoint);
+  secondPathPoint.setPosition(MotorPosition::fromRotations(200));
+  aPath.addPathPoint(secondPathPoint);
+
+  Trajectory aTrajectory;
+  aTrajectory.generate(aPath, 1);
+  EXPECT_EQ(20750u, aTrajectory.size());
+  aTrajectory.generate(aPath, 1);
+  EXPECT_EQ(20750u, aTrajectory.size());
+}
+
+//*********************************************************
+// Test looking up and interpolating trajectory points by time
+//*********************************************************
+TEST(TrajectoryTest, testInterpolationByTime) {
+  Trajectory aTrajectory;
+  MotorPosition position;
+  MotorVelocity velocity;
+  EXPECT_EQ(0u, aTrajectory.getIndexAtTime(0.5));
+  EXPECT_FALSE(aTrajectory.interpolateLinear(0.5, position, velocity));
+  EXPECT_FALSE(aTrajectory.interpolateHermite(0.5, position, velocity));
+
+  // Motion sampled every 10 ms with position t * t * t and velocity
+  // 3 * t * t (a cubic, which the Hermite spline follows exactly)
+  std::vector<double> positionRotations, velocityRPS;
+  for (unsigned int i = 0; i <= 100; i++) {
+    const double t = i * 0.01;
+    positionRotations.push_back(t * t * t);
+    velocityRPS.push_back(3 * t * t);
+  }
+  ASSERT_TRUE(aTrajectory.generateFromSamples(positionRotations, velocityRPS,
+                                              10));
+  EXPECT_DOUBLE_EQ(1.0, aTrajectory.getDurationS());
+  EXPECT_EQ(0u, aTrajectory.getIndexAtTime(-1));
+  EXPECT_EQ(0u, aTrajectory.getIndexAtTime(0.0099));
+  EXPECT_EQ(1u, aTrajectory.getIndexAtTime(0.01));
+  EXPECT_EQ(29u, aTrajectory.getIndexAtTime(0.29));
+  EXPECT_EQ(57u, aTrajectory.getIndexAtTime(0.5749));
+  EXPECT_EQ(100u, aTrajectory.getIndexAtTime(1.0));
+  EXPECT_EQ(100u, aTrajectory.getIndexAtTime(7.0));
+
+  // Follow the trajectory at 1 kHz: the Hermite spline reproduces the cubic,
+  // and linear interpolation stays within its error bound (a quarter period
+  // squared times the largest acceleration, 6 rot/s/s, over 2)
+  double worstLinearError = 0;
+  for (unsigned int ms = 0; ms <= 1000; ms++) {
+    const double t = ms / 1000.0;
+    ASSERT_TRUE(aTrajectory.interpolateHermite(t, position, velocity));
+    EXPECT_NEAR(t * t * t, position.getRotations(), 1e-12);
+    EXPECT_NEAR(3 * t * t, velocity.getRotationsPerSecond(), 1e-9);
+    ASSERT_TRUE(aTrajectory.interpolateLinear(t, position, velocity));
+    worstLinearError = std::max(worstLinearError,
+                                std::fabs(t * t * t - position.getRotations()));
+  }
+  EXPECT_LT(worstLinearError, 0.01 * 0.01 / 8 * 6 + 1e-12);
+  EXPECT_GT(worstLinearError, 0);
+
+  // Outside the trajectory the end points are given
+  EXPECT_FALSE(aTrajectory.interpolateHermite(1.5, position, velocity));
+  EXPECT_DOUBLE_EQ(1.0, position.getRotations());
+  EXPECT_DOUBLE_EQ(3.0, velocity.getRotationsPerSecond());
+  EXPECT_FALSE(aTrajectory.interpolateLinear(-0.5, position, velocity));
+  EXPECT_DOUBLE_EQ(0.0, position.getRotations());
+
+  // A generated trajectory's points are found at their own times
+  Path aPath;
+  aPath.emplacePathPoint(MotorPosition(),
+                         MotorVelocity::fromRotationsPerMinute(600),
+                         MotorAcceleration::fromRotationsPerMinutePerSecond(
+                             1200));
+  aPath.emplacePathPoint(MotorPosition::fromRotations(20), MotorVelocity(),
+                         MotorAcceleration());
+  aTrajectory.generate(aPath, 10);
+  const auto &points = aTrajectory.getTrajectoryPoints();
+  for (unsigned int i = 0; i < points.size(); i++) {
+    EXPECT_EQ(i, aTrajectory.getIndexAtTime(points[i].getTimeS()));
+    ASSERT_TRUE(aTrajectory.interpolateHermite(points[i].getTimeS(), position,
+                                               velocity));
+    EXPECT_DOUBLE_EQ(points[i].getPosition().getRotations(),
+                     position.getRotations());
+  }
+}
+
+//*********************************************************
+// Test that duration estimates match generated trajectories
+// across a grid of distances, limits, and iteration periods
+//*********************************************************
+TEST(TrajectoryTest, testEstimateDuration) {
+  unsigned int pointCount;
+  double durationS;
+  Path aPath;
+  EXPECT_FALSE(Trajectory::estimateDuration(aPath, 10, pointCount,
+                                            durationS));
+
+  const double distances[] = { 0, 0.3, 1, 7.5, 15.7 };
+  const double velocitiesRPM[] = { 120, 600, 4250 };
+  const double accelerationsRPMpS[] = { 100, 1200, 51000 };
+  const unsigned int periodsMS[] = { 2, 5, 10, 20 };
+  unsigned int comparisons = 0;
+  Trajectory aTrajectory;
+  for (const double distance : distances) {
+    for (const double velocityRPM : velocitiesRPM) {
+      for (const double accelerationRPMpS : accelerationsRPMpS) {
+        for (const unsigned int periodMS : periodsMS) {
+          aPath = Path();
+          aPath.emplacePathPoint(
+              MotorPosition(), MotorVelocity::fromRotationsPerMinute(
+                  velocityRPM),
+              MotorAcceleration::fromRotationsPerMinutePerSecond(
+                  accelerationRPMpS));
+          aPath.emplacePathPoint(MotorPosition::fromRotations(distance),
+                                 MotorVelocity(), MotorAcceleration());
+          ASSERT_TRUE(Trajectory::estimateDuration(aPath, periodMS, pointCount,
+                                                   durationS));
+          aTrajectory.generate(aPath, periodMS);
+          ASSERT_EQ(aTrajectory.size(), pointCount) << distance << " rot, "
+              << velocityRPM << " rpm, " << accelerationRPMpS << " rpm/s, "
+              << periodMS << " ms";
+          EXPECT_NEAR(aTrajectory.getTrajectoryPoints().back().getTimeS(),
+                      durationS, 1e-9);
+          comparisons++;
+        }
+      }
+    }
+  }
+  EXPECT_EQ(5u * 3 * 3 * 4, comparisons);
+
+  // Paths the generator cannot run are reported as infeasible: reaching
+  // 60 rpm at 51000 rpm/s leaves no Filter 2 lookback (so the generator
+  // would not finish), and no velocity never gets anywhere
+  aPath = Path();
+  aPath.emplacePathPoint(MotorPosition(),
+                         MotorVelocity::fromRotationsPerMinute(60),
+                         MotorAcceleration::fromRotationsPerMinutePerSecond(
+                             51000));
+  aPath.emplacePathPoint(MotorPosition::fromRotations(10), MotorVelocity(),
+                         MotorAcceleration());
+  EXPECT_FALSE(Trajectory::estimateDuration(aPath, 10, pointCount,
+                                            durationS));
+  aPath = Path();
+  aPath.emplacePathPoint(MotorPosition(), MotorVelocity(),
+                         MotorAcceleration::fromRotationsPerMinutePerSecond(
+                             1200));
+  aPath.emplacePathPoint(MotorPosition::fromRotations(10), MotorVelocity(),
+                         MotorAcceleration());
+  EXPECT_FALSE(Trajectory::estimateDuration(aPath, 10, pointCount,
+                                            durationS));
+  EXPECT_EQ(0u, pointCount);
+}
+
+//*********************************************************
+// Test loading an occupancy grid from a file
+//*********************************************************
+TEST(OccupancyGridTest, testLoadFromFile) {
+  const std::string gridFileName = "MCSFtest-grid.txt";
+  {
+    std::ofstream gridFile(gridFileName);
+    gridFile << "# A small field map" << std::endl << "5 3 0.5" << std::endl
+             << "..#.." << std::endl << "..#" << std::endl << "....."
+             << std::endl;
+  }
+  OccupancyGrid aGrid;
+  ASSERT_TRUE(aGrid.loadFromFile(gridFileName));
+  std::remove(gridFileName.c_str());
+  EXPECT_EQ(5u, aGrid.getWidth());
+  EXPECT_EQ(3u, aGrid.getHeight());
+  EXPECT_EQ(15u, aGrid.getCellCount());
+  EXPECT_DOUBLE_EQ(0.5, aGrid.getCellSizeFeet());
+  EXPECT_TRUE(aGrid.isOccupied(2, 0));
+  EXPECT_TRUE(aGrid.isOccupied(2, 1));
+  EXPECT_FALSE(aGrid.isOccupied(4, 1));  // past the end of a short row
+  EXPECT_FALSE(aGrid.isOccupied(2, 2));
+  EXPECT_TRUE(aGrid.isOccupied(5, 0));   // off the grid
+  EXPECT_EQ(7u, aGrid.cellIndex(2, 1));
+  EXPECT_EQ(2u, aGrid.cellColumn(7));
+  EXPECT_EQ(1u, aGrid.cellRow(7));
+
+  // A missing file or a truncated grid is not loaded
+  EXPECT_FALSE(aGrid.loadFromFile("MCSFtest-no-such-grid.txt"));
+  {
+    std::ofstream gridFile(gridFileName);
+    gridFile << "5 3 0.5" << std::endl << "....." << std::endl;
+  }
+  EXPECT_FALSE(aGrid.loadFromFile(gridFileName));
+  std::remove(gridFileName.c_str());
+}
+
+//*********************************************************
+// Test planning routes around obstacles on a grid
+//*********************************************************
+TEST(GridPlannerTest, testPlanAroundObstacle) {
+  // A 10 x 10 grid of 1 foot cells with a wall down column 5, open only
+  // at row 9
+  OccupancyGrid aGrid;
+  aGrid.resize(10, 10, 1.0);
+  aGrid.setOccupiedRectangle(5, 0, 1, 9, true);
+  GridPlanner aPlanner;
+  std::vector<unsigned int> routeCells;
+
+  // No grid, no route
+  EXPECT_FALSE(aPlanner.plan(0, 0, 9, 0, routeCells));
+  aPlanner.setGrid(aGrid);
+
+  // An open straight line is planned directly
+  ASSERT_TRUE(aPlanner.plan(0, 0, 4, 0, routeCells));
+  EXPECT_EQ(5u, routeCells.size());
+  EXPECT_DOUBLE_EQ(4.0, aPlanner.getRouteCostFeet());
+
+  // Across the wall, the route goes through the gap at row 9: down to
+  // (4, 9) (4 diagonal and 5 straight moves; it cannot cut the corner of
+  // the wall), across to (6, 9), and back up to (9, 0) (3 diagonal and 6
+  // straight moves)
+  ASSERT_TRUE(aPlanner.plan(0, 0, 9, 0, routeCells));
+  EXPECT_EQ(aGrid.cellIndex(0, 0), routeCells.front());
+  EXPECT_EQ(aGrid.cellIndex(9, 0), routeCells.back());
+  for (auto cell : routeCells)
+    EXPECT_FALSE(aGrid.isOccupiedIndex(cell));
+  EXPECT_NEAR(4 * std::sqrt(2.0) + 5 + 2 + 3 * std::sqrt(2.0) + 6,
+              aPlanner.getRouteCostFeet(), 1e-9);
+  unsigned int firstExpandedCount = aPlanner.getExpandedCount();
+  EXPECT_GT(firstExpandedCount, routeCells.size() - 1);
+
+  // Planning again re-uses the search buffers and finds the same route
+  std::vector<unsigned int> replannedCells;
+  ASSERT_TRUE(aPlanner.plan(0, 0, 9, 0, replannedCells));
+  EXPECT_EQ(routeCells, replannedCells);
+  EXPECT_EQ(firstExpandedCount, aPlanner.getExpandedCount());
+
+  // Closing the gap leaves no route; occupied ends have no route either
+  aGrid.setOccupied(5, 9, true);
+  EXPECT_FALSE(aPlanner.plan(0, 0, 9, 0, routeCells));
+  EXPECT_TRUE(routeCells.empty());
+  EXPECT_FALSE(aPlanner.plan(5, 0, 9, 0, routeCells));
+}
+
+//*********************************************************
+// Test planning a route's path across a full field map
+//*********************************************************
+TEST(RouteTest, testGridPath) {
+  // A 54 x 27 foot field in 2 inch cells, with a long barrier across the
+  // middle and a block near the far end
+  OccupancyGrid aGrid;
+  const double cellFeet = 2.0 / 12;
+  aGrid.resize(324, 162, cellFeet);
+  aGrid.setOccupiedRectangle(160, 0, 4, 140, true);
+  aGrid.setOccupiedRectangle(250, 40, 30, 122, true);
+  GridPlanner aPlanner;
+  aPlanner.setGrid(aGrid);
+
+  Route aRoute;
+  aRoute.addGridWayPoint(10, 10);
+  aRoute.addGridWayPoint(150, 10);
+  aRoute.addGridWayPoint(300, 150);
+  EXPECT_EQ(3u, aRoute.getGridWayPointCount());
+
+  // Plan it twice into the same path (its planning time is in mcsf-bench)
+  const double rotPerFoot = 850;
+  MotorVelocity maxVelocity = MotorVelocity::fromRotationsPerMinute(4250);
+  MotorAcceleration maxAcceleration =
+      MotorAcceleration::fromRotationsPerMinutePerSecond(5100);
+  Path aPath;
+  std::vector<unsigned int> cornerCells;
+  for (unsigned int i = 0; i < 2; i++)
+    ASSERT_TRUE(aRoute.planGridPath(aPlanner, rotPerFoot, maxVelocity,
+                                    maxAcceleration, aPath, cornerCells));
+
+  // The path has a point at each corner, from the start to the goal, at
+  // the distance along the route (which goes around both obstacles)
+  ASSERT_EQ(cornerCells.size(), aPath.size());
+  ASSERT_GE(aPath.size(), 4u);
+  EXPECT_EQ(aGrid.cellIndex(10, 10), cornerCells.front());
+  EXPECT_EQ(aGrid.cellIndex(300, 150), cornerCells.back());
+  EXPECT_DOUBLE_EQ(0.0, aPath[0].getPosition().getRotations());
+  double routeFeet = aPath[aPath.size() - 1].getPosition().getRotations()
+      / rotPerFoot;
+  EXPECT_GT(routeFeet, 140 * cellFeet + 150 * std::sqrt(2.0) * cellFeet);
+  for (unsigned int i = 1; i < aPath.size(); i++) {
+    EXPECT_GT(aPath[i].getPosition().getRotations(),
+              aPath[i - 1].getPosition().getRotations());
+    EXPECT_DOUBLE_EQ(4250, aPath[i].getMaxVelocity().getRotationsPerMinute());
+  }
+  EXPECT_FALSE(aGrid.isOccupiedIndex(cornerCells[1]));
+
+  // A route that cannot be planned gives no path
+  Route blockedRoute;
+  blockedRoute.addGridWayPoint(10, 10);
+  blockedRoute.addGridWayPoint(260, 100);
+  EXPECT_FALSE(blockedRoute.planGridPath(aPlanner, rotPerFoot, maxVelocity,
+                                         maxAcceleration, aPath,
+                                         cornerCells));
+  EXPECT_EQ(0u, aPath.size());
+}
+
+//*********************************************************
+// Test that repaired routes match fresh searches as the map changes
+//*********************************************************
+TEST(IncrementalGridPlannerTest, testReplanMatchesSearch) {
+  // A 40 x 30 cell field with a scattering of single-cell obstacles
+  OccupancyGrid aGrid;
+  aGrid.resize(40, 30, 0.5);
+  for (unsigned int cell = 0; cell < aGrid.getCellCount(); cell++)
+    if ((cell * 7919u) % 11u == 0)
+      aGrid.setOccupied(aGrid.cellColumn(cell), aGrid.cellRow(cell), true);
+  aGrid.setOccupied(1, 1, false);
+  aGrid.setOccupied(38, 28, false);
+  GridPlanner searchPlanner;
+  searchPlanner.setGrid(aGrid);
+  IncrementalGridPlanner incrementalPlanner;
+  incrementalPlanner.setGrid(aGrid);
+
+  std::vector<unsigned int> searchCells, routeCells;
+  EXPECT_FALSE(incrementalPlanner.update(std::vector<unsigned int>(),
+                                         routeCells));
+  ASSERT_TRUE(searchPlanner.plan(1, 1, 38, 28, searchCells));
+  ASSERT_TRUE(incrementalPlanner.plan(1, 1, 38, 28, routeCells));
+  EXPECT_TRUE(incrementalPlanner.isPlannedFor(1, 1, 38, 28));
+  EXPECT_FALSE(incrementalPlanner.isPlannedFor(1, 2, 38, 28));
+  EXPECT_NEAR(searchPlanner.getRouteCostFeet(),
+              incrementalPlanner.getRouteCostFeet(), 1e-9);
+  EXPECT_EQ(aGrid.cellIndex(1, 1), routeCells.front());
+  EXPECT_EQ(aGrid.cellIndex(38, 28), routeCells.back());
+
+  // Block and clear cells on and beside the current route, a few at a time,
+  // checking the repaired route against a fresh search after each change
+  for (unsigned int change = 0; change < 20; change++) {
+    std::vector<unsigned int> changedCells;
+    for (unsigned int i = 0; i < 3; i++) {
+      const unsigned int routeCell = routeCells[(change * 5 + i * 3)
+          % (routeCells.size() - 2) + 1];
+      const unsigned int cell = (change % 4 == 3) ?
+          changedCells.empty() ? routeCell : routeCell + 1 : routeCell;
+      if (cell >= aGrid.getCellCount())
+        continue;
+      const bool occupied = aGrid.isOccupiedIndex(cell);
+      aGrid.setOccupied(aGrid.cellColumn(cell), aGrid.cellRow(cell),
+                        !occupied);
+      changedCells.push_back(cell);
+    }
+    const bool searchFound = searchPlanner.plan(1, 1, 38, 28, searchCells);
+    ASSERT_EQ(searchFound, incrementalPlanner.update(changedCells,
+                                                     routeCells));
+    if (!searchFound)
+      break;
+    EXPECT_NEAR(searchPlanner.getRouteCostFeet(),
+                incrementalPlanner.getRouteCostFeet(), 1e-9);
+    for (auto cell : routeCells)
+      EXPECT_FALSE(aGrid.isOccupiedIndex(cell));
+  }
+
+  // Moving the start along the route keeps the rest of the search
+  ASSERT_TRUE(incrementalPlanner.update(std::vector<unsigned int>(),
+                                        routeCells));
+  const unsigned int newStart = routeCells[routeCells.size() / 2];
+  const unsigned int startColumn = aGrid.cellColumn(newStart);
+  const unsigned int startRow = aGrid.cellRow(newStart);
+  ASSERT_TRUE(incrementalPlanner.moveStart(startColumn, startRow,
+                                           routeCells));
+  ASSERT_TRUE(searchPlanner.plan(startColumn, startRow, 38, 28, searchCells));
+  EXPECT_NEAR(searchPlanner.getRouteCostFeet(),
+              incrementalPlanner.getRouteCostFeet(), 1e-9);
+  EXPECT_EQ(newStart, routeCells.front());
+
+  // Walling off the goal leaves no route
+  std::vector<unsigned int> wallCells;
+  for (unsigned int row = 0; row < 30; row++) {
+    aGrid.setOccupied(36, row, true);
+    wallCells.push_back(aGrid.cellIndex(36, row));
+  }
+  EXPECT_FALSE(incrementalPlanner.update(wallCells, routeCells));
+  EXPECT_TRUE(routeCells.empty());
+}
+
+//*********************************************************
+// Test the cells expanded re-planning after localized and global map
+// changes
+//*********************************************************
+TEST(IncrementalGridPlannerTest, testLocalizedAndGlobalChanges) {
+  // The full field from the route path test, planned across end to end
+  OccupancyGrid aGrid;
+  aGrid.resize(324, 162, 2.0 / 12);
+  aGrid.setOccupiedRectangle(160, 0, 4, 140, true);
+  aGrid.setOccupiedRectangle(250, 40, 30, 122, true);
+  GridPlanner searchPlanner;
+  searchPlanner.setGrid(aGrid);
+  IncrementalGridPlanner incrementalPlanner;
+  incrementalPlanner.setGrid(aGrid);
+  std::vector<unsigned int> searchCells, routeCells;
+  ASSERT_TRUE(incrementalPlanner.plan(10, 10, 300, 150, routeCells));
+  const unsigned int planExpandedCount = incrementalPlanner.getExpandedCount();
+
+  // A localized change: a small obstacle appears across the route a short
+  // way ahead of the chassis
+  const unsigned int blockedCell = routeCells[12];
+  std::vector<unsigned int> changedCells;
+  for (int row = -1; row <= 1; row++)
+    for (int column = -1; column <= 1; column++) {
+      const unsigned int c = aGrid.cellColumn(blockedCell) + column;
+      const unsigned int r = aGrid.cellRow(blockedCell) + row;
+      aGrid.setOccupied(c, r, true);
+      changedCells.push_back(aGrid.cellIndex(c, r));
+    }
+  ASSERT_TRUE(incrementalPlanner.update(changedCells, routeCells));
+  const unsigned int localExpandedCount =
+      incrementalPlanner.getExpandedCount();
+  ASSERT_TRUE(searchPlanner.plan(10, 10, 300, 150, searchCells));
+  EXPECT_NEAR(searchPlanner.getRouteCostFeet(),
+              incrementalPlanner.getRouteCostFeet(), 1e-9);
+  EXPECT_LT(localExpandedCount * 10, searchPlanner.getExpandedCount());
+  EXPECT_LT(localExpandedCount * 10, planExpandedCount);
+
+  // A global change: the gap past the long barrier closes, and a new one
+  // opens at its far end, so most of the search has to be redone
+  changedCells.clear();
+  for (unsigned int row = 140; row < 162; row++)
+    for (unsigned int column = 160; column < 164; column++) {
+      aGrid.setOccupied(column, row, true);
+      changedCells.push_back(aGrid.cellIndex(column, row));
+    }
+  for (unsigned int row = 0; row < 20; row++)
+    for (unsigned int column = 160; column < 164; column++) {
+      aGrid.setOccupied(column, row, false);
+      changedCells.push_back(aGrid.cellIndex(column, row));
+    }
+  ASSERT_TRUE(incrementalPlanner.update(changedCells, routeCells));
+  ASSERT_TRUE(searchPlanner.plan(10, 10, 300, 150, searchCells));
+  EXPECT_NEAR(searchPlanner.getRouteCostFeet(),
+              incrementalPlanner.getRouteCostFeet(), 1e-9);
+  EXPECT_GT(incrementalPlanner.getExpandedCount(), localExpandedCount * 10);
+}
+
+//*********************************************************
+// Test re-planning a route's path as its field map changes
+//*********************************************************
+TEST(RouteTest, testGridReplan) {
+  OccupancyGrid aGrid;
+  aGrid.resize(60, 40, 0.25);
+  aGrid.setOccupiedRectangle(20, 0, 2, 30, true);
+  GridPlanner aPlanner;
+  aPlanner.setGrid(aGrid);
+  std::vector<IncrementalGridPlanner> legPlanners(1);
+  legPlanners.front().setGrid(aGrid);
+
+  Route aRoute;
+  aRoute.addGridWayPoint(5, 5);
+  aRoute.addGridWayPoint(30, 5);
+  aRoute.addGridWayPoint(55, 35);
+  const double rotPerFoot = 850;
+  MotorVelocity maxVelocity = MotorVelocity::fromRotationsPerMinute(4250);
+  MotorAcceleration maxAcceleration =
+      MotorAcceleration::fromRotationsPerMinutePerSecond(5100);
+  Path searchPath, replannedPath;
+  std::vector<unsigned int> searchCorners, replannedCorners;
+
+  // The first re-plan plans every leg; later ones repair them after changes
+  std::vector<unsigned int> changedCells;
+  for (unsigned int change = 0; change < 3; change++) {
+    ASSERT_TRUE(aRoute.replanGridPath(legPlanners, changedCells, rotPerFoot,
+                                      maxVelocity, maxAcceleration,
+                                      replannedPath, replannedCorners));
+    EXPECT_EQ(2u, legPlanners.size());
+    ASSERT_TRUE(aRoute.planGridPath(aPlanner, rotPerFoot, maxVelocity,
+                                    maxAcceleration, searchPath,
+                                    searchCorners));
+    // Equally short routes may turn at different cells, but are as long
+    ASSERT_EQ(replannedCorners.size(), replannedPath.size());
+    ASSERT_GE(replannedPath.size(), 3u);
+    EXPECT_EQ(searchCorners.front(), replannedCorners.front());
+    EXPECT_EQ(searchCorners.back(), replannedCorners.back());
+    EXPECT_NEAR(
+        searchPath[searchPath.size() - 1].getPosition().getRotations(),
+        replannedPath[replannedPath.size() - 1].getPosition().getRotations(),
+        1e-6);
+
+    // Grow an obstacle across the second leg
+    changedCells.clear();
+    for (unsigned int row = 10 + 5 * change; row < 15 + 5 * change; row++)
+      for (unsigned int column = 35; column < 45; column++) {
+        aGrid.setOccupied(column, row, true);
+        changedCells.push_back(aGrid.cellIndex(column, row));
+      }
+  }
+
+  // Blocking a way point leaves no path
+  aGrid.setOccupied(30, 5, true);
+  changedCells.assign(1, aGrid.cellIndex(30, 5));
+  EXPECT_FALSE(aRoute.replanGridPath(legPlanners, changedCells, rotPerFoot,
+                                     maxVelocity, maxAcceleration,
+                                     replannedPath, replannedCorners));
+  EXPECT_EQ(0u, replannedPath.size());
+}
+
+//*********************************************************
+// Test planning the velocity profile of a straight path
+//*********************************************************
+TEST(VelocityPlannerTest, testStraightProfile) {
+  const double rotPerFoot = 850;
+  MotorVelocity maxVelocity =
+      MotorVelocity::fromChassisVelocityByRotPerMovementFoot(
+          ChassisVelocity::fromFeetPerSecond(10), rotPerFoot);
+  MotorAcceleration maxAcceleration =
+      MotorAcceleration::fromChassisAccelerationByRotPerMovementFoot(
+          ChassisAcceleration::fromFeetPerSecondPerSecond(5), rotPerFoot);
+  VelocityPlanner aPlanner;
+  EXPECT_DOUBLE_EQ(
+      0.0, aPlanner.getMaxLateralAcceleration().getFeetPerSecondPerSecond());
+
+  // Too short to reach the maximum velocity: accelerate to the middle,
+  // then slow down (a triangular profile)
+  Path shortPath;
+  for (unsigned int i = 0; i <= 1000; i++)
+    shortPath.emplacePathPoint(
+        MotorPosition::fromDistanceFeetByRotPerMovementFoot(i * 0.01,
+                                                            rotPerFoot),
+        maxVelocity, maxAcceleration);
+  ASSERT_TRUE(aPlanner.plan(shortPath, std::vector<double>(), rotPerFoot));
+  EXPECT_DOUBLE_EQ(0.0, shortPath[0].getMaxVelocity().getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(0.0,
+                   shortPath[1000].getMaxVelocity().getRotationsPerMinute());
+  EXPECT_NEAR(std::sqrt(2 * 5 * 5.0),
+              shortPath[500].getMaxVelocity()
+                  .getChassisVelocityByRotPerMovementFoot(rotPerFoot)
+                  .getFeetPerSecond(), 1e-9);
+  EXPECT_NEAR(2 * std::sqrt(10 / 5.0),
+              VelocityPlanner::profileTimeSeconds(shortPath), 1e-9);
+
+  // Long enough to cruise: accelerate over 10 feet, cruise 20, slow over 10
+  Path longPath;
+  for (unsigned int i = 0; i <= 4000; i++)
+    longPath.emplacePathPoint(
+        MotorPosition::fromDistanceFeetByRotPerMovementFoot(i * 0.01,
+                                                            rotPerFoot),
+        maxVelocity, maxAcceleration);
+  ASSERT_TRUE(aPlanner.plan(longPath, std::vector<double>(), rotPerFoot));
+  EXPECT_NEAR(10, longPath[2000].getMaxVelocity()
+      .getChassisVelocityByRotPerMovementFoot(rotPerFoot).getFeetPerSecond(),
+              1e-9);
+  EXPECT_NEAR(2 + 20 / 10.0 + 2,
+              VelocityPlanner::profileTimeSeconds(longPath), 1e-9);
+
+  // Curvatures must match the path points
+  EXPECT_FALSE(aPlanner.plan(longPath, std::vector<double>(3, 0.0),
+                             rotPerFoot));
+  EXPECT_FALSE(aPlanner.plan(longPath, std::vector<double>(), 0));
+}
+
+//*********************************************************
+// Test velocity limits from curvature and speed zones
+//*********************************************************
+TEST(VelocityPlannerTest, testCurvatureAndZones) {
+  // 3 feet straight ahead, a quarter turn to the right on a 2 foot radius,
+  // then 3 feet straight on, sampled every 0.01 feet
+  const double radiusFeet = 2.0;
+  const double spacingFeet = 0.01;
+  const double arcFeet = radiusFeet * std::acos(-1.0) / 2;
+  std::vector<double> xFeet, yFeet, distanceFeet;
+  for (double d = 0; d <= 6 + arcFeet + 1e-9; d += spacingFeet) {
+    distanceFeet.push_back(d);
+    if (d <= 3) {
+      xFeet.push_back(d);
+      yFeet.push_back(0);
+    } else if (d <= 3 + arcFeet) {
+      const double angle = (d - 3) / radiusFeet;
+      xFeet.push_back(3 + radiusFeet * std::sin(angle));
+      yFeet.push_back(radiusFeet * (1 - std::cos(angle)));
+    } else {
+      xFeet.push_back(3 + radiusFeet);
+      yFeet.push_back(radiusFeet + d - 3 - arcFeet);
+    }
+  }
+  std::vector<double> curvaturePerFoot;
+  VelocityPlanner::estimateCurvature(xFeet, yFeet, curvaturePerFoot);
+  ASSERT_EQ(xFeet.size(), curvaturePerFoot.size());
+  EXPECT_NEAR(0.0, curvaturePerFoot[100], 1e-9);
+  EXPECT_NEAR(1 / radiusFeet, curvaturePerFoot[400], 1e-3);
+
+  const double rotPerFoot = 850;
+  Path aPath;
+  aPath.reserve(distanceFeet.size());
+  for (auto d : distanceFeet)
+    aPath.emplacePathPoint(
+        MotorPosition::fromDistanceFeetByRotPerMovementFoot(d, rotPerFoot),
+        MotorVelocity::fromChassisVelocityByRotPerMovementFoot(
+            ChassisVelocity::fromFeetPerSecond(10), rotPerFoot),
+        MotorAcceleration::fromChassisAccelerationByRotPerMovementFoot(
+            ChassisAcceleration::fromFeetPerSecondPerSecond(4), rotPerFoot));
+
+  // Turning takes no more than 2 ft/s/s sideways (2 ft/s on the curve), and
+  // the last foot and a half is slowed to 1 ft/s
+  VelocityPlanner aPlanner;
+  aPlanner.setMaxLateralAcceleration(
+      ChassisAcceleration::fromFeetPerSecondPerSecond(2));
+  aPlanner.addSpeedZone(6 + arcFeet, 4.5 + arcFeet,
+                        ChassisVelocity::fromFeetPerSecond(1));
+  EXPECT_EQ(1u, aPlanner.getSpeedZoneCount());
+  ASSERT_TRUE(aPlanner.plan(aPath, curvaturePerFoot, rotPerFoot));
+
+  double fastestFPS = 0;
+  for (unsigned int i = 0; i < aPath.size(); i++) {
+    const double fps = aPath[i].getMaxVelocity()
+        .getChassisVelocityByRotPerMovementFoot(rotPerFoot).getFeetPerSecond();
+    fastestFPS = std::max(fastestFPS, fps);
+    if (distanceFeet[i] > 3.02 && distanceFeet[i] < 2.98 + arcFeet) {
+      EXPECT_LE(fps, std::sqrt(2 * radiusFeet) + 1e-3);
+    }
+    if (distanceFeet[i] >= 4.5 + arcFeet) {
+      EXPECT_LE(fps, 1 + 1e-9);
+    }
+    // No faster change of velocity than the acceleration allows
+    if (i > 0) {
+      const double previousFPS = aPath[i - 1].getMaxVelocity()
+          .getChassisVelocityByRotPerMovementFoot(rotPerFoot)
+          .getFeetPerSecond();
+      EXPECT_LE(std::fabs(fps * fps - previousFPS * previousFPS),
+                2 * 4 * spacingFeet + 1e-6);
+    }
+  }
+  EXPECT_GT(fastestFPS, std::sqrt(2 * radiusFeet) + 0.5);
+  EXPECT_DOUBLE_EQ(0.0, aPath[0].getMaxVelocity().getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(
+      0.0, aPath[aPath.size() - 1].getMaxVelocity().getRotationsPerMinute());
+
+  // Without the limits, the same path is quicker
+  const double limitedSeconds = VelocityPlanner::profileTimeSeconds(aPath);
+  aPlanner.setMaxLateralAcceleration(ChassisAcceleration());
+  aPlanner.clearSpeedZones();
+  for (unsigned int i = 0; i < aPath.size(); i++)
+    aPath[i].setMaxVelocity(
+        MotorVelocity::fromChassisVelocityByRotPerMovementFoot(
+            ChassisVelocity::fromFeetPerSecond(10), rotPerFoot));
+  ASSERT_TRUE(aPlanner.plan(aPath, curvaturePerFoot, rotPerFoot));
+  EXPECT_LT(VelocityPlanner::profileTimeSeconds(aPath), limitedSeconds);
+}
+
+//*********************************************************
+// Test a spline path through pose way points
+//*********************************************************
+TEST(SplinePathTest, testSampleByDistance) {
+  SplinePath aSpline;
+  double x, y, heading, curvature;
+  EXPECT_FALSE(aSpline.sample(0, x, y, heading, curvature));
+
+  // Between two poses on a straight line, the spline is that line
+  std::vector<PoseWayPoint> straight = { PoseWayPoint(0, 0, 0), PoseWayPoint(
+      10, 0, 0) };
+  ASSERT_TRUE(aSpline.generate(straight, 0.01));
+  EXPECT_EQ(1u, aSpline.getSegmentCount());
+  EXPECT_NEAR(10, aSpline.getLengthFeet(), 1e-9);
+  ASSERT_TRUE(aSpline.sample(4, x, y, heading, curvature));
+  EXPECT_NEAR(4, x, 1e-9);
+  EXPECT_NEAR(0, y, 1e-9);
+  EXPECT_NEAR(0, heading, 1e-9);
+  EXPECT_NEAR(0, curvature, 1e-9);
+
+  // A route turning right, then back left, then ahead to a stop
+  Route aRoute;
+  aRoute.addPoseWayPoint(PoseWayPoint(0, 0, 0));
+  aRoute.addPoseWayPoint(PoseWayPoint(6, 3, 45));
+  aRoute.addPoseWayPoint(PoseWayPoint(12, 4, -20));
+  aRoute.addPoseWayPoint(PoseWayPoint(18, 4, 0));
+  EXPECT_EQ(4u, aRoute.getPoseWayPointCount());
+  ASSERT_TRUE(aRoute.planSplinePath(aSpline, 0.01));
+  EXPECT_EQ(3u, aSpline.getSegmentCount());
+  EXPECT_GT(aSpline.getLengthFeet(), std::hypot(18.0, 4.0));
+
+  // It passes through each way point along its heading
+  ASSERT_TRUE(aSpline.sample(0, x, y, heading, curvature));
+  EXPECT_NEAR(0, x, 1e-9);
+  EXPECT_NEAR(0, heading, 1e-9);
+  ASSERT_TRUE(aSpline.sample(aSpline.getLengthFeet(), x, y, heading,
+                             curvature));
+  EXPECT_NEAR(18, x, 1e-6);
+  EXPECT_NEAR(4, y, 1e-6);
+  EXPECT_NEAR(0, heading, 1e-3);
+  EXPECT_FALSE(aSpline.sample(aSpline.getLengthFeet() + 0.1, x, y, heading,
+                              curvature));
+  ASSERT_TRUE(aSpline.sample(0.5, x, y, heading, curvature));
+  EXPECT_GT(curvature, 0);
+
+  // Points sampled a short distance apart along the table are that far
+  // apart on the field, everywhere along the path
+  const double stepFeet = 0.05;
+  double lastX, lastY;
+  ASSERT_TRUE(aSpline.sample(0, lastX, lastY, heading, curvature));
+  for (double d = stepFeet; d <= aSpline.getLengthFeet(); d += stepFeet) {
+    ASSERT_TRUE(aSpline.sample(d, x, y, heading, curvature));
+    EXPECT_NEAR(stepFeet, std::hypot(x - lastX, y - lastY), 1e-4);
+    lastX = x;
+    lastY = y;
+  }
+
+  // A motion path along the spline, with its curvature for velocity planning
+  const double rotPerFoot = 850;
+  Path aPath;
+  std::vector<double> curvaturePerFoot;
+  ASSERT_TRUE(aSpline.planPath(
+      0.05, rotPerFoot, MotorVelocity::fromRotationsPerMinute(4250),
+      MotorAcceleration::fromRotationsPerMinutePerSecond(5100), aPath,
+      curvaturePerFoot));
+  ASSERT_EQ(aPath.size(), curvaturePerFoot.size());
+  EXPECT_NEAR(aSpline.getLengthFeet() * rotPerFoot,
+              aPath[aPath.size() - 1].getPosition().getRotations(), 1e-9);
+  VelocityPlanner aPlanner;
+  aPlanner.setMaxLateralAcceleration(
+      ChassisAcceleration::fromFeetPerSecondPerSecond(3));
+  EXPECT_TRUE(aPlanner.plan(aPath, curvaturePerFoot, rotPerFoot));
+
+  // Too few way points, or two at the same position, give no path
+  Route shortRoute;
+  shortRoute.addPoseWayPoint(PoseWayPoint(1, 1, 0));
+  EXPECT_FALSE(shortRoute.planSplinePath(aSpline, 0.01));
+  shortRoute.addPoseWayPoint(PoseWayPoint(1, 1, 90));
+  EXPECT_FALSE(shortRoute.planSplinePath(aSpline, 0.01));
+  EXPECT_EQ(0u, aSpline.getSegmentCount());
+}
+
+//*********************************************************
+// Test the tank drive's side trajectories for following a spline path
+//*********************************************************
+TEST(TankDriveTest, testPathTrajectories) {
+  TankDrive aTankDrive;
+  aTankDrive.setMaxVelocity(MotorVelocity::fromRotationsPerMinute(4250));
+  aTankDrive.setMaxAcceleration(
+      MotorAcceleration::fromRotationsPerMinutePerSecond(51000));
+  aTankDrive.setMotorRotPerMovementFoot(850);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  aTankDrive.setWidthInFeet(2.75);
+
+  // An S-curve: right, then back left to the starting heading
+  Route aRoute;
+  aRoute.addPoseWayPoint(PoseWayPoint(0, 0, 0));
+  aRoute.addPoseWayPoint(PoseWayPoint(8, 4, 60));
+  aRoute.addPoseWayPoint(PoseWayPoint(14, 10, 0));
+  SplinePath aSpline;
+  ASSERT_TRUE(aRoute.planSplinePath(aSpline, 0.01));
+
+  Trajectory leftTrajectory, rightTrajectory;
+  ASSERT_TRUE(aTankDrive.generatePathTrajectories(
+      aSpline, ChassisVelocity::fromFeetPerSecond(3),
+      ChassisAcceleration::fromFeetPerSecondPerSecond(2), leftTrajectory,
+      rightTrajectory));
+  ASSERT_EQ(leftTrajectory.size(), rightTrajectory.size());
+  ASSERT_GT(leftTrajectory.size(), 2u);
+  EXPECT_EQ(10u, leftTrajectory.getAlgoItPMS());
+
+  // Both sides start and end at rest, neither goes faster than the motors
+  // allow (the limits hold at the planned path points, so between them by
+  // a small margin), and the left side (outside of the first turn) leads
+  // at first
+  const std::vector<TrajectoryPoint> &left =
+      leftTrajectory.getTrajectoryPoints();
+  const std::vector<TrajectoryPoint> &right =
+      rightTrajectory.getTrajectoryPoints();
+  EXPECT_DOUBLE_EQ(0.0, left.front().getVelocity().getRotationsPerMinute());
+  EXPECT_DOUBLE_EQ(0.0, right.back().getVelocity().getRotationsPerMinute());
+  EXPECT_LE(leftTrajectory.getMaxVelocity().getRotationsPerMinute(),
+            4250 * 1.001);
+  EXPECT_LE(rightTrajectory.getMaxVelocity().getRotationsPerMinute(),
+            4250 * 1.001);
+  EXPECT_LE(leftTrajectory.getMaxAcceleration().getRotationsPerMinutePerSecond(),
+            51000 * 1.1);
+  EXPECT_GT(left[left.size() / 4].getPosition().getRotations(),
+            right[right.size() / 4].getPosition().getRotations());
+  for (unsigned int i = 1; i < left.size(); i++)
+    ASSERT_NEAR(left[i].getTimeS() - left[i - 1].getTimeS(), 0.01, 1e-9);
+
+  // Dead reckoning the two sides' motion ends at the last way point
+  Odometry anOdometry;
+  anOdometry.configureFromTankDrive(aTankDrive);
+  anOdometry.integrate(leftTrajectory, rightTrajectory);
+  double x, y, headingDegrees;
+  ASSERT_TRUE(anOdometry.getPose(anOdometry.size() - 1, x, y,
+                                 headingDegrees));
+  EXPECT_NEAR(14, x, 0.02);
+  EXPECT_NEAR(10, y, 0.02);
+  EXPECT_NEAR(0, headingDegrees, 0.1);
+
+  // Building a trajectory needs matching samples
+  Trajectory aTrajectory;
+  EXPECT_FALSE(aTrajectory.generateFromSamples(std::vector<double>(2, 0.0),
+                                               std::vector<double>(3, 0.0),
+                                               10));
+  EXPECT_FALSE(aTankDrive.generatePathTrajectories(
+      SplinePath(), ChassisVelocity::fromFeetPerSecond(3),
+      ChassisAcceleration::fromFeetPerSecondPerSecond(2), leftTrajectory,
+      rightTrajectory));
+
+  // A path is never finished at no velocity or acceleration, whether
+  // requested or the drive's maximum
+  EXPECT_FALSE(aTankDrive.generatePathTrajectories(
+      aSpline, ChassisVelocity::fromFeetPerSecond(0),
+      ChassisAcceleration::fromFeetPerSecondPerSecond(2), leftTrajectory,
+      rightTrajectory));
+  EXPECT_FALSE(aTankDrive.generatePathTrajectories(
+      aSpline, ChassisVelocity::fromFeetPerSecond(3),
+      ChassisAcceleration::fromFeetPerSecondPerSecond(0), leftTrajectory,
+      rightTrajectory));
+  TankDrive stoppedTankDrive = aTankDrive;
+  stoppedTankDrive.setMaxVelocity(MotorVelocity::fromRotationsPerMinute(0));
+  EXPECT_FALSE(stoppedTankDrive.generatePathTrajectories(
+      aSpline, ChassisVelocity::fromFeetPerSecond(3),
+      ChassisAcceleration::fromFeetPerSecondPerSecond(2), leftTrajectory,
+      rightTrajectory));
+  stoppedTankDrive = aTankDrive;
+  stoppedTankDrive.setMaxAcceleration(
+      MotorAcceleration::fromRotationsPerMinutePerSecond(0));
+  EXPECT_FALSE(stoppedTankDrive.generatePathTrajectories(
+      aSpline, ChassisVelocity::fromFeetPerSecond(3),
+      ChassisAcceleration::fromFeetPerSecondPerSecond(2), leftTrajectory,
+      rightTrajectory));
+}
+
+//*********************************************************
+// Test that tank drive move time estimates match the generated
+// trajectories, without generating them
+//*********************************************************
+TEST(TankDriveTest, testEstimateMoveTime) {
+  TankDrive aTankDrive;
+  aTankDrive.setMaxVelocity(MotorVelocity::fromRotationsPerMinute(4250));
+  aTankDrive.setMaxAcceleration(
+      MotorAcceleration::fromRotationsPerMinutePerSecond(51000));
+  aTankDrive.setMotorRotPerMovementFoot(850);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  aTankDrive.setWidthInFeet(2.75);
+
+  const double distancesFeet[] = { 0.5, 4, 12 };
+  const double turnRates[] = { -20, 0, 7.5 };
+  const double velocitiesFPS[] = { 2, 5 };
+  Trajectory leftTrajectory, rightTrajectory;
+  unsigned int pointCount;
+  double durationS;
+  for (const double distanceFeet : distancesFeet) {
+    for (const double turnRate : turnRates) {
+      for (const double velocityFPS : velocitiesFPS) {
+        const ChassisTurnRate chassisTurnRate =
+            ChassisTurnRate::fromDegreesPerFoot(turnRate);
+        const ChassisVelocity velocity = ChassisVelocity::fromFeetPerSecond(
+            velocityFPS);
+        const ChassisAcceleration acceleration =
+            ChassisAcceleration::fromFeetPerSecondPerSecond(3);
+        ASSERT_TRUE(aTankDrive.estimateMoveTime(distanceFeet, chassisTurnRate,
+                                                velocity, acceleration,
+                                                pointCount, durationS));
+        aTankDrive.generateTrajectories(distanceFeet, chassisTurnRate,
+                                        velocity, acceleration,
+                                        leftTrajectory, rightTrajectory);
+        EXPECT_EQ(leftTrajectory.size(), pointCount);
+        EXPECT_EQ(rightTrajectory.size(), pointCount);
+        EXPECT_NEAR(leftTrajectory.getDurationS(), durationS, 1e-9);
+      }
+    }
+  }
+
+}
+
+//*********************************************************
+// Test nearest and lookahead point queries on an indexed path
+//*********************************************************
+TEST(PathIndexTest, testNearestQueries) {
+  SplinePath aSpline;
+  std::vector<PoseWayPoint> wayPoints = { PoseWayPoint(0, 0, 0), PoseWayPoint(
+      8, 4, 60), PoseWayPoint(14, 10, 0), PoseWayPoint(20, 4, -90) };
+  ASSERT_TRUE(aSpline.generate(wayPoints, 0.01));
+  PathIndex anIndex;
+  EXPECT_EQ(0u, anIndex.findNearest(1, 1));
+  ASSERT_TRUE(anIndex.build(aSpline, 0.005));
+  ASSERT_GT(anIndex.size(), 5000u);
+  EXPECT_NEAR(20, anIndex.getXFeet(anIndex.size() - 1), 1e-6);
+  EXPECT_EQ(200u, anIndex.findLookahead(100, 0.5));
+  EXPECT_EQ(anIndex.size() - 1, anIndex.findLookahead(100, 1000));
+
+  // The tree search finds the same nearest point as a scan of every point
+  auto scanNearest = [&anIndex](double x, double y) {
+    unsigned int nearest = 0;
+    double nearestSquared = std::numeric_limits<double>::infinity();
+    for (unsigned int i = 0; i < anIndex.size(); i++) {
+      const double dx = anIndex.getXFeet(i) - x;
+      const double dy = anIndex.getYFeet(i) - y;
+      if (dx * dx + dy * dy < nearestSquared) {
+        nearestSquared = dx * dx + dy * dy;
+        nearest = i;
+      }
+    }
+    return nearest;
+  };
+  std::vector<double> queryX, queryY;
+  for (unsigned int i = 0; i < 1000; i++) {
+    queryX.push_back(-1 + 22.0 * ((i * 7919u) % 1000u) / 1000);
+    queryY.push_back(-2 + 14.0 * ((i * 104729u) % 1000u) / 1000);
+  }
+  for (unsigned int i = 0; i < queryX.size(); i++)
+    ASSERT_EQ(scanNearest(queryX[i], queryY[i]),
+              anIndex.findNearest(queryX[i], queryY[i]));
+
+  // A chassis moving along beside the path is tracked by walking from the
+  // last nearest point
+  std::vector<double> trackX, trackY;
+  unsigned int hint = 0;
+  for (unsigned int i = 0; i < anIndex.size(); i += 3) {
+    trackX.push_back(anIndex.getXFeet(i) + 0.1);
+    trackY.push_back(anIndex.getYFeet(i) - 0.1);
+  }
+  for (unsigned int i = 0; i < trackX.size(); i++) {
+    hint = anIndex.findNearestFrom(trackX[i], trackY[i], hint);
+    ASSERT_EQ(scanNearest(trackX[i], trackY[i]), hint);
+  }
+
+}
+
+//*********************************************************
+// Test steering a simulated chassis along a path with pure pursuit
+//*********************************************************
+TEST(PurePursuitFollowerTest, testFollowsPath) {
+  Route aRoute;
+  aRoute.addPoseWayPoint(PoseWayPoint(0, 0, 0));
+  aRoute.addPoseWayPoint(PoseWayPoint(8, 4, 60));
+  aRoute.addPoseWayPoint(PoseWayPoint(14, 10, 0));
+  SplinePath aSpline;
+  ASSERT_TRUE(aRoute.planSplinePath(aSpline, 0.01));
+  PathIndex anIndex;
+  ASSERT_TRUE(anIndex.build(aSpline, 0.01));
+
+  PurePursuitFollower aFollower;
+  ChassisVelocity left, right;
+  const ChassisVelocity velocity = ChassisVelocity::fromFeetPerSecond(3);
+  EXPECT_FALSE(aFollower.calculate(0, 0, 0, velocity, left, right));
+  aFollower.setPathIndex(anIndex);
+  aFollower.setLookaheadFeet(1.5);
+  aFollower.setWidthInFeet(2.75);
+  EXPECT_DOUBLE_EQ(1.5, aFollower.getLookaheadFeet());
+  EXPECT_DOUBLE_EQ(2.75, aFollower.getWidthInFeet());
+
+  // Start half a foot off the path, and drive the chassis at the side
+  // velocities commanded every 10 ms until it reaches the end of the path
+  const double periodS = 0.01;
+  const double pi = std::acos(-1.0);
+  double x = 0, y = -0.5, heading = 0;
+  double worstSettledError = 0;
+  unsigned int ticks = 0;
+  while (!aFollower.isAtEnd() && ticks < 2000) {
+    ASSERT_TRUE(aFollower.calculate(x, y, heading * 180 / pi, velocity, left,
+                                    right));
+    const double v = 0.5 * (left.getFeetPerSecond() + right.getFeetPerSecond());
+    heading += (left.getFeetPerSecond() - right.getFeetPerSecond()) / 2.75
+        * periodS;
+    x += v * std::cos(heading) * periodS;
+    y += v * std::sin(heading) * periodS;
+    ticks++;
+    if (ticks > 200) {
+      const unsigned int nearest = aFollower.getNearestIndex();
+      worstSettledError = std::max(
+          worstSettledError, std::hypot(x - anIndex.getXFeet(nearest),
+                                        y - anIndex.getYFeet(nearest)));
+    }
+  }
+  EXPECT_TRUE(aFollower.isAtEnd());
+  EXPECT_LT(worstSettledError, 0.15);
+  EXPECT_NEAR(14, x, 0.1);
+  EXPECT_NEAR(10, y, 0.1);
+
+  aFollower.reset();
+  EXPECT_EQ(0u, aFollower.getNearestIndex());
+}
+
+//*********************************************************
+// Test that the route optimizer finds the fastest order for a few locations
+//*********************************************************
+TEST(RouteOptimizerTest, testMatchesExhaustiveSearch) {
+  RouteOptimizer anOptimizer;
+  std::vector<PoseWayPoint> locations;
+  std::vector<unsigned int> order;
+  EXPECT_FALSE(anOptimizer.optimize(locations, order));
+
+  // Speeding up to 10 ft/s at 2 ft/s/s and stopping again takes 50 ft;
+  // shorter moves turn back at half way without cruising
+  anOptimizer.setMotionLimits(ChassisVelocity::fromFeetPerSecond(10),
+                              ChassisAcceleration::fromFeetPerSecondPerSecond(2));
+  EXPECT_DOUBLE_EQ(0.0, anOptimizer.estimateMoveSeconds(0));
+  EXPECT_DOUBLE_EQ(2 * std::sqrt(8.0 / 2), anOptimizer.estimateMoveSeconds(8));
+  EXPECT_DOUBLE_EQ(60.0 / 10 + 10.0 / 2, anOptimizer.estimateMoveSeconds(60));
+  EXPECT_FALSE(anOptimizer.optimize(locations, order));
+
+  const double xFeet[8] = { 0, 20, 3, 18, 9, 1, 22, 12 };
+  const double yFeet[8] = { 0, 4, 15, 17, 6, 9, 12, 25 };
+  for (unsigned int i = 0; i < 8; i++)
+    locations.push_back(PoseWayPoint(xFeet[i], yFeet[i], 0));
+  anOptimizer.setTimeBudgetMS(20);
+  anOptimizer.setThreadCount(2);
+  EXPECT_EQ(20u, anOptimizer.getTimeBudgetMS());
+  ASSERT_TRUE(anOptimizer.optimize(locations, order));
+
+  // The order visits every location once, from the first
+  ASSERT_EQ(8u, order.size());
+  EXPECT_EQ(0u, order[0]);
+  std::vector<unsigned int> sortedOrder(order);
+  std::sort(sortedOrder.begin(), sortedOrder.end());
+  for (unsigned int i = 0; i < 8; i++)
+    EXPECT_EQ(i, sortedOrder[i]);
+
+  // Every order from the first location, tried in turn
+  auto orderSeconds = [&](const std::vector<unsigned int> &anOrder) {
+    double seconds = 0;
+    for (unsigned int i = 1; i < anOrder.size(); i++)
+      seconds += anOptimizer.estimateMoveSeconds(std::hypot(
+          xFeet[anOrder[i]] - xFeet[anOrder[i - 1]],
+          yFeet[anOrder[i]] - yFeet[anOrder[i - 1]]));
+    return seconds;
+  };
+  std::vector<unsigned int> anOrder = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  const double insertionSeconds = orderSeconds(anOrder);
+  double fastestSeconds = insertionSeconds;
+  while (std::next_permutation(anOrder.begin() + 1, anOrder.end()))
+    fastestSeconds = std::min(fastestSeconds, orderSeconds(anOrder));
+  EXPECT_NEAR(fastestSeconds, anOptimizer.getOrderSeconds(), 1e-9);
+  EXPECT_NEAR(fastestSeconds, orderSeconds(order), 1e-9);
+  EXPECT_LE(anOptimizer.getOrderSeconds(),
+            anOptimizer.getNearestNeighborSeconds());
+  EXPECT_LT(anOptimizer.getOrderSeconds(), insertionSeconds);
+
+  // A route's pose way points are reordered, keeping the first
+  Route aRoute;
+  for (const auto &location : locations)
+    aRoute.addPoseWayPoint(location);
+  std::vector<unsigned int> routeOrder;
+  ASSERT_TRUE(aRoute.orderPoseWayPoints(anOptimizer, routeOrder));
+  EXPECT_EQ(8u, aRoute.getPoseWayPointCount());
+  EXPECT_NEAR(fastestSeconds, orderSeconds(routeOrder), 1e-9);
+  EXPECT_EQ(0u, routeOrder[0]);
+}
+
+//*********************************************************
+// Test that the route optimizer improves on nearest neighbor within its
+// budget or perturbation cap
+//*********************************************************
+TEST(RouteOptimizerTest, testImprovesWithinBudget) {
+  RouteOptimizer anOptimizer;
+  anOptimizer.setMotionLimits(ChassisVelocity::fromFeetPerSecond(12),
+                              ChassisAcceleration::fromFeetPerSecondPerSecond(6));
+
+  // Sixty scoring locations scattered over a 54 by 27 foot field
+  std::vector<PoseWayPoint> locations;
+  unsigned int state = 12345;
+  auto nextFeet = [&state](const double scale) {
+    state = state * 1103515245u + 12345u;
+    return (state >> 8) % 10000 / 10000.0 * scale;
+  };
+  for (unsigned int i = 0; i < 60; i++) {
+    const double x = nextFeet(54);
+    locations.push_back(PoseWayPoint(x, nextFeet(27), 0));
+  }
+
+  // With no budget the nearest neighbor order is returned
+  std::vector<unsigned int> order;
+  anOptimizer.setTimeBudgetMS(0);
+  ASSERT_TRUE(anOptimizer.optimize(locations, order));
+  EXPECT_DOUBLE_EQ(anOptimizer.getNearestNeighborSeconds(),
+                   anOptimizer.getOrderSeconds());
+
+  // A capped search ends after its perturbations, well within a generous
+  // budget, and one worker's capped search always finds the same order
+  anOptimizer.setTimeBudgetMS(60000);
+  anOptimizer.setMaxPerturbations(50);
+  anOptimizer.setThreadCount(1);
+  EXPECT_EQ(50u, anOptimizer.getMaxPerturbations());
+  ASSERT_TRUE(anOptimizer.optimize(locations, order));
+  ASSERT_EQ(60u, order.size());
+  EXPECT_EQ(0u, order[0]);
+  EXPECT_EQ(50u, anOptimizer.getPerturbationCount());
+  EXPECT_LT(anOptimizer.getOrderSeconds(),
+            anOptimizer.getNearestNeighborSeconds());
+  const std::vector<unsigned int> cappedOrder = order;
+  const double cappedSeconds = anOptimizer.getOrderSeconds();
+  ASSERT_TRUE(anOptimizer.optimize(locations, order));
+  EXPECT_EQ(cappedOrder, order);
+  EXPECT_DOUBLE_EQ(cappedSeconds, anOptimizer.getOrderSeconds());
+
+  // Each worker makes its own perturbations, and the fastest order found
+  // by any of them is no slower than the first worker's
+  anOptimizer.setThreadCount(3);
+  ASSERT_TRUE(anOptimizer.optimize(locations, order));
+  EXPECT_EQ(150u, anOptimizer.getPerturbationCount());
+  EXPECT_LE(anOptimizer.getOrderSeconds(), cappedSeconds);
+}
+
+//*********************************************************
+// Test per-chassis instrumentation of moves
+//*********************************************************
+TEST(InstrumentationTest, testPerChassisMoveStats) {
+  ASSERT_TRUE(Instrumentation::isEnabled());
+  Instrumentation::ChassisStats stats;
+  Instrumentation::reset();
+  EXPECT_FALSE(Instrumentation::getChassisStats("MCSFtest-instrumented",
+                                                stats));
+
+  TankDrive aTankDrive;
+  aTankDrive.setChassisName("MCSFtest-instrumented");
+  aTankDrive.setMaxVelocity(MotorVelocity::fromRotationsPerMinute(4250));
+  aTankDrive.setMaxAcceleration(
+      MotorAcceleration::fromRotationsPerMinutePerSecond(51000));
+  aTankDrive.setMotorRotPerMovementFoot(850);
+  aTankDrive.setTrajectoryIterationPeriodMS(10);
+  aTankDrive.setWidthInFeet(2.75);
+  const ChassisTurnRate turnRate = ChassisTurnRate::fromDegreesPerFoot(7.5);
+  const ChassisVelocity velocity = ChassisVelocity::fromFeetPerSecond(5);
+  const ChassisAcceleration acceleration =
+      ChassisAcceleration::fromFeetPerSecondPerSecond(3);
+  unsigned int pointCount;
+  double durationS;
+  ASSERT_TRUE(aTankDrive.estimateMoveTime(4, turnRate, velocity, acceleration,
+                                          pointCount, durationS));
+
+  // A move generates both sides and writes both CSV files
+  aTankDrive.move(4, turnRate, velocity, acceleration);
+  std::ifstream leftFile("MCSFtest-instrumented-left.CSV",
+                         std::ios::binary | std::ios::ate);
+  std::ifstream rightFile("MCSFtest-instrumented-right.CSV",
+                          std::ios::binary | std::ios::ate);
+  const unsigned long long bytes = static_cast<unsigned long long>(
+      leftFile.tellg()) + static_cast<unsigned long long>(rightFile.tellg());
+  leftFile.close();
+  rightFile.close();
+  std::remove("MCSFtest-instrumented-left.CSV");
+  std::remove("MCSFtest-instrumented-right.CSV");
+  ASSERT_TRUE(Instrumentation::getChassisStats("MCSFtest-instrumented",
+                                               stats));
+  EXPECT_EQ(1u, stats.total.moves);
+  EXPECT_EQ(pointCount, stats.total.pointsGenerated);
+  EXPECT_EQ(pointCount, stats.total.pointsScaled);
+  EXPECT_EQ(bytes, stats.total.bytesWritten);
+  EXPECT_GT(stats.total.generationNS, 0u);
+  EXPECT_GT(stats.total.exportNS, 0u);
+  EXPECT_GE(stats.total.moveNS,
+            stats.total.generationNS + stats.total.exportNS);
+
+  // Generating a move without output adds a move with no export
+  Trajectory leftTrajectory, rightTrajectory;
+  aTankDrive.generateTrajectories(4, turnRate, velocity, acceleration,
+                                  leftTrajectory, rightTrajectory);
+  ASSERT_TRUE(Instrumentation::getChassisStats("MCSFtest-instrumented",
+                                               stats));
+  EXPECT_EQ(2u, stats.total.moves);
+  EXPECT_EQ(2u * pointCount, stats.total.pointsGenerated);
+  EXPECT_EQ(2u * pointCount, stats.total.pointsScaled);
+  EXPECT_EQ(1u, stats.lastMove.moves);
+  EXPECT_EQ(pointCount, stats.lastMove.pointsGenerated);
+  EXPECT_EQ(pointCount, stats.lastMove.pointsScaled);
+  EXPECT_EQ(0u, stats.lastMove.bytesWritten);
+  EXPECT_EQ(0u, stats.lastMove.exportNS);
+
+  // Neither stages outside any move nor the moves of an unnamed chassis
+  // are recorded
+  leftTrajectory.generateScaled(rightTrajectory, 0.5);
+  leftTrajectory.generate(shortExecutionPath(1.0), 10);
+  TankDrive unnamedTankDrive = aTankDrive;
+  unnamedTankDrive.setChassisName("");
+  unnamedTankDrive.generateTrajectories(4, turnRate, velocity, acceleration,
+                                        leftTrajectory, rightTrajectory);
+  EXPECT_FALSE(Instrumentation::getChassisStats("", stats));
+  ASSERT_TRUE(Instrumentation::getChassisStats("MCSFtest-instrumented",
+                                               stats));
+  EXPECT_EQ(2u, stats.total.moves);
+  EXPECT_EQ(2u * pointCount, stats.total.pointsGenerated);
+  EXPECT_EQ(2u * pointCount, stats.total.pointsScaled);
+  const std::vector<std::string> names = Instrumentation::getChassisNames();
+  ASSERT_EQ(1u, names.size());
+  EXPECT_EQ("MCSFtest-instrumented", names[0]);
+
+  std::ostringstream report;
+  Instrumentation::report(report);
+  std::ostringstream lastMove;
+  lastMove << "Chassis \"MCSFtest-instrumented\" last move: 1 moves";
+  EXPECT_NE(std::string::npos, report.str().find(lastMove.str()));
+  std::ostringstream points;
+  points << " us, " << pointCount << " points, " << pointCount
+         << " scaled; export 0 us, 0 bytes";
+  EXPECT_NE(std::string::npos, report.str().find(points.str()));
+  EXPECT_EQ(std::string::npos, report.str().find("Chassis \"\""));
+  Instrumentation::reset();
+  EXPECT_TRUE(Instrumentation::getChassisNames().empty());
+}
+
+//*********************************************************
+// Helper: read a trajectory CSV file into its title, its
+// labelled header values, its column names, and its rows
+//*********************************************************
+static bool readProfileCSV(const std::string &fileName, std::string &title,
+                           std::vector<std::string> &labels,
+                           std::vector<double> &values, std::string &columns,
+                           std::vector<std::vector<double> > &rows) {
+  std::ifstream file(fileName);
+  if (!file || !std::getline(file, title))
+    return false;
+  std::string line;
+  while (std::getline(file, line) && line.compare(0, 5, "Step,") != 0) {
+    const std::string::size_type comma = line.find(',');
+    if (comma == std::string::npos)
+      return false;
+    labels.push_back(line.substr(0, comma));
+    values.push_back(std::stod(line.substr(comma + 1)));
+  }
+  columns = line;
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string field;
+    std::vector<double> row;
+    while (std::getline(fields, field, ','))
+      row.push_back(std::stod(field));
+    rows.push_back(row);
+  }
+  return !columns.empty();
+}
+
+//*********************************************************
+// Helper: compare a generated trajectory CSV file with a golden
+// one from test/golden, field by field.  The golden files hold 6
+// significant digits, so values may differ by a little more than
+// that, but no more.
+//*********************************************************
+static void expectMatchesGoldenProfile(const std::string &fileName,
+                                       const std::string &goldenFileName) {
+  const double relativeTolerance = 2e-5;
+  const double absoluteTolerance = 1e-6;
+  std::string title, goldenTitle, columns, goldenColumns;
+  std::vector<std::string> labels, goldenLabels;
+  std::vector<double> values, goldenValues;
+  std::vector<std::vector<double> > rows, goldenRows;
+  ASSERT_TRUE(readProfileCSV(fileName, title, labels, values, columns, rows))
+      << fileName;
+  ASSERT_TRUE(readProfileCSV(std::string(MCSF_GOLDEN_DIR) + goldenFileName,
+                             goldenTitle, goldenLabels, goldenValues,
+                             goldenColumns, goldenRows)) << goldenFileName;
+  EXPECT_EQ(goldenTitle, title);
+  EXPECT_EQ(goldenColumns, columns);
+
+  // The header: limits, distance, and generation parameters
+  ASSERT_EQ(goldenLabels, labels);
+  for (unsigned int i = 0; i < labels.size(); i++)
+    EXPECT_NEAR(goldenValues[i], values[i],
+                relativeTolerance * std::fabs(goldenValues[i])
+                    + absoluteTolerance) << goldenFileName << " " << labels[i];
+
+  // Every column of every trajectory point (reporting the first few misses)
+  ASSERT_EQ(goldenRows.size(), rows.size()) << goldenFileName;
+  unsigned int mismatches = 0;
+  for (unsigned int r = 0; r < rows.size(); r++) {
+    ASSERT_EQ(goldenRows[r].size(), rows[r].size()) << goldenFileName
+                                                    << " step " << r + 1;
+    for (unsigned int c = 0; c < rows[r].size(); c++) {
+      const double tolerance = relativeTolerance * std::fabs(goldenRows[r][c])
+          + absoluteTolerance;
+      if (std::fabs(rows[r][c] - goldenRows[r][c]) > tolerance
+          && ++mismatches <= 10)
+        ADD_FAILURE() << goldenFileName << " step " << r + 1 << " column "
+                      << c + 1 << ": expected " << goldenRows[r][c]
+                      << ", generated " << rows[r][c];
+    }
+  }
+  EXPECT_EQ(0u, mismatches) << goldenFileName;
+}
+
+//*********************************************************
+// Test that the 5 rotation demonstration trajectory (evolution 1)
+// still matches the profiles checked against the Talon Motion
+// Profile spreadsheet, at 10 ms and 25 ms iteration periods
+//*********************************************************
+TEST(GoldenProfileTest, testFiveRotationProfiles) {
+  Path aPath;
+  aPath.emplacePathPoint(MotorPosition(),
+                         MotorVelocity::fromRotationsPerMinute(240),
+                         MotorAcceleration::fromRotationsPerMinutePerSecond(
+                             600));
+  aPath.emplacePathPoint(MotorPosition::fromRotations(5),
+                         MotorVelocity::fromRotationsPerMinute(120),
+                         MotorAcceleration::fromRotationsPerMinutePerSecond(
+                             300));
+  const std::string fileName = "MCSFtest-golden.CSV";
+  for (const unsigned int periodMS : { 10, 25 }) {
+    Trajectory aTrajectory;
+    aTrajectory.generate(aPath, periodMS);
+    aTrajectory.outputCSV(fileName);
+    expectMatchesGoldenProfile(fileName,
+                               "5rot-" + std::to_string(periodMS) + "ms.CSV");
+  }
+  std::remove(fileName.c_str());
+}
+
+//*********************************************************
+// Test that the Johnny5 demonstration move (evolution 2, 45 feet
+// turning right 5 degrees per foot) still matches the profiles
+// recorded for its left and right sides
+//*********************************************************
+TEST(GoldenProfileTest, testJohnny5Profiles) {
+  Chassis aChassis;
+  configureFleetChassis(aChassis, "MCSFtest-golden-Johnny5", 2.75);
+  aChassis.move(45, ChassisTurnRate::fromDegreesPerFoot(5),
+                ChassisVelocity::fromFeetPerSecond(3),
+                ChassisAcceleration::fromFeetPerSecondPerSecond(2));
+
+  // The left side is the 2017-03-14 result.  The right side is derived from
+  // the left (governing) side, with the same timing, so its golden profile
+  // has the left side's 1499 steps; the 2017-03-14 right side was generated
+  // separately, took 1500 steps, and ended 10 ms after the left side
+  expectMatchesGoldenProfile("MCSFtest-golden-Johnny5-left.CSV",
+                             "Johnny5-left.CSV");
+  expectMatchesGoldenProfile("MCSFtest-golden-Johnny5-right.CSV",
+                             "Johnny5-right.CSV");
+  std::remove("MCSFtest-golden-Johnny5-left.CSV");
+  std::remove("MCSFtest-golden-Johnny5-right.CSV");
+}